@@ -5,7 +5,9 @@
 #include <cvl/core/ConsoleLoggingBackend.h>
 #include <cvl/core/ILogger.h>
 #include <cvl/core/Image.h>
+#include <cvl/core/ImagePool.h>
 #include <cvl/core/SpinLock.h>
+#include <cvl/core/StatsMemoryResource.h>
 #include <cvl/core/Time.h>
 
 // STD includes
@@ -105,10 +107,12 @@ struct DummyData
 using namespace cvl::core;
 
 SpinLock spinLock;
+ImagePool imagePool;
 std::vector< uint8_t > poolBuffer;
 std::unique_ptr< std::pmr::monotonic_buffer_resource > underlyingBytes;
 std::pmr::pool_options options;
 std::unique_ptr< std::pmr::unsynchronized_pool_resource > unsynchronizedPool;
+std::unique_ptr< StatsMemoryResource > poolStats;
 
 template < typename Allocator >
 Image< uint8_t, 1, Allocator > createImage( )
@@ -121,8 +125,7 @@ Image< uint8_t, 1, Allocator > createImage( )
             IMAGE_WIDTH,
             IMAGE_HEIGHT,
             false,
-            std::pmr::polymorphic_allocator< uint8_t >(
-                unsynchronizedPool.get( ) ) );
+            std::pmr::polymorphic_allocator< uint8_t >( poolStats.get( ) ) );
     }
 #if defined( BUILD_WITH_TBB )
     else if constexpr ( std::is_same_v<
@@ -141,7 +144,7 @@ Image< uint8_t, 1, Allocator > createImage( )
     }
 }
 
-template < typename PixelType, typename Allocator >
+template < bool usePool, typename PixelType, typename Allocator >
 Image< PixelType, 1,
        typename std::allocator_traits< Allocator >::template rebind_alloc<
            PixelType > >
@@ -152,8 +155,21 @@ threshold( const Image< PixelType, 1, Allocator >& imageIn, PixelType threshold,
     using OutAllocator =
         typename allocator_traits::template rebind_alloc< PixelType >;
 
-    auto segmented = Image< PixelType, 1, Allocator >(
-        imageIn.getSize( ), false, imageIn.getAllocator( ) );
+    // The pool reuses the buffer of the previous result. Only stateless
+    // and polymorphic allocators can be pooled.
+    auto segmented = [ & ]( )
+    {
+        if constexpr ( usePool )
+        {
+            return imagePool.acquire< PixelType, 1, Allocator >(
+                imageIn.getSize( ), false, imageIn.getAllocator( ) );
+        }
+        else
+        {
+            return Image< PixelType, 1, Allocator >(
+                imageIn.getSize( ), false, imageIn.getAllocator( ) );
+        }
+    }( );
 
     for ( int32_t y = 0; y < imageIn.getHeight( ); y++ )
     {
@@ -172,7 +188,7 @@ threshold( const Image< PixelType, 1, Allocator >& imageIn, PixelType threshold,
     return segmented;
 }
 
-template < typename Allocator >
+template < typename Allocator, bool usePool = false >
 void threadFunc( ThreadData* data )
 {
     {
@@ -205,7 +221,7 @@ void threadFunc( ThreadData* data )
                     // const Image< uint8_t, 1, Allocator > imgCopy( imageToCopy
                     // );
                     const auto segmented =
-                        threshold( imageToCopy, uint8_t { 128 } );
+                        threshold< usePool >( imageToCopy, uint8_t { 128 } );
 
                     if ( segmented.getSize( ) != imageToCopy.getSize( ) )
                     {
@@ -285,7 +301,7 @@ void threadFuncFragmentation( ThreadData* data )
     }
 }
 
-template < typename Allocator >
+template < typename Allocator, bool usePool = false >
 void addThread( std::vector< std::thread >& threads,
                 std::vector< std::unique_ptr< ThreadData > >& threadData,
                 std::string name )
@@ -293,7 +309,8 @@ void addThread( std::vector< std::thread >& threads,
     threadData.emplace_back(
         std::make_unique< ThreadData >( true, std::move( name ) ) );
 
-    threads.emplace_back( threadFunc< Allocator >, threadData.back( ).get( ) );
+    threads.emplace_back( threadFunc< Allocator, usePool >,
+                          threadData.back( ).get( ) );
 }
 
 template < typename Allocator >
@@ -336,6 +353,10 @@ int32_t main( [[maybe_unused]] int32_t argc, [[maybe_unused]] char** argv )
         std::make_unique< std::pmr::unsynchronized_pool_resource >(
             options, underlyingBytes.get( ) );
 
+    // Counts the allocations of the pool, the counters are printed on exit
+    poolStats = std::make_unique< StatsMemoryResource >(
+        "std::pmr::unsynchronized_pool_resource", unsynchronizedPool.get( ) );
+
     LOG_INFO( "IMAGE ALLOCATOR TEST" );
 
     LOG_INFO( "Image Size: " << SizeI( IMAGE_WIDTH, IMAGE_HEIGHT ) );
@@ -369,6 +390,19 @@ int32_t main( [[maybe_unused]] int32_t argc, [[maybe_unused]] char** argv )
     addThread< AlignedAllocator< uint8_t > >(
         threads, threadData, "cvl::core::AlignedAllocator_1" );
 
+    //
+    // cvl::core::ImagePool
+    //
+
+    imagePool.reserve< uint8_t, 1, AlignedAllocator< uint8_t > >(
+        SizeI( IMAGE_WIDTH, IMAGE_HEIGHT ), 2 );
+
+    addThread< AlignedAllocator< uint8_t >, true >(
+        threads, threadData, "cvl::core::ImagePool_0" );
+
+    addThread< AlignedAllocator< uint8_t >, true >(
+        threads, threadData, "cvl::core::ImagePool_1" );
+
 #if defined( BUILD_WITH_TBB )
 
     //
@@ -463,6 +497,11 @@ int32_t main( [[maybe_unused]] int32_t argc, [[maybe_unused]] char** argv )
         }
     }
 
+    for ( const auto& stats : StatsMemoryResource::getAllSnapshots( ) )
+    {
+        LOG_INFO( stats );
+    }
+
     return 0;
 }
 
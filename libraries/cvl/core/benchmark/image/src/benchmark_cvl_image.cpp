@@ -22,6 +22,9 @@ int main( )
 // CVL includes
     #include <cvl/core/AlignedAllocator.h>
     #include <cvl/core/Image.h>
+    #include <cvl/core/ImagePool.h>
+    #include <cvl/core/PageMemory.h>
+    #include <cvl/core/Parallel.h>
     #include <cvl/core/Rectangle.h>
     #include <cvl/core/macros.h>
 
@@ -393,6 +396,205 @@ BENCHMARK( BM_ImageCopyStdPmrAllocatorMt )
     ->UseRealTime( )
     ->Threads( numThreads );
 
+//
+// ROI
+//
+// Creates a ROI view per iteration. No pixel is copied, the cost is the
+// reference counting of the shared buffer.
+//
+
+static void BM_ImageGetRoi( benchmark::State& state )
+{
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+    const Image< uint8_t, 1 > image( size, size );
+    const auto roi = Rectangle< int32_t >( Point2i( size / 4, size / 4 ),
+                                           SizeI( size / 2, size / 2 ) );
+
+    for ( auto _ : state )
+    {
+        const auto imageRoi = image( roi );
+
+        benchmark::DoNotOptimize( imageRoi.getData( ) );
+    }
+}
+
+BENCHMARK( BM_ImageGetRoi )
+    ->Arg( 256 )
+    ->Arg( 4096 )
+    ->UseRealTime( )
+    ->Threads( 1 )
+    ->Threads( numThreads );
+
+//
+// Image creation
+//
+// Creates one image per iteration, like a new frame. The pool variant reuses
+// the buffer of the previous frame.
+//
+
+static void BM_ImageCreateAlignedAllocator( benchmark::State& state )
+{
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+
+    for ( auto _ : state )
+    {
+        Image< uint8_t, 1, AlignedAllocator< uint8_t > > image( size, size );
+
+        benchmark::DoNotOptimize( image.getData( ) );
+    }
+
+    state.SetComplexityN( size * size );
+}
+
+BENCHMARK( BM_ImageCreateAlignedAllocator )
+    ->Arg( 256 )
+    ->Arg( 512 )
+    ->Arg( 1024 )
+    ->Arg( 2048 )
+    ->Arg( 4096 )
+    ->Complexity( benchmark::oN )
+    ->UseRealTime( )
+    ->Threads( numThreads );
+
+static void BM_ImageCreatePool( benchmark::State& state )
+{
+    static ImagePool pool;
+
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+
+    for ( auto _ : state )
+    {
+        auto image = pool.acquire< uint8_t, 1 >( SizeI( size, size ) );
+
+        benchmark::DoNotOptimize( image.getData( ) );
+    }
+
+    state.SetComplexityN( size * size );
+}
+
+BENCHMARK( BM_ImageCreatePool )
+    ->Arg( 256 )
+    ->Arg( 512 )
+    ->Arg( 1024 )
+    ->Arg( 2048 )
+    ->Arg( 4096 )
+    ->Complexity( benchmark::oN )
+    ->UseRealTime( )
+    ->Threads( numThreads );
+
+//
+// Memory policies
+//
+// Reads the image column by column. Every pixel of a column lies on another
+// page, the time is dominated by TLB misses. Huge pages cover 512 rows of a
+// 4096 wide image with one TLB entry.
+//
+
+using HeapAllocator = AlignedAllocator< uint8_t >;
+using PageAllocator =
+    AlignedAllocator< uint8_t, 64, PageMemory< HugePages::None > >;
+using HugePageAllocator =
+    AlignedAllocator< uint8_t, 64, PageMemory< HugePages::Transparent > >;
+using ExplicitHugePageAllocator =
+    AlignedAllocator< uint8_t, 64, PageMemory< HugePages::Explicit > >;
+using FirstTouchAllocator =
+    AlignedAllocator< uint8_t, 64,
+                      PageMemory< HugePages::Transparent, -1, true > >;
+
+template < typename Allocator >
+static void BM_ImageColumnAccess( benchmark::State& state )
+{
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+    Image< uint8_t, 1, Allocator > image( size, size, true );
+
+    for ( auto _ : state )
+    {
+        uint32_t sum { };
+
+        for ( int32_t x = 0; x < size; x++ )
+        {
+            for ( int32_t y = 0; y < size; y++ )
+            {
+                sum += image.at( y, x );
+            }
+        }
+
+        benchmark::DoNotOptimize( sum );
+    }
+
+    state.SetBytesProcessed( static_cast< int64_t >( state.iterations( ) ) *
+                             static_cast< int64_t >( size ) * size );
+}
+
+BENCHMARK_TEMPLATE( BM_ImageColumnAccess, HeapAllocator )
+    ->Arg( 1024 )
+    ->Arg( 4096 )
+    ->Arg( 8192 )
+    ->UseRealTime( );
+
+BENCHMARK_TEMPLATE( BM_ImageColumnAccess, PageAllocator )
+    ->Arg( 1024 )
+    ->Arg( 4096 )
+    ->Arg( 8192 )
+    ->UseRealTime( );
+
+BENCHMARK_TEMPLATE( BM_ImageColumnAccess, HugePageAllocator )
+    ->Arg( 1024 )
+    ->Arg( 4096 )
+    ->Arg( 8192 )
+    ->UseRealTime( );
+
+BENCHMARK_TEMPLATE( BM_ImageColumnAccess, ExplicitHugePageAllocator )
+    ->Arg( 1024 )
+    ->Arg( 4096 )
+    ->Arg( 8192 )
+    ->UseRealTime( );
+
+//
+// Creates and fills one image per iteration with all threads. With the
+// parallel first touch the pages are placed on the nodes of the threads that
+// fill them.
+//
+
+template < typename Allocator >
+static void BM_ImageCreateFill( benchmark::State& state )
+{
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+
+    for ( auto _ : state )
+    {
+        Image< uint8_t, 1, Allocator > image( size, size );
+
+        parallelFor( 0,
+                     size,
+                     [ & ]( int32_t y )
+                     {
+                         auto* row = image.getRowPointer( y );
+                         std::fill( row, row + size, uint8_t { 1 } );
+                     } );
+
+        benchmark::DoNotOptimize( image.getData( ) );
+    }
+
+    state.SetBytesProcessed( static_cast< int64_t >( state.iterations( ) ) *
+                             static_cast< int64_t >( size ) * size );
+}
+
+BENCHMARK_TEMPLATE( BM_ImageCreateFill, HeapAllocator )
+    ->Arg( 4096 )
+    ->Arg( 8192 )
+    ->UseRealTime( );
+
+BENCHMARK_TEMPLATE( BM_ImageCreateFill, HugePageAllocator )
+    ->Arg( 4096 )
+    ->Arg( 8192 )
+    ->UseRealTime( );
+
+BENCHMARK_TEMPLATE( BM_ImageCreateFill, FirstTouchAllocator )
+    ->Arg( 4096 )
+    ->Arg( 8192 )
+    ->UseRealTime( );
+
 BENCHMARK_MAIN( );
 
 #endif
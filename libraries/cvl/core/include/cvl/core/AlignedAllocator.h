@@ -14,7 +14,46 @@
 namespace cvl::core
 {
 
-template < typename T, std::size_t Alignment = 64 >
+/**
+ * @brief The HeapMemory struct
+ *
+ * The default memory policy of the AlignedAllocator. The memory is taken
+ * from the aligned heap of the C runtime.
+ */
+struct HeapMemory
+{
+    static void* allocate( std::size_t bytes, std::size_t alignment )
+    {
+#if defined( WIN32 )
+        return _aligned_malloc( bytes, alignment );
+#else
+        // The size must be a multiple of the alignment
+        const auto alignedBytes =
+            ( bytes + alignment - 1 ) / alignment * alignment;
+
+        return std::aligned_alloc( alignment, alignedBytes );
+#endif
+    }
+
+    static void deallocate( void* p, [[maybe_unused]] std::size_t bytes )
+    {
+#if defined( WIN32 )
+        _aligned_free( p );
+#else
+        std::free( p );
+#endif
+    }
+};
+
+/**
+ * @brief The AlignedAllocator class
+ *
+ * Allocator that aligns every allocation to Alignment bytes. The Memory
+ * policy decides where the memory comes from, e.g. HeapMemory or
+ * PageMemory for huge pages and NUMA node binding.
+ */
+template < typename T, std::size_t Alignment = 64,
+           typename Memory = HeapMemory >
 class AlignedAllocator
 {
 public:
@@ -33,7 +72,7 @@ public:
     template < class U >
     struct rebind
     {
-        using other = AlignedAllocator< U >;
+        using other = AlignedAllocator< U, Alignment, Memory >;
     };
 
     /* constructors and destructor
@@ -44,7 +83,8 @@ public:
     constexpr AlignedAllocator( const AlignedAllocator& ) noexcept = default;
 
     template < class U >
-    constexpr AlignedAllocator( const AlignedAllocator< U >& ) noexcept
+    constexpr AlignedAllocator(
+        const AlignedAllocator< U, Alignment, Memory >& ) noexcept
     {
     }
 
@@ -62,11 +102,7 @@ public:
     {
         if ( num != 0 && p != nullptr )
         {
-#if defined( WIN32 )
-            _aligned_free( p );
-#else
-            std::free( p );
-#endif
+            Memory::deallocate( p, num * sizeof( value_type ) );
         }
     }
 
@@ -76,14 +112,8 @@ public:
     {
         if ( num > 0 )
         {
-            void* ptr { };
-#if defined( WIN32 )
-            ptr = _aligned_malloc( num * sizeof( value_type ), Alignment );
-#else
-            ptr = std::aligned_alloc(1024, num * sizeof( value_type ));
-#endif
-
-            return static_cast< pointer >( ptr );
+            return static_cast< pointer >(
+                Memory::allocate( num * sizeof( value_type ), Alignment ) );
         }
 
         return nullptr;
@@ -91,9 +121,9 @@ public:
 };
 
 // return that all specializations of this allocator are interchangeable
-template < class T1, class T2 >
-bool operator==( const AlignedAllocator< T1 >&,
-                 const AlignedAllocator< T2 >& ) noexcept
+template < class T1, class T2, std::size_t Alignment, typename Memory >
+bool operator==( const AlignedAllocator< T1, Alignment, Memory >&,
+                 const AlignedAllocator< T2, Alignment, Memory >& ) noexcept
 {
     return true;
 }
@@ -0,0 +1,154 @@
+#pragma once
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+
+namespace cvl::core
+{
+
+/**
+ * @brief The planar channel layout
+ *
+ * Each channel is stored in a plane of its own. The planes follow each other
+ * in the buffer. A row of a channel is contiguous.
+ *
+ * c1 c1 c1
+ * c1 c1 c1
+ * c2 c2 c2
+ * c2 c2 c2
+ */
+struct PlanarLayout
+{
+    /**
+     * Function that returns the distance between two horizontally adjacent
+     * pixels of a channel in elements.
+     */
+    template < int32_t Channels >
+    static constexpr int32_t getPixelStep( )
+    {
+        return 1;
+    }
+
+    /**
+     * Function that returns the number of planes of an image.
+     */
+    template < int32_t Channels >
+    static constexpr int32_t getNumberPlanes( )
+    {
+        return Channels;
+    }
+
+    /**
+     * Function that returns the number of elements of a row of a plane.
+     *
+     * @param [in]  width   The width of the image in pixels.
+     */
+    template < int32_t Channels >
+    static constexpr int32_t getRowElements( int32_t width )
+    {
+        return width;
+    }
+
+    /**
+     * Function that calculates the offset from the beginning of the buffer to
+     * the defined position.
+     *
+     * @param [in]  stride    The stride of the image in elements.
+     * @param [in]  height    The height of the image.
+     * @param [in]  row       The row to access
+     * @param [in]  column    The column to access
+     * @param [in]  channel   The channel to access
+     *
+     * @return The offset in elements
+     */
+    template < int32_t Channels >
+    static constexpr size_t getOffset( int32_t stride, int32_t height,
+                                       int32_t row, int32_t column,
+                                       int32_t channel )
+    {
+        const auto planeElements = static_cast< size_t >( stride ) * height;
+
+        return planeElements * static_cast< size_t >( channel ) +
+               static_cast< size_t >( stride ) * static_cast< size_t >( row ) +
+               static_cast< size_t >( column );
+    }
+};
+
+/**
+ * @brief The interleaved channel layout
+ *
+ * All channels of a pixel are stored next to each other. There is one plane
+ * only, a row holds the channels of all pixels of the row.
+ *
+ * c1 c2 c3 c1 c2 c3 c1 c2 c3
+ * c1 c2 c3 c1 c2 c3 c1 c2 c3
+ */
+struct InterleavedLayout
+{
+    /**
+     * Function that returns the distance between two horizontally adjacent
+     * pixels of a channel in elements.
+     */
+    template < int32_t Channels >
+    static constexpr int32_t getPixelStep( )
+    {
+        return Channels;
+    }
+
+    /**
+     * Function that returns the number of planes of an image.
+     */
+    template < int32_t Channels >
+    static constexpr int32_t getNumberPlanes( )
+    {
+        return 1;
+    }
+
+    /**
+     * Function that returns the number of elements of a row.
+     *
+     * @param [in]  width   The width of the image in pixels.
+     */
+    template < int32_t Channels >
+    static constexpr int32_t getRowElements( int32_t width )
+    {
+        return width * Channels;
+    }
+
+    /**
+     * Function that calculates the offset from the beginning of the buffer to
+     * the defined position.
+     *
+     * @param [in]  stride    The stride of the image in elements.
+     * @param [in]  height    The height of the image.
+     * @param [in]  row       The row to access
+     * @param [in]  column    The column to access
+     * @param [in]  channel   The channel to access
+     *
+     * @return The offset in elements
+     */
+    template < int32_t Channels >
+    static constexpr size_t getOffset( int32_t stride,
+                                       [[maybe_unused]] int32_t height,
+                                       int32_t row, int32_t column,
+                                       int32_t channel )
+    {
+        return static_cast< size_t >( stride ) * static_cast< size_t >( row ) +
+               static_cast< size_t >( column ) * Channels +
+               static_cast< size_t >( channel );
+    }
+};
+
+/**
+ * @brief Concept of a channel layout policy of an image
+ */
+template < typename Layout >
+concept ChannelLayout = requires( int32_t value ) {
+    Layout::template getPixelStep< 1 >( );
+    Layout::template getNumberPlanes< 1 >( );
+    Layout::template getRowElements< 1 >( value );
+    Layout::template getOffset< 1 >( value, value, value, value, value );
+};
+
+} // namespace cvl::core
@@ -0,0 +1,87 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/export.h>
+
+// STD includes
+#include <cstdint>
+#include <ostream>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) ||      \
+    defined( _M_IX86 )
+#define CVL_ARCH_X86 1
+#else
+#define CVL_ARCH_X86 0
+#endif
+
+/**
+ * @brief Enable an instruction set for a single function
+ *
+ * GCC and Clang only allow intrinsics of instruction sets that are enabled for
+ * the function. MSVC allows all intrinsics in every function, so the macros
+ * are empty.
+ */
+#if CVL_ARCH_X86 && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define CVL_TARGET_SSE2   __attribute__( ( target( "sse2" ) ) )
+#define CVL_TARGET_AVX2   __attribute__( ( target( "avx2" ) ) )
+#define CVL_TARGET_AVX512                                                      \
+    __attribute__( ( target( "avx512f,avx512bw,avx512vl" ) ) )
+#else
+#define CVL_TARGET_SSE2
+#define CVL_TARGET_AVX2
+#define CVL_TARGET_AVX512
+#endif
+
+namespace cvl::core
+{
+
+/**
+ * @brief The SIMD instruction set levels, ordered by capability
+ *
+ * AVX512 requires the F, BW and VL extensions.
+ */
+enum class SimdLevel : int32_t
+{
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+/**
+ * Function that detects the best SIMD level supported by the CPU and the
+ * operating system. The detection runs once, the result is cached.
+ *
+ * @return The best supported SIMD level.
+ */
+CVL_CORE_EXPORT
+SimdLevel getSimdLevel( );
+
+/**
+ * Function that checks if a SIMD level is supported by the CPU.
+ *
+ * @param [in]  level   The SIMD level to check.
+ *
+ * @return True if the level is supported, else false.
+ */
+CVL_CORE_EXPORT
+bool isSimdLevelSupported( SimdLevel level );
+
+inline std::ostream& operator<<( std::ostream& os, SimdLevel level )
+{
+    switch ( level )
+    {
+    case SimdLevel::Scalar:
+        return os << "Scalar";
+    case SimdLevel::SSE2:
+        return os << "SSE2";
+    case SimdLevel::AVX2:
+        return os << "AVX2";
+    case SimdLevel::AVX512:
+        return os << "AVX512";
+    }
+
+    return os;
+}
+
+} // namespace cvl::core
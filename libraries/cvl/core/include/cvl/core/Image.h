@@ -5,13 +5,16 @@
 #include <cstdint>
 #include <memory>
 #include <cstring>
+#include <utility>
 
 // CVL includes
 #include <cvl/core/AlignedAllocator.h>
 #include <cvl/core/Alignment.h>
-#include <cvl/core/Handle.h>
+#include <cvl/core/ChannelLayout.h>
+#include <cvl/core/ImageBuffer.h>
 #include <cvl/core/ImageTraits.h>
 #include <cvl/core/Rectangle.h>
+#include <cvl/core/RowAlignment.h>
 #include <cvl/core/Size.h>
 #include <cvl/core/Types.h>
 #include <cvl/core/macros.h>
@@ -19,8 +22,6 @@
 namespace cvl::core
 {
 
-constexpr std::size_t width_alignment = 1;
-
 class IImage
 {
     CVL_INTERFACE( IImage );
@@ -30,9 +31,22 @@ class IImage
  * @brief This class describes a generic image class.
  * The data is managed by a shared handle and is deleted if no other instance
  * has access to the buffer anymore
+ *
+ * The channel layout policy defines how the channels of a multi channel image
+ * are stored, planar (default) or interleaved. For an interleaved image the
+ * stride covers the channels of all pixels of a row. The row pointer of a
+ * channel points to the first element of the channel in the row, the next
+ * pixel of the channel follows after pixel_step elements.
+ *
+ * The row alignment policy defines the boundary every row of an allocated
+ * image starts on. The stride is padded to the boundary. ROIs keep the
+ * stride of the image, their rows are aligned only if the left column of the
+ * ROI is.
  */
 template < Arithmetic PixelType, int32_t Channels,
-           typename Allocator = AlignedAllocator< PixelType > >
+           typename Allocator = AlignedAllocator< PixelType >,
+           ChannelLayout Layout = PlanarLayout,
+           RowAlignmentPolicy Alignment = PackedRows >
 class Image : public IImage
 {
 public:
@@ -42,7 +56,31 @@ public:
     using const_reference_type = const PixelType&;
     using allocator_type = Allocator;
     using allocator_traits = std::allocator_traits< allocator_type >;
-    using memory_handle = std::shared_ptr< Handle >;
+    using memory_handle = ImageBufferPointer;
+    using layout_type = Layout;
+    using alignment_type = Alignment;
+
+    /**
+     * The distance between two horizontally adjacent pixels of a channel in
+     * elements
+     */
+    static constexpr int32_t pixel_step =
+        Layout::template getPixelStep< Channels >( );
+
+    /**
+     * The number of planes of the buffer
+     */
+    static constexpr int32_t number_planes =
+        Layout::template getNumberPlanes< Channels >( );
+
+    /**
+     * Function that calculates the stride of an allocated image.
+     *
+     * @param [in]  width   The width of the image
+     *
+     * @returns The stride in elements, padded to the row alignment
+     */
+    [[nodiscard]] static constexpr int32_t calculateStride( int32_t width );
 
     /**
      * Default constructor
@@ -123,10 +161,50 @@ public:
      * @param width         The width of the image
      * @param height        The height of the image
      * @param data          The pointer to the data
+     * @param stride        The step size of each row in bytes. For an
+     *                      interleaved image a row holds all channels.
+     * @param allocator     The allocator object to be used
+     */
+    Image( int32_t width, int32_t height, void* data, int32_t stride,
+           const Allocator& allocator = Allocator( ) );
+
+    /**
+     * Value construct
+     *
+     * @brief The constructor creates an image with the given dimensions on an
+     * already allocated buffer. The memory handle references the buffer
+     * header, which is shared by all copies and ROIs of the image. The buffer
+     * is released with the last reference.
+     *
+     * @param width         The width of the image
+     * @param height        The height of the image
+     * @param data          The pointer to the data
      * @param stride        The step size of each row in bytes
+     * @param memoryHandle  The handle releasing the buffer
      * @param allocator     The allocator object to be used
      */
     Image( int32_t width, int32_t height, void* data, int32_t stride,
+           memory_handle memoryHandle,
+           const Allocator& allocator = Allocator( ) );
+
+    /**
+     * Value construct
+     *
+     * @brief The constructor adopts an external buffer, e.g. the buffer of a
+     * camera SDK, without copying it. The release callback is called exactly
+     * once, when the last copy or ROI of the image is destroyed. Afterwards
+     * the owner can reuse the buffer, e.g. requeue it to the driver.
+     *
+     * @param width         The width of the image
+     * @param height        The height of the image
+     * @param data          The pointer to the data
+     * @param stride        The step size of each row in bytes
+     * @param onRelease     The function called when the buffer is released.
+     *                      It must not throw.
+     * @param allocator     The allocator object to be used
+     */
+    Image( int32_t width, int32_t height, void* data, int32_t stride,
+           ExternalImageBuffer::ReleaseCallback onRelease,
            const Allocator& allocator = Allocator( ) );
 
     /**
@@ -225,6 +303,15 @@ public:
      */
     [[nodiscard]] constexpr int32_t getStrideInBytes( ) const;
 
+    /**
+     * Function that checks if every row starts on the boundary of the row
+     * alignment policy. This is true for all allocated images, but not
+     * necessarily for ROIs and images on external buffers.
+     *
+     * @returns True if the rows are aligned
+     */
+    [[nodiscard]] bool isRowAligned( ) const;
+
     /**
      * Accessor height
      *
@@ -252,7 +339,8 @@ public:
      * @param [in]  row       The row to access
      * @param [in]  channel   The channel to access
      *
-     * @returns the pointer to the row of the defined channel
+     * @returns the pointer to the row of the defined channel. The pixels of
+     * the channel are pixel_step elements apart.
      */
     [[nodiscard]] constexpr pointer_type
     getRowPointer( int32_t row, int32_t channel = 0 ) const;
@@ -305,6 +393,15 @@ public:
      */
     [[nodiscard]] Image clone( ) const;
 
+    /**
+     * Function that checks if the buffer of the image is referenced by other
+     * images, e.g. by shallow copies or ROIs. Images on memory they do not
+     * reference count, e.g. on a scratch arena, count as shared.
+     *
+     * @return True if writing to the image can change other images.
+     */
+    [[nodiscard]] bool isShared( ) const noexcept;
+
 private:
     /**
      * Function that swaps class members.
@@ -323,6 +420,14 @@ private:
      */
     [[nodiscard]] constexpr size_t numberElements( ) const;
 
+    /**
+     * Function that returns the number of elements of a row of a plane
+     * without padding.
+     *
+     * @return The number of elements
+     */
+    [[nodiscard]] constexpr int32_t rowElements( ) const;
+
     /**
      * Function that calculates the offset from the beginning of the buffer to
      * the defined position.
@@ -340,7 +445,7 @@ private:
     SizeI mSize { };
     pointer_type mData { nullptr };
     allocator_type mAllocator { };
-    memory_handle mMemoryHandle { nullptr };
+    memory_handle mMemoryHandle { };
 };
 
 //
@@ -351,18 +456,20 @@ private:
 // Construction
 //
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
     const Allocator& allocator ) noexcept
     : mAllocator( allocator )
 {
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
     int32_t width, int32_t height, bool zeroInitialize /* = false*/,
     const Allocator& allocator /*= Allocator( )*/ )
-    : mStride( alignTo( width, static_cast< int32_t >( width_alignment ) ) )
+    : mStride( calculateStride( width ) )
     , mSize( width, height )
     , mAllocator( allocator )
 {
@@ -374,19 +481,21 @@ Image< PixelType, Channels, Allocator >::Image(
     }
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
     const SizeI& size, bool zeroInitialize /* = false*/,
     const Allocator& allocator /*= Allocator( )*/ )
     : Image( size.getWidth( ), size.getHeight( ), zeroInitialize, allocator )
 {
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
     int32_t width, int32_t height, PixelType value,
     const Allocator& allocator /*= Allocator( )*/ )
-    : mStride( alignTo( width, static_cast< int32_t >( width_alignment ) ) )
+    : mStride( calculateStride( width ) )
     , mSize( width, height )
     , mAllocator( allocator )
 {
@@ -395,16 +504,18 @@ Image< PixelType, Channels, Allocator >::Image(
     std::fill_n( mData, numberElements( ), value );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
     const SizeI& size, PixelType value,
     const Allocator& allocator /*= Allocator( )*/ )
     : Image( size.getWidth( ), size.getHeight( ), value, allocator )
 {
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
     int32_t width, int32_t height, void* data, int32_t stride,
     const Allocator& allocator /*= Allocator( )*/ )
     : mStride( stride / static_cast< int32_t >( sizeof( PixelType ) ) )
@@ -414,8 +525,36 @@ Image< PixelType, Channels, Allocator >::Image(
 {
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image( const Image& other )
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
+    int32_t width, int32_t height, void* data, int32_t stride,
+    memory_handle memoryHandle, const Allocator& allocator /*= Allocator( )*/ )
+    : mStride( stride / static_cast< int32_t >( sizeof( PixelType ) ) )
+    , mSize( width, height )
+    , mData( static_cast< pointer_type >( data ) )
+    , mAllocator( allocator )
+    , mMemoryHandle( std::move( memoryHandle ) )
+{
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
+    int32_t width, int32_t height, void* data, int32_t stride,
+    ExternalImageBuffer::ReleaseCallback onRelease,
+    const Allocator& allocator /*= Allocator( )*/ )
+    : Image( width, height, data, stride,
+             memory_handle(
+                 ExternalImageBuffer::create( std::move( onRelease ) ) ),
+             allocator )
+{
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout,
+       Alignment >::Image( const Image& other )
     : mStride( other.mStride )
     , mSize( other.mSize )
     , mData( other.mData )
@@ -424,8 +563,10 @@ Image< PixelType, Channels, Allocator >::Image( const Image& other )
 {
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image( Image&& other ) noexcept
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout,
+       Alignment >::Image( Image&& other ) noexcept
     : mStride( other.mStride )
     , mSize( std::move( other.mSize ) )
     , mData( std::move( other.mData ) )
@@ -436,8 +577,9 @@ Image< PixelType, Channels, Allocator >::Image( Image&& other ) noexcept
     other.mData = nullptr;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >::Image(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::Image(
     const Image& other, const Rectangle< int32_t >& roi,
     const Allocator& allocator /*= Allocator( )*/ )
     : mStride( other.mStride )
@@ -445,19 +587,17 @@ Image< PixelType, Channels, Allocator >::Image(
     , mAllocator( allocator )
     , mMemoryHandle( other.mMemoryHandle )
 {
-    // Memory is organized in a monotonic buffer
-    // In case of a multichannel image the data is organized as follows:
-    // R G B R G B ...
-    // R G B R G B ...
-    // ...
+    // Memory is organized in a monotonic buffer. The organization of the
+    // channels is defined by the layout policy.
 
     // Since the pointer is a typed pointer we need to have the offset in normal
-    // offset, not in bytes. Otherwise, we move too far.
+    // offset, not in bytes. Otherwise, we move too far. For an interleaved
+    // image a pixel covers all channels.
     const auto typeStride = mStride;
     const auto left = roi.getLeft( );
     const auto top = roi.getTop( );
 
-    const auto offset = typeStride * top + left;
+    const auto offset = typeStride * top + left * pixel_step;
 
     mData = other.mData + offset;
 }
@@ -470,9 +610,10 @@ Image< PixelType, Channels, Allocator >::Image(
 // Operators
 //
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr Image< PixelType, Channels, Allocator >&
-Image< PixelType, Channels, Allocator >::operator=(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr Image< PixelType, Channels, Allocator, Layout, Alignment >&
+Image< PixelType, Channels, Allocator, Layout, Alignment >::operator=(
     const Image& other ) noexcept
 {
     if ( this != &other )
@@ -484,9 +625,11 @@ Image< PixelType, Channels, Allocator >::operator=(
     return *this;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr Image< PixelType, Channels, Allocator >&
-Image< PixelType, Channels, Allocator >::operator=( Image&& other ) noexcept
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr Image< PixelType, Channels, Allocator, Layout, Alignment >&
+Image< PixelType, Channels, Allocator, Layout, Alignment >::operator=(
+    Image&& other ) noexcept
 {
     if ( this != &other )
     {
@@ -515,8 +658,10 @@ Image< PixelType, Channels, Allocator >::operator=( Image&& other ) noexcept
     return *this;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr bool Image< PixelType, Channels, Allocator >::operator==(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr bool Image< PixelType, Channels, Allocator, Layout,
+                      Alignment >::operator==(
     const Image& other ) const noexcept
 {
     if ( this->mStride != other.mStride )
@@ -529,29 +674,52 @@ constexpr bool Image< PixelType, Channels, Allocator >::operator==(
         return false;
     }
 
-    if ( this->mData != nullptr && other.mData != nullptr )
+    if ( this->mData == nullptr || other.mData == nullptr )
+    {
+        return true;
+    }
+
+    // A single comparison is only possible for packed rows. The padding of
+    // padded rows is not initialized and not part of the image.
+    if ( mStride == rowElements( ) )
     {
-        if ( std::memcmp( this->mData,
-                          other.mData,
-                          numberElements( ) * sizeof( PixelType ) ) != 0 )
+        return std::memcmp( this->mData,
+                            other.mData,
+                            numberElements( ) * sizeof( PixelType ) ) == 0;
+    }
+
+    const auto dataSize =
+        static_cast< size_t >( rowElements( ) ) * sizeof( PixelType );
+
+    for ( int32_t plane = 0; plane < number_planes; plane++ )
+    {
+        for ( int32_t y = 0; y < mSize.getHeight( ); y++ )
         {
-            return false;
+            if ( std::memcmp( this->getRowPointer( y, plane ),
+                              other.getRowPointer( y, plane ),
+                              dataSize ) != 0 )
+            {
+                return false;
+            }
         }
     }
 
     return true;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr bool Image< PixelType, Channels, Allocator >::operator!=(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr bool Image< PixelType, Channels, Allocator, Layout,
+                      Alignment >::operator!=(
     const Image& other ) const noexcept
 {
     return ! operator==( other );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr Image< PixelType, Channels, Allocator >
-Image< PixelType, Channels, Allocator >::operator( )(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr Image< PixelType, Channels, Allocator, Layout, Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::operator( )(
     const Rectangle< int32_t >& roi ) const
 {
     return Image( *this, roi );
@@ -561,96 +729,145 @@ Image< PixelType, Channels, Allocator >::operator( )(
 // Methods
 //
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr int32_t Image< PixelType, Channels, Allocator >::getWidth( ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr int32_t
+Image< PixelType, Channels, Allocator, Layout, Alignment >::calculateStride(
+    int32_t width )
+{
+    return Alignment::template getStride< PixelType >(
+        Layout::template getRowElements< Channels >( width ) );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr int32_t
+Image< PixelType, Channels, Allocator, Layout, Alignment >::getWidth( ) const
 {
     return mSize.getWidth( );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr int32_t Image< PixelType, Channels, Allocator >::getStride( ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr int32_t
+Image< PixelType, Channels, Allocator, Layout, Alignment >::getStride( ) const
 {
     return mStride;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
 constexpr int32_t
-Image< PixelType, Channels, Allocator >::getStrideInBytes( ) const
+Image< PixelType, Channels, Allocator, Layout,
+       Alignment >::getStrideInBytes( ) const
 {
     return mStride * static_cast< int32_t >( sizeof( PixelType ) );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr int32_t Image< PixelType, Channels, Allocator >::getHeight( ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+bool Image< PixelType, Channels, Allocator, Layout, Alignment >::isRowAligned( )
+    const
+{
+    const auto strideInBytes = static_cast< size_t >( getStrideInBytes( ) );
+
+    return Alignment::isAligned( mData ) &&
+           strideInBytes % Alignment::bytes == 0;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr int32_t
+Image< PixelType, Channels, Allocator, Layout, Alignment >::getHeight( ) const
 {
     return mSize.getHeight( );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr SizeI Image< PixelType, Channels, Allocator >::getSize( ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr SizeI
+Image< PixelType, Channels, Allocator, Layout, Alignment >::getSize( ) const
 {
     return mSize;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr typename Image< PixelType, Channels, Allocator >::pointer_type
-Image< PixelType, Channels, Allocator >::getData( ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr typename Image< PixelType, Channels, Allocator, Layout,
+                          Alignment >::pointer_type
+Image< PixelType, Channels, Allocator, Layout, Alignment >::getData( ) const
 {
     return mData;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr typename Image< PixelType, Channels, Allocator >::pointer_type
-Image< PixelType, Channels, Allocator >::getRowPointer(
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr typename Image< PixelType, Channels, Allocator, Layout,
+                          Alignment >::pointer_type
+Image< PixelType, Channels, Allocator, Layout, Alignment >::getRowPointer(
     int32_t row, int32_t channel /*= 0*/ ) const
 {
     return mData + positionOffset( row, 0, channel );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr typename Image< PixelType, Channels, Allocator >::reference_type
-Image< PixelType, Channels, Allocator >::at( int32_t row, int32_t column,
-                                             int32_t channel /* = 0*/ )
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr typename Image< PixelType, Channels, Allocator, Layout,
+                          Alignment >::reference_type
+Image< PixelType, Channels, Allocator, Layout, Alignment >::at(
+    int32_t row, int32_t column, int32_t channel /* = 0*/ )
 {
     return mData[ static_cast< ptrdiff_t >(
         positionOffset( row, column, channel ) ) ];
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr typename Image< PixelType, Channels, Allocator >::const_reference_type
-Image< PixelType, Channels, Allocator >::at( int32_t row, int32_t column,
-                                             int32_t channel /* = 0*/ ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr typename Image< PixelType, Channels, Allocator, Layout,
+                          Alignment >::const_reference_type
+Image< PixelType, Channels, Allocator, Layout, Alignment >::at(
+    int32_t row, int32_t column, int32_t channel /* = 0*/ ) const
 {
     return mData[ static_cast< ptrdiff_t >(
         positionOffset( row, column, channel ) ) ];
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr typename Image< PixelType, Channels, Allocator >::allocator_type
-Image< PixelType, Channels, Allocator >::getAllocator( ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr typename Image< PixelType, Channels, Allocator, Layout,
+                          Alignment >::allocator_type
+Image< PixelType, Channels, Allocator, Layout, Alignment >::getAllocator( )
+    const
 {
     return mAllocator;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-void Image< PixelType, Channels, Allocator >::copyTo( Image& other ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+void Image< PixelType, Channels, Allocator, Layout, Alignment >::copyTo(
+    Image& other ) const
 {
     if ( other.mSize != mSize )
     {
         other = Image( mSize, false, mAllocator );
     }
 
-    if ( other.mStride != mStride )
+    // A single copy is only possible for packed rows. Padded rows may belong
+    // to a ROI, the padding of the last row is not part of its buffer.
+    if ( other.mStride != mStride || mStride != rowElements( ) )
     {
-        for ( int32_t c = 0; c < Channels; c++ )
+        // Only the pixels of a row are copied, not the padding. A row of an
+        // interleaved image holds all channels, so one row per plane is
+        // copied.
+        const auto dataSize =
+            static_cast< size_t >( rowElements( ) ) * sizeof( PixelType );
+
+        for ( int32_t plane = 0; plane < number_planes; plane++ )
         {
             for ( int32_t y = 0; y < mSize.getHeight( ); y++ )
             {
-                const auto dataSize =
-                    static_cast< size_t >( other.getStrideInBytes( ) );
-
-                const auto srcPtr = this->getRowPointer( y, c );
-                const auto dstPtr = other.getRowPointer( y, c );
+                const auto srcPtr = this->getRowPointer( y, plane );
+                const auto dstPtr = other.getRowPointer( y, plane );
 
                 std::memcpy( dstPtr, srcPtr, dataSize );
             }
@@ -663,11 +880,12 @@ void Image< PixelType, Channels, Allocator >::copyTo( Image& other ) const
     }
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-Image< PixelType, Channels, Allocator >
-Image< PixelType, Channels, Allocator >::clone( ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >::clone( ) const
 {
-    Image< PixelType, Channels, Allocator > image(
+    Image< PixelType, Channels, Allocator, Layout, Alignment > image(
         this->getSize( ), false, mAllocator );
 
     this->copyTo( image );
@@ -675,12 +893,22 @@ Image< PixelType, Channels, Allocator >::clone( ) const
     return image;
 }
 
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+bool Image< PixelType, Channels, Allocator, Layout, Alignment >::isShared( )
+    const noexcept
+{
+    return ! mMemoryHandle || mMemoryHandle.get( )->getReferenceCount( ) > 1;
+}
+
 //
 // Private methods
 //
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-void Image< PixelType, Channels, Allocator >::swap( Image& other ) noexcept
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+void Image< PixelType, Channels, Allocator, Layout, Alignment >::swap(
+    Image& other ) noexcept
 {
     std::swap( this->mStride, other.mStride );
     std::swap( this->mSize, other.mSize );
@@ -692,50 +920,48 @@ void Image< PixelType, Channels, Allocator >::swap( Image& other ) noexcept
     this->mAllocator = tmp;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr void Image< PixelType, Channels, Allocator >::allocate( )
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr void Image< PixelType, Channels, Allocator, Layout,
+                      Alignment >::allocate( )
 {
     // Note: The allocator is pixel type dependent. We need to pass a stride in
     // PixelType, not in bytes.
-    const auto elements = numberElements( );
-    mData = allocator_traits::allocate( mAllocator, elements );
-
-    // Get a copy of the allocator.
-    // The object is destroyed, if the calls gets destructed and so the lambda
-    // will not work
-    auto allocator = mAllocator;
-    auto data = mData;
+    // The reference counted header and the pixels share one allocation. The
+    // header keeps a copy of the allocator to deallocate the buffer.
+    auto* buffer = AllocatedImageBuffer< Allocator >::create(
+        mAllocator, numberElements( ), Alignment::bytes );
 
-    // Use mutable for lambda to not have the captured values const.
-    // Tha allocator cannot be const for the call
-    // https://en.cppreference.com/w/cpp/language/lambda
-    mMemoryHandle = std::make_shared< Handle >(
-        [ elements, allocator, data ]( ) mutable
-        { allocator_traits::deallocate( allocator, data, elements ); } );
+    mData = buffer->getData( );
+    mMemoryHandle = memory_handle( buffer );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
 constexpr size_t
-Image< PixelType, Channels, Allocator >::numberElements( ) const
+Image< PixelType, Channels, Allocator, Layout,
+       Alignment >::numberElements( ) const
 {
-    return static_cast< size_t >( getStride( ) ) * getHeight( ) * Channels;
+    return static_cast< size_t >( getStride( ) ) * getHeight( ) *
+           number_planes;
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-constexpr size_t Image< PixelType, Channels, Allocator >::positionOffset(
-    int32_t row, int32_t column, int32_t channel ) const
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr int32_t
+Image< PixelType, Channels, Allocator, Layout, Alignment >::rowElements( ) const
 {
-    // Store multi channel image in planes
-    // c1 c1 c1
-    // c1 c1 c1
-    // c2 c2 c2
-    // c2 c2 c2
-    // c3 c3 c3
-    // c3 c3 c3
-    const auto channelOffset = getStride( ) * getHeight( ) * channel;
+    return Layout::template getRowElements< Channels >( getWidth( ) );
+}
 
-    return channelOffset + getStride( ) * static_cast< size_t >( row ) +
-           static_cast< size_t >( column );
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+constexpr size_t
+Image< PixelType, Channels, Allocator, Layout, Alignment >::positionOffset(
+    int32_t row, int32_t column, int32_t channel ) const
+{
+    return Layout::template getOffset< Channels >(
+        getStride( ), getHeight( ), row, column, channel );
 }
 
-} // namespace cvl::core
\ No newline at end of file
+} // namespace cvl::core
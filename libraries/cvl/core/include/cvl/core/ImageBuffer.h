@@ -0,0 +1,409 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace cvl::core
+{
+
+/**
+ * @brief The ImageBuffer class
+ *
+ * The intrusive, reference counted header of an image buffer. All copies and
+ * ROIs of an image reference the same header. Copying or destroying an image
+ * only increments or decrements the atomic reference count. If the last
+ * reference is removed, the release function of the header is called, which
+ * frees the header and the buffer.
+ *
+ * The header does not know how the buffer was allocated. Derived classes
+ * store what is required to release it and pass a matching release function.
+ */
+class ImageBuffer
+{
+public:
+    /**
+     * The function that is called if the last reference is removed
+     */
+    using ReleaseFunction = void ( * )( ImageBuffer* buffer );
+
+    CVT_DISABLE_COPY( ImageBuffer );
+    CVT_DISABLE_MOVE( ImageBuffer );
+
+    /**
+     * Function that adds a reference to the buffer
+     */
+    void addReference( ) noexcept
+    {
+        mReferences.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    /**
+     * Function that removes a reference from the buffer. The buffer is
+     * released if it was the last reference.
+     */
+    void removeReference( ) noexcept
+    {
+        if ( mReferences.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        {
+            mRelease( this );
+        }
+    }
+
+    /**
+     * Accessor reference count
+     *
+     * @returns The number of references to the buffer
+     */
+    [[nodiscard]] int32_t getReferenceCount( ) const noexcept
+    {
+        return mReferences.load( std::memory_order_relaxed );
+    }
+
+protected:
+    /**
+     * Value constructor
+     *
+     * @param [in]  release     The function that releases the buffer. The
+     *                          function is called with this header.
+     */
+    explicit ImageBuffer( ReleaseFunction release ) noexcept
+        : mRelease( release )
+    {
+    }
+
+    ~ImageBuffer( ) = default;
+
+private:
+    std::atomic< int32_t > mReferences { 0 };
+    ReleaseFunction mRelease { };
+};
+
+/**
+ * @brief The ImageBufferPointer class
+ *
+ * A smart pointer holding one reference to an image buffer. In contrast to a
+ * std::shared_ptr no separate control block is allocated, the reference count
+ * is part of the buffer header.
+ */
+class ImageBufferPointer
+{
+public:
+    /**
+     * Default constructor
+     */
+    ImageBufferPointer( ) noexcept = default;
+
+    /**
+     * Value constructor
+     *
+     * @param [in]  buffer  The buffer to reference. A reference is added.
+     */
+    explicit ImageBufferPointer( ImageBuffer* buffer ) noexcept
+        : mBuffer( buffer )
+    {
+        if ( mBuffer != nullptr )
+        {
+            mBuffer->addReference( );
+        }
+    }
+
+    /**
+     * Copy constructor
+     *
+     * @param [in]  other   The pointer to copy. A reference is added.
+     */
+    ImageBufferPointer( const ImageBufferPointer& other ) noexcept
+        : ImageBufferPointer( other.mBuffer )
+    {
+    }
+
+    /**
+     * Move constructor
+     *
+     * @param [in]  other   The pointer to take the reference from
+     */
+    ImageBufferPointer( ImageBufferPointer&& other ) noexcept
+        : mBuffer( std::exchange( other.mBuffer, nullptr ) )
+    {
+    }
+
+    /**
+     * Destructor
+     */
+    ~ImageBufferPointer( )
+    {
+        reset( );
+    }
+
+    /**
+     * Assignment operator
+     *
+     * @param [in]  other   The pointer to assign from
+     */
+    ImageBufferPointer& operator=( const ImageBufferPointer& other ) noexcept
+    {
+        ImageBufferPointer( other ).swap( *this );
+        return *this;
+    }
+
+    /**
+     * Move operator
+     *
+     * @param [in]  other   The pointer to take the reference from
+     */
+    ImageBufferPointer& operator=( ImageBufferPointer&& other ) noexcept
+    {
+        ImageBufferPointer( std::move( other ) ).swap( *this );
+        return *this;
+    }
+
+    /**
+     * Function that removes the reference
+     */
+    void reset( ) noexcept
+    {
+        if ( mBuffer != nullptr )
+        {
+            std::exchange( mBuffer, nullptr )->removeReference( );
+        }
+    }
+
+    /**
+     * Function that swaps two pointers
+     *
+     * @param [in]  other   The pointer to swap with
+     */
+    void swap( ImageBufferPointer& other ) noexcept
+    {
+        std::swap( mBuffer, other.mBuffer );
+    }
+
+    /**
+     * Accessor buffer
+     *
+     * @returns The referenced buffer
+     */
+    [[nodiscard]] ImageBuffer* get( ) const noexcept
+    {
+        return mBuffer;
+    }
+
+    /**
+     * Function that checks if a buffer is referenced
+     */
+    explicit operator bool( ) const noexcept
+    {
+        return mBuffer != nullptr;
+    }
+
+private:
+    ImageBuffer* mBuffer { nullptr };
+};
+
+/**
+ * @brief The AllocatedImageBuffer class
+ *
+ * An image buffer allocated by an allocator. The header and the pixels share
+ * one allocation. The header is placed in front of the pixels and padded to
+ * the header alignment, so the pixels keep the alignment of the allocation up
+ * to 64 bytes. If a larger data alignment is requested than the allocation
+ * provides, the pixels are moved to the next boundary.
+ *
+ * | header | padding | pixels ... |
+ */
+template < typename Allocator >
+class AllocatedImageBuffer final : public ImageBuffer
+{
+public:
+    using allocator_traits = std::allocator_traits< Allocator >;
+    using value_type = typename allocator_traits::value_type;
+    using pointer_type = value_type*;
+
+    CVT_DISABLE_COPY( AllocatedImageBuffer );
+    CVT_DISABLE_MOVE( AllocatedImageBuffer );
+
+    /**
+     * Function that allocates a buffer
+     *
+     * @param [in]  allocator       The allocator for the buffer. A copy is
+     *                              kept to deallocate the buffer.
+     * @param [in]  elements        The number of elements of the pixel data.
+     * @param [in]  dataAlignment   The alignment of the pixel data in bytes.
+     *                              Must be a power of two.
+     *
+     * @returns The buffer without references
+     */
+    [[nodiscard]] static AllocatedImageBuffer*
+    create( const Allocator& allocator, size_t elements,
+            size_t dataAlignment = 1 )
+    {
+        auto bufferAllocator = allocator;
+
+        // Elements to move the pixels to the next boundary
+        const auto alignmentElements =
+            dataAlignment > getGuaranteedAlignment( )
+                ? ( dataAlignment + sizeof( value_type ) - 1 ) /
+                      sizeof( value_type )
+                : size_t { 0 };
+
+        const auto allocatedElements =
+            elements + getHeaderElements( ) + alignmentElements;
+
+        auto* memory =
+            allocator_traits::allocate( bufferAllocator, allocatedElements );
+
+        auto address = reinterpret_cast< std::uintptr_t >(
+            memory + getHeaderElements( ) );
+        address = ( address + dataAlignment - 1 ) & ~( dataAlignment - 1 );
+
+        return ::new ( static_cast< void* >( memory ) )
+            AllocatedImageBuffer( bufferAllocator,
+                                  allocatedElements,
+                                  reinterpret_cast< pointer_type >( address ) );
+    }
+
+    /**
+     * Accessor data
+     *
+     * @returns The pointer to the first pixel behind the header
+     */
+    [[nodiscard]] pointer_type getData( ) noexcept
+    {
+        return mData;
+    }
+
+private:
+    static constexpr size_t headerAlignment = 64;
+
+    AllocatedImageBuffer( const Allocator& allocator, size_t elements,
+                          pointer_type data )
+        : ImageBuffer( &AllocatedImageBuffer::release )
+        , mAllocator( allocator )
+        , mElements( elements )
+        , mData( data )
+    {
+    }
+
+    ~AllocatedImageBuffer( ) = default;
+
+    static constexpr size_t getHeaderElements( )
+    {
+        static_assert( headerAlignment % sizeof( value_type ) == 0,
+                       "Pixel size must divide the header alignment" );
+
+        const auto headerBytes =
+            ( sizeof( AllocatedImageBuffer ) + headerAlignment - 1 ) /
+            headerAlignment * headerAlignment;
+
+        return headerBytes / sizeof( value_type );
+    }
+
+    /*
+     * The alignment of the pixels without moving them. Allocators that do not
+     * report their alignment only guarantee the alignment of the type.
+     */
+    static constexpr size_t getGuaranteedAlignment( )
+    {
+        if constexpr ( requires { Allocator::alignment( ); } )
+        {
+            return std::min< size_t >( Allocator::alignment( ),
+                                       headerAlignment );
+        }
+        else
+        {
+            return alignof( value_type );
+        }
+    }
+
+    static void release( ImageBuffer* buffer )
+    {
+        auto* self = static_cast< AllocatedImageBuffer* >( buffer );
+
+        // The allocator must survive the header it is stored in
+        auto allocator = self->mAllocator;
+        const auto elements = self->mElements;
+
+        self->~AllocatedImageBuffer( );
+
+        allocator_traits::deallocate(
+            allocator, reinterpret_cast< pointer_type >( self ), elements );
+    }
+
+private:
+    Allocator mAllocator;
+    size_t mElements { };
+    pointer_type mData { };
+};
+
+/**
+ * @brief The ExternalImageBuffer class
+ *
+ * The header of a buffer owned by someone else, e.g. a camera SDK. The pixels
+ * are not allocated nor freed by the header. The release callback is called
+ * exactly once, when the last image or ROI referencing the buffer is
+ * destroyed. The owner can reuse the buffer afterwards, e.g. requeue it to
+ * the driver.
+ *
+ * The callback is called from the thread that removes the last reference and
+ * must not throw.
+ */
+class ExternalImageBuffer final : public ImageBuffer
+{
+public:
+    using ReleaseCallback = std::function< void( ) >;
+
+    CVT_DISABLE_COPY( ExternalImageBuffer );
+    CVT_DISABLE_MOVE( ExternalImageBuffer );
+
+    /**
+     * Function that creates the header of an external buffer
+     *
+     * @param [in]  onRelease   The function called when the buffer is not
+     *                          referenced anymore.
+     *
+     * @returns The buffer without references
+     */
+    [[nodiscard]] static ExternalImageBuffer*
+    create( ReleaseCallback onRelease )
+    {
+        return new ExternalImageBuffer( std::move( onRelease ) );
+    }
+
+private:
+    explicit ExternalImageBuffer( ReleaseCallback onRelease )
+        : ImageBuffer( &ExternalImageBuffer::release )
+        , mOnRelease( std::move( onRelease ) )
+    {
+    }
+
+    ~ExternalImageBuffer( ) = default;
+
+    static void release( ImageBuffer* buffer )
+    {
+        auto* self = static_cast< ExternalImageBuffer* >( buffer );
+
+        // The header is gone before the owner gets the buffer back
+        auto onRelease = std::move( self->mOnRelease );
+        delete self;
+
+        if ( onRelease )
+        {
+            onRelease( );
+        }
+    }
+
+private:
+    ReleaseCallback mOnRelease;
+};
+
+} // namespace cvl::core
@@ -0,0 +1,328 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/AlignedAllocator.h>
+#include <cvl/core/Alignment.h>
+#include <cvl/core/ChannelLayout.h>
+#include <cvl/core/Image.h>
+#include <cvl/core/ImageBuffer.h>
+#include <cvl/core/RowAlignment.h>
+#include <cvl/core/Size.h>
+#include <cvl/core/Types.h>
+#include <cvl/core/export.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+namespace cvl::core
+{
+
+/**
+ * @brief The ImagePool class
+ *
+ * A pool of image buffers. The images handed out by the pool return their
+ * buffer to the pool when the last copy or ROI of the image is destroyed,
+ * instead of deallocating it. The next image of the same pixel type, channel
+ * count, allocator, channel layout, row alignment and size reuses the
+ * buffer. In a steady state, e.g. one image per frame, no image buffer is
+ * allocated anymore.
+ *
+ * Stateless allocators are pooled by their type. Polymorphic allocators are
+ * pooled by their memory resource, so images never get the buffer of another
+ * resource. Other stateful allocators are not supported.
+ *
+ * The number of bytes kept in the pool is limited by a cap. Buffers that are
+ * returned while the cap is reached are deallocated. Images may outlive the
+ * pool, their buffers are deallocated when they are released.
+ *
+ * The pool is thread safe. Images can be acquired and released concurrently.
+ *
+ * E.g.:
+ *
+ * ImagePool pool;
+ * pool.reserve< uint8_t, 1 >( SizeI( 1024, 1024 ), 4 );
+ *
+ * auto image = pool.acquire< uint8_t, 1 >( SizeI( 1024, 1024 ) );
+ */
+class CVL_CORE_EXPORT ImagePool
+{
+public:
+    /**
+     * No limit for the cached bytes
+     */
+    static constexpr size_t unlimited = std::numeric_limits< size_t >::max( );
+
+    CVT_DISABLE_COPY( ImagePool );
+    CVT_DISABLE_MOVE( ImagePool );
+
+    /**
+     * Value constructor
+     *
+     * @param [in]  maxCachedBytes  The maximum number of bytes of the buffers
+     *                              kept in the pool.
+     */
+    explicit ImagePool( size_t maxCachedBytes = unlimited );
+
+    /**
+     * Destructor
+     *
+     * Deallocates the cached buffers. The buffers of images still alive are
+     * deallocated when the images are released.
+     */
+    ~ImagePool( );
+
+    /**
+     * Function that hands out an image. A cached buffer is reused if
+     * available, otherwise a new buffer is allocated.
+     *
+     * @param [in]  size            The size of the image.
+     * @param [in]  zeroInitialize  Flag that signals if the buffer should be
+     *                              initialized.
+     * @param [in]  allocator       The allocator used for new buffers.
+     *
+     * @returns The image
+     */
+    template < Arithmetic PixelType, int32_t Channels,
+               typename Allocator = AlignedAllocator< PixelType >,
+               ChannelLayout Layout = PlanarLayout,
+               RowAlignmentPolicy Alignment = PackedRows >
+    [[nodiscard]] Image< PixelType, Channels, Allocator, Layout, Alignment >
+    acquire( const SizeI& size, bool zeroInitialize = false,
+             const Allocator& allocator = Allocator( ) );
+
+    /**
+     * Function that pre-warms the pool. Afterwards at least the given number
+     * of buffers is cached for the image type and size, as long as the cap is
+     * not reached.
+     *
+     * @param [in]  size            The size of the images.
+     * @param [in]  numberBuffers   The number of buffers.
+     * @param [in]  allocator       The allocator used for new buffers.
+     */
+    template < Arithmetic PixelType, int32_t Channels,
+               typename Allocator = AlignedAllocator< PixelType >,
+               ChannelLayout Layout = PlanarLayout,
+               RowAlignmentPolicy Alignment = PackedRows >
+    void reserve( const SizeI& size, size_t numberBuffers,
+                  const Allocator& allocator = Allocator( ) );
+
+    /**
+     * Function that deallocates all cached buffers
+     */
+    void clear( );
+
+    /**
+     * Accessor cap
+     *
+     * @returns The maximum number of bytes kept in the pool
+     */
+    [[nodiscard]] size_t getMaxCachedBytes( ) const;
+
+    /**
+     * Accessor cached bytes
+     *
+     * @returns The number of bytes of the cached buffers
+     */
+    [[nodiscard]] size_t getCachedBytes( ) const;
+
+    /**
+     * Accessor number of cached buffers
+     *
+     * @returns The number of buffers that are ready for reuse
+     */
+    [[nodiscard]] size_t getNumberCachedBuffers( ) const;
+
+    /**
+     * Accessor number of allocations
+     *
+     * @returns The number of buffers allocated by the pool so far
+     */
+    [[nodiscard]] size_t getNumberAllocations( ) const;
+
+private:
+    struct State;
+
+    struct Key
+    {
+        std::type_index type;
+        SizeI size;
+
+        // The memory resource of polymorphic allocators
+        const void* resource { };
+
+        bool operator<( const Key& other ) const;
+    };
+
+    /*
+     * The header of a pooled buffer. The pixels are kept in a buffer of the
+     * allocator of the image, which deallocates them with the header.
+     */
+    struct Buffer : public ImageBuffer
+    {
+        CVT_DISABLE_COPY( Buffer );
+        CVT_DISABLE_MOVE( Buffer );
+
+        Buffer( const Key& bufferKey, ImageBufferPointer bufferStorage,
+                void* bufferData, size_t bufferBytes )
+            : ImageBuffer( &ImagePool::releaseBuffer )
+            , key( bufferKey )
+            , storage( std::move( bufferStorage ) )
+            , data( bufferData )
+            , bytes( bufferBytes )
+        {
+        }
+
+        ~Buffer( ) = default;
+
+        Key key;
+        ImageBufferPointer storage;
+        void* data { };
+        size_t bytes { };
+
+        // Set while the buffer is used by an image
+        std::shared_ptr< State > state;
+    };
+
+    /**
+     * Function that takes a cached buffer out of the pool.
+     *
+     * @param [in]  key     The key of the buffer.
+     *
+     * @returns The buffer or nullptr if no buffer is cached
+     */
+    Buffer* takeBuffer( const Key& key );
+
+    /**
+     * Function that adds a newly allocated buffer to the pool.
+     *
+     * @param [in]  buffer  The buffer.
+     *
+     * @returns The buffer, owned by the caller until it is released
+     */
+    Buffer* addBuffer( std::unique_ptr< Buffer > buffer );
+
+    /**
+     * Function that returns a buffer to the pool it belongs to. It is called
+     * when the last image referencing the buffer is destroyed.
+     *
+     * @param [in]  buffer  The buffer.
+     */
+    static void releaseBuffer( ImageBuffer* buffer );
+
+    template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+               ChannelLayout Layout, RowAlignmentPolicy Alignment >
+    [[nodiscard]] static Key createKey( const SizeI& size,
+                                        const Allocator& allocator );
+
+private:
+    std::shared_ptr< State > mState;
+};
+
+//
+// Template implementations
+//
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+Image< PixelType, Channels, Allocator, Layout, Alignment >
+ImagePool::acquire( const SizeI& size, bool zeroInitialize /* = false*/,
+                    const Allocator& allocator /*= Allocator( )*/ )
+{
+    EXPECT_MSG( size.getWidth( ) >= 0 && size.getHeight( ) >= 0,
+                "Invalid image size(" << size << ")" );
+
+    using ImageType =
+        Image< PixelType, Channels, Allocator, Layout, Alignment >;
+
+    // Same row layout as the Image constructors
+    const auto stride = ImageType::calculateStride( size.getWidth( ) );
+    const auto elements = static_cast< size_t >( stride ) * size.getHeight( ) *
+                          ImageType::number_planes;
+
+    const auto key =
+        createKey< PixelType, Channels, Allocator, Layout, Alignment >(
+            size, allocator );
+    auto* buffer = takeBuffer( key );
+
+    if ( buffer == nullptr )
+    {
+        // The same layout as the buffers of the Image constructors
+        auto* storage = AllocatedImageBuffer< Allocator >::create(
+            allocator, elements, Alignment::bytes );
+
+        buffer = addBuffer(
+            std::make_unique< Buffer >( key,
+                                        ImageBufferPointer( storage ),
+                                        storage->getData( ),
+                                        elements * sizeof( PixelType ) ) );
+    }
+
+    if ( zeroInitialize )
+    {
+        std::memset( buffer->data, 0x00, buffer->bytes );
+    }
+
+    return ImageType(
+        size.getWidth( ),
+        size.getHeight( ),
+        buffer->data,
+        stride * static_cast< int32_t >( sizeof( PixelType ) ),
+        ImageBufferPointer( buffer ),
+        allocator );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+void ImagePool::reserve( const SizeI& size, size_t numberBuffers,
+                         const Allocator& allocator /*= Allocator( )*/ )
+{
+    // Acquiring takes the cached buffers first, so releasing all images
+    // leaves at least the requested number of buffers in the pool
+    std::vector< Image< PixelType, Channels, Allocator, Layout, Alignment > >
+        images;
+    images.reserve( numberBuffers );
+
+    for ( size_t i = 0; i < numberBuffers; i++ )
+    {
+        images.push_back(
+            acquire< PixelType, Channels, Allocator, Layout, Alignment >(
+                size, false, allocator ) );
+    }
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+ImagePool::Key
+ImagePool::createKey( const SizeI& size,
+                      [[maybe_unused]] const Allocator& allocator )
+{
+    using ImageType =
+        Image< PixelType, Channels, Allocator, Layout, Alignment >;
+
+    if constexpr ( std::is_same_v< Allocator,
+                                   std::pmr::polymorphic_allocator<
+                                       typename Allocator::value_type > > )
+    {
+        return Key { std::type_index( typeid( ImageType ) ),
+                     size,
+                     allocator.resource( ) };
+    }
+    else
+    {
+        static_assert(
+            std::allocator_traits< Allocator >::is_always_equal::value,
+            "Only stateless and polymorphic allocators can be pooled" );
+
+        return Key { std::type_index( typeid( ImageType ) ), size };
+    }
+}
+
+} // namespace cvl::core
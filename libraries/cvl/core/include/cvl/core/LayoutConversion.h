@@ -0,0 +1,207 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/ChannelLayout.h>
+#include <cvl/core/CpuFeatures.h>
+#include <cvl/core/Image.h>
+#include <cvl/core/Types.h>
+#include <cvl/core/export.h>
+
+// STD includes
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace cvl::core
+{
+
+namespace detail
+{
+
+/**
+ * Function that interleaves the rows of the channels into one row. This is
+ * the scalar reference implementation for all pixel types.
+ *
+ * @param [in]   srcPtrs    The input rows, one per channel
+ * @param [out]  dstPtr     The interleaved output row
+ * @param [in]   width      The number of pixels of the row
+ * @param [in]   channels   The number of channels
+ */
+template < Arithmetic PixelType >
+void interleaveRowScalar( const PixelType* const* srcPtrs, PixelType* dstPtr,
+                          int32_t width, int32_t channels )
+{
+    for ( int32_t x = 0; x < width; x++ )
+    {
+        for ( int32_t c = 0; c < channels; c++ )
+        {
+            dstPtr[ x * channels + c ] = srcPtrs[ c ][ x ];
+        }
+    }
+}
+
+/**
+ * Function that splits an interleaved row into one row per channel. This is
+ * the scalar reference implementation for all pixel types.
+ *
+ * @param [in]   srcPtr     The interleaved input row
+ * @param [out]  dstPtrs    The output rows, one per channel
+ * @param [in]   width      The number of pixels of the row
+ * @param [in]   channels   The number of channels
+ */
+template < Arithmetic PixelType >
+void deinterleaveRowScalar( const PixelType* srcPtr, PixelType* const* dstPtrs,
+                            int32_t width, int32_t channels )
+{
+    for ( int32_t x = 0; x < width; x++ )
+    {
+        for ( int32_t c = 0; c < channels; c++ )
+        {
+            dstPtrs[ c ][ x ] = srcPtr[ x * channels + c ];
+        }
+    }
+}
+
+/**
+ * Functions that convert a single row between the planar and the interleaved
+ * layout using a SIMD instruction set. Two, three and four channels are
+ * vectorized, other channel counts use the scalar implementation. The result
+ * is bit-identical to the scalar implementation for every level.
+ *
+ * @param [in]   srcPtr(s)  The input row(s)
+ * @param [out]  dstPtr(s)  The output row(s)
+ * @param [in]   width      The number of pixels of the row
+ * @param [in]   channels   The number of channels
+ * @param [in]   level      The SIMD level to use. Must be supported by the
+ *                          CPU.
+ */
+CVL_CORE_EXPORT
+void interleaveRow( const uint8_t* const* srcPtrs, uint8_t* dstPtr,
+                    int32_t width, int32_t channels, SimdLevel level );
+
+CVL_CORE_EXPORT
+void deinterleaveRow( const uint8_t* srcPtr, uint8_t* const* dstPtrs,
+                      int32_t width, int32_t channels, SimdLevel level );
+
+/**
+ * @brief Trait for pixel types with SIMD layout conversion kernels
+ */
+template < typename PixelType >
+constexpr bool hasLayoutKernel = std::is_same_v< PixelType, uint8_t >;
+
+} // namespace detail
+
+/**
+ * Function that converts a planar image into an interleaved image
+ *
+ * @param [in]   imageIn    The planar input image
+ * @param [out]  imageOut   The interleaved output image. The image is
+ *                          reallocated if the size does not match.
+ *
+ * For uint8_t images, SIMD kernels are selected at runtime from the CPU
+ * features.
+ */
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           RowAlignmentPolicy Alignment >
+void interleave(
+    const Image< PixelType, Channels, Allocator, PlanarLayout, Alignment >&
+        imageIn,
+    Image< PixelType, Channels, Allocator, InterleavedLayout, Alignment >&
+        imageOut )
+{
+    if ( imageOut.getSize( ) != imageIn.getSize( ) )
+    {
+        using ImageOut = Image< PixelType, Channels, Allocator,
+                                InterleavedLayout, Alignment >;
+
+        imageOut =
+            ImageOut( imageIn.getSize( ), false, imageIn.getAllocator( ) );
+    }
+
+    [[maybe_unused]] const auto simdLevel = getSimdLevel( );
+
+    std::array< const PixelType*, Channels > srcPtrs { };
+
+    for ( int32_t y = 0; y < imageIn.getHeight( ); y++ )
+    {
+        for ( int32_t c = 0; c < Channels; c++ )
+        {
+            srcPtrs[ static_cast< size_t >( c ) ] =
+                imageIn.getRowPointer( y, c );
+        }
+
+        const auto dstPtr = imageOut.getRowPointer( y );
+
+        if constexpr ( detail::hasLayoutKernel< PixelType > )
+        {
+            detail::interleaveRow( srcPtrs.data( ),
+                                   dstPtr,
+                                   imageIn.getWidth( ),
+                                   Channels,
+                                   simdLevel );
+        }
+        else
+        {
+            detail::interleaveRowScalar(
+                srcPtrs.data( ), dstPtr, imageIn.getWidth( ), Channels );
+        }
+    }
+}
+
+/**
+ * Function that converts an interleaved image into a planar image
+ *
+ * @param [in]   imageIn    The interleaved input image
+ * @param [out]  imageOut   The planar output image. The image is reallocated
+ *                          if the size does not match.
+ *
+ * For uint8_t images, SIMD kernels are selected at runtime from the CPU
+ * features.
+ */
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           RowAlignmentPolicy Alignment >
+void deinterleave(
+    const Image< PixelType, Channels, Allocator, InterleavedLayout, Alignment >&
+        imageIn,
+    Image< PixelType, Channels, Allocator, PlanarLayout, Alignment >& imageOut )
+{
+    if ( imageOut.getSize( ) != imageIn.getSize( ) )
+    {
+        using ImageOut =
+            Image< PixelType, Channels, Allocator, PlanarLayout, Alignment >;
+
+        imageOut =
+            ImageOut( imageIn.getSize( ), false, imageIn.getAllocator( ) );
+    }
+
+    [[maybe_unused]] const auto simdLevel = getSimdLevel( );
+
+    std::array< PixelType*, Channels > dstPtrs { };
+
+    for ( int32_t y = 0; y < imageIn.getHeight( ); y++ )
+    {
+        for ( int32_t c = 0; c < Channels; c++ )
+        {
+            dstPtrs[ static_cast< size_t >( c ) ] =
+                imageOut.getRowPointer( y, c );
+        }
+
+        const auto srcPtr = imageIn.getRowPointer( y );
+
+        if constexpr ( detail::hasLayoutKernel< PixelType > )
+        {
+            detail::deinterleaveRow( srcPtr,
+                                     dstPtrs.data( ),
+                                     imageIn.getWidth( ),
+                                     Channels,
+                                     simdLevel );
+        }
+        else
+        {
+            detail::deinterleaveRowScalar(
+                srcPtr, dstPtrs.data( ), imageIn.getWidth( ), Channels );
+        }
+    }
+}
+
+} // namespace cvl::core
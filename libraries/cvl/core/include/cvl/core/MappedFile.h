@@ -0,0 +1,86 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/Handle.h>
+#include <cvl/core/export.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace cvl::core
+{
+
+/**
+ * The expected access pattern of a mapped file. The operating system uses it
+ * to decide how many pages are read ahead on a page fault.
+ */
+enum class MappedAccess
+{
+    Normal,     ///< Default read ahead
+    Sequential, ///< Aggressive read ahead, e.g. replaying full frames
+    Random      ///< No read ahead, e.g. reading small ROIs
+};
+
+DECLARE_SMARTPTR( MappedFile );
+
+/**
+ * @brief The MappedFile class
+ *
+ * A file mapped into memory. Pages are read from the file on first access,
+ * so only the touched parts of the file are loaded. The mapping is private,
+ * writing to it does not change the file.
+ *
+ * The mapping is released by a Handle when the object is destroyed.
+ */
+class CVL_CORE_EXPORT MappedFile
+{
+public:
+    CVT_DISABLE_COPY( MappedFile );
+    CVT_DISABLE_MOVE( MappedFile );
+
+    /**
+     * Value constructor
+     *
+     * @param [in]  path    The path of the file.
+     * @param [in]  access  The expected access pattern.
+     */
+    explicit MappedFile( const std::string& path,
+                         MappedAccess access = MappedAccess::Normal );
+
+    /**
+     * Destructor
+     */
+    ~MappedFile( ) = default;
+
+    /**
+     * Function that sets the expected access pattern of the whole file.
+     *
+     * @param [in]  access  The expected access pattern.
+     */
+    void advise( MappedAccess access );
+
+    /**
+     * Accessor data
+     *
+     * @returns The pointer to the first byte of the file
+     */
+    [[nodiscard]] uint8_t* getData( ) const;
+
+    /**
+     * Accessor size
+     *
+     * @returns The size of the file in bytes
+     */
+    [[nodiscard]] size_t getSize( ) const;
+
+private:
+    uint8_t* mData { };
+    size_t mSize { };
+    Handle mHandle;
+};
+
+} // namespace cvl::core
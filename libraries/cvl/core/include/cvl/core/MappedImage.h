@@ -0,0 +1,308 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/ChannelLayout.h>
+#include <cvl/core/Image.h>
+#include <cvl/core/MappedFile.h>
+#include <cvl/core/Size.h>
+#include <cvl/core/Types.h>
+#include <cvl/core/export.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace cvl::core
+{
+
+/**
+ * The formats of image files that can be mapped into memory
+ */
+enum class ImageFileFormat
+{
+    Raw, ///< Pixels only, the layout is given by the caller
+    Pgm, ///< Binary portable graymap (P5), 8 bit
+    Ppm, ///< Binary portable pixmap (P6), 8 bit interleaved RGB
+    Cvl  ///< Pixels behind a CvlImageHeader
+};
+
+/**
+ * The kind of the elements of an image
+ */
+enum class ElementKind : uint32_t
+{
+    Unsigned,
+    Signed,
+    Float
+};
+
+/**
+ * Function that returns the element kind of a pixel type
+ */
+template < Arithmetic PixelType >
+constexpr ElementKind getElementKind( )
+{
+    if constexpr ( std::is_floating_point_v< PixelType > )
+    {
+        return ElementKind::Float;
+    }
+    else if constexpr ( std::is_signed_v< PixelType > )
+    {
+        return ElementKind::Signed;
+    }
+    else
+    {
+        return ElementKind::Unsigned;
+    }
+}
+
+/**
+ * @brief The CvlImageHeader struct
+ *
+ * The header of the cvl image file format. The header is stored in the byte
+ * order of the machine, followed by the pixels at the data offset. The rows
+ * of all planes are stored one after another with the same stride.
+ */
+struct CvlImageHeader
+{
+    static constexpr uint32_t magic_number = 0x494C5643; // "CVLI"
+    static constexpr uint32_t current_version = 1;
+
+    uint32_t magic { magic_number };
+    uint32_t version { current_version };
+    int32_t width { };
+    int32_t height { };
+    int32_t channels { };
+    uint32_t elementSize { };
+    ElementKind elementKind { };
+    uint32_t interleaved { };
+    uint64_t stride { };
+    uint64_t dataOffset { };
+    uint8_t reserved[ 16 ] { };
+};
+
+// The pixels behind the header keep the alignment of every pixel type
+static_assert( sizeof( CvlImageHeader ) == 64 );
+
+/**
+ * @brief The ImageFileInfo struct
+ *
+ * The description of the pixels of an image file
+ */
+struct ImageFileInfo
+{
+    ImageFileFormat format { ImageFileFormat::Raw };
+    SizeI size;
+    int32_t channels { 1 };
+    size_t elementSize { 1 };
+    ElementKind elementKind { ElementKind::Unsigned };
+    bool interleaved { };
+    size_t stride { };     ///< The step size of each row in bytes
+    size_t dataOffset { }; ///< The offset of the first pixel in bytes
+};
+
+/**
+ * Function that reads the header of a mapped PGM, PPM or cvl image file.
+ *
+ * @param [in]  file    The mapped file.
+ *
+ * @returns The description of the pixels
+ */
+CVL_CORE_EXPORT ImageFileInfo readImageFileInfo( const MappedFile& file );
+
+namespace detail
+{
+template < Arithmetic PixelType, int32_t Channels, ChannelLayout Layout >
+Image< PixelType, Channels, AlignedAllocator< PixelType >, Layout >
+mapImage( MappedFileSharedPtr file, const ImageFileInfo& info )
+{
+    using ImageType =
+        Image< PixelType, Channels, AlignedAllocator< PixelType >, Layout >;
+
+    const auto width = static_cast< size_t >( info.size.getWidth( ) );
+    const auto height = static_cast< size_t >( info.size.getHeight( ) );
+    const auto rowBytes = width * sizeof( PixelType ) *
+                          static_cast< size_t >( ImageType::pixel_step );
+    const auto rows =
+        height * static_cast< size_t >( ImageType::number_planes );
+
+    const auto validStride = info.stride >= rowBytes &&
+                             info.stride % sizeof( PixelType ) == 0 &&
+                             info.stride <=
+                                 std::numeric_limits< int32_t >::max( );
+
+    EXPECT_MSG( validStride, "Invalid stride(" << info.stride << ")" );
+
+    const auto dataSize =
+        rows == 0 ? size_t { } : ( rows - 1 ) * info.stride + rowBytes;
+    const auto fileSize = file->getSize( );
+
+    // The offset is read from the file, the sum with the data size could
+    // overflow
+    EXPECT_MSG( info.dataOffset <= fileSize &&
+                    dataSize <= fileSize - info.dataOffset,
+                "File size(" << fileSize << ") too small for the image" );
+
+    auto* data = file->getData( ) + info.dataOffset;
+    const auto address = reinterpret_cast< uintptr_t >( data );
+
+    EXPECT_MSG( address % alignof( PixelType ) == 0,
+                "Data offset(" << info.dataOffset
+                               << ") not aligned to the pixel type" );
+
+    // The image keeps the mapping alive, it is unmapped with the last copy or
+    // ROI of the image
+    return ImageType( info.size.getWidth( ),
+                      info.size.getHeight( ),
+                      data,
+                      static_cast< int32_t >( info.stride ),
+                      [ file ]( ) mutable { file.reset( ); } );
+}
+} // namespace detail
+
+/**
+ * Function that maps a PGM, PPM or cvl image file into an image. No pixel is
+ * read on mapping, the pages of the file are loaded on first access. A ROI
+ * only loads the pages it touches.
+ *
+ * The mapping is private, modifying the image does not change the file. The
+ * file is unmapped when the last copy or ROI of the image is destroyed.
+ *
+ * @param [in]  path    The path of the file.
+ * @param [in]  access  The expected access pattern.
+ *
+ * @returns The image
+ *
+ * The pixel type, the number of channels and the layout must match the file.
+ * The channels of a PPM file are interleaved.
+ */
+template < Arithmetic PixelType, int32_t Channels,
+           ChannelLayout Layout = PlanarLayout >
+Image< PixelType, Channels, AlignedAllocator< PixelType >, Layout >
+mapImageFile( const std::string& path,
+              MappedAccess access = MappedAccess::Normal )
+{
+    auto file = std::make_shared< MappedFile >( path, access );
+    const auto info = readImageFileInfo( *file );
+
+    EXPECT_MSG( info.channels == Channels,
+                "Channels(" << info.channels << ") of file(" << path
+                            << ") do not match the image" );
+
+    EXPECT_MSG( info.elementSize == sizeof( PixelType ) &&
+                    info.elementKind == getElementKind< PixelType >( ),
+                "Pixel type of file(" << path << ") does not match the image" );
+
+    constexpr auto interleaved = std::is_same_v< Layout, InterleavedLayout >;
+
+    EXPECT_MSG( Channels == 1 || info.interleaved == interleaved,
+                "Channel layout of file(" << path
+                                          << ") does not match the image" );
+
+    return detail::mapImage< PixelType, Channels, Layout >( std::move( file ),
+                                                            info );
+}
+
+/**
+ * Function that maps a raw image file into an image.
+ *
+ * @param [in]  path        The path of the file.
+ * @param [in]  size        The size of the image.
+ * @param [in]  dataOffset  The offset of the first pixel in bytes.
+ * @param [in]  stride      The step size of each row in bytes. 0 for packed
+ *                          rows.
+ * @param [in]  access      The expected access pattern.
+ *
+ * @returns The image
+ */
+template < Arithmetic PixelType, int32_t Channels,
+           ChannelLayout Layout = PlanarLayout >
+Image< PixelType, Channels, AlignedAllocator< PixelType >, Layout >
+mapRawImageFile( const std::string& path, const SizeI& size,
+                 size_t dataOffset = 0, size_t stride = 0,
+                 MappedAccess access = MappedAccess::Normal )
+{
+    EXPECT_MSG( size.getWidth( ) >= 0 && size.getHeight( ) >= 0,
+                "Invalid image size(" << size << ")" );
+
+    ImageFileInfo info;
+    info.size = size;
+    info.channels = Channels;
+    info.elementSize = sizeof( PixelType );
+    info.elementKind = getElementKind< PixelType >( );
+    info.interleaved = std::is_same_v< Layout, InterleavedLayout >;
+    info.dataOffset = dataOffset;
+    info.stride = stride;
+
+    if ( stride == 0 )
+    {
+        const auto rowElements =
+            Layout::template getRowElements< Channels >( size.getWidth( ) );
+
+        info.stride =
+            static_cast< size_t >( rowElements ) * sizeof( PixelType );
+    }
+
+    return detail::mapImage< PixelType, Channels, Layout >(
+        std::make_shared< MappedFile >( path, access ), info );
+}
+
+/**
+ * Function that writes an image to a cvl image file. The rows are written
+ * without padding.
+ *
+ * @param [in]  path    The path of the file.
+ * @param [in]  image   The image to write.
+ */
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment >
+void writeCvlImageFile(
+    const std::string& path,
+    const Image< PixelType, Channels, Allocator, Layout, Alignment >& image )
+{
+    using ImageType =
+        Image< PixelType, Channels, Allocator, Layout, Alignment >;
+
+    const auto rowElements =
+        Layout::template getRowElements< Channels >( image.getWidth( ) );
+    const auto rowBytes =
+        static_cast< size_t >( rowElements ) * sizeof( PixelType );
+
+    CvlImageHeader header;
+    header.width = image.getWidth( );
+    header.height = image.getHeight( );
+    header.channels = Channels;
+    header.elementSize = sizeof( PixelType );
+    header.elementKind = getElementKind< PixelType >( );
+    header.interleaved = std::is_same_v< Layout, InterleavedLayout > ? 1 : 0;
+    header.stride = rowBytes;
+    header.dataOffset = sizeof( CvlImageHeader );
+
+    std::ofstream stream( path, std::ios::binary | std::ios::trunc );
+
+    EXPECT_MSG( stream.is_open( ), "Cannot open file(" << path << ")" );
+
+    stream.write( reinterpret_cast< const char* >( &header ),
+                  sizeof( header ) );
+
+    for ( int32_t plane = 0; plane < ImageType::number_planes; plane++ )
+    {
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            const auto rowPtr = image.getRowPointer( y, plane );
+
+            stream.write( reinterpret_cast< const char* >( rowPtr ),
+                          static_cast< std::streamsize >( rowBytes ) );
+        }
+    }
+
+    EXPECT_MSG( stream.good( ), "Cannot write file(" << path << ")" );
+}
+
+} // namespace cvl::core
@@ -0,0 +1,104 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/export.h>
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+
+namespace cvl::core
+{
+
+/**
+ * The use of huge pages for an allocation. Huge pages reduce the TLB misses
+ * of large images, e.g. on column access or on strided ROIs.
+ */
+enum class HugePages
+{
+    None,        ///< Pages of the default size
+    Transparent, ///< Hint the kernel to back the memory with huge pages
+    Explicit     ///< Reserved huge pages, normal pages if none are reserved
+};
+
+/**
+ * @brief The PageOptions struct
+ *
+ * The options of an allocation taken directly from the operating system
+ */
+struct PageOptions
+{
+    HugePages hugePages { HugePages::None };
+    int32_t node { -1 }; ///< The NUMA node to bind the memory to, -1 for none
+    bool parallelFirstTouch { }; ///< Touch the pages with all threads
+};
+
+namespace detail
+{
+/**
+ * Function that allocates memory directly from the operating system. The
+ * memory is zero initialized.
+ *
+ * @param [in]  bytes       The size of the allocation in bytes.
+ * @param [in]  alignment   The alignment in bytes. Must not exceed the page
+ *                          size.
+ * @param [in]  options     The options of the allocation.
+ *
+ * @returns The pointer to the memory
+ *
+ * Throws std::bad_alloc if the memory cannot be allocated.
+ */
+CVL_CORE_EXPORT void* allocatePages( size_t bytes, size_t alignment,
+                                     const PageOptions& options );
+
+/**
+ * Function that releases memory allocated by allocatePages.
+ *
+ * @param [in]  p       The pointer to the memory.
+ * @param [in]  bytes   The size of the allocation in bytes.
+ * @param [in]  options The options of the allocation.
+ */
+CVL_CORE_EXPORT void deallocatePages( void* p, size_t bytes,
+                                      const PageOptions& options );
+} // namespace detail
+
+/**
+ * @brief The PageMemory struct
+ *
+ * Memory policy of the AlignedAllocator that takes the memory directly from
+ * the operating system. E.g.:
+ *
+ * using Allocator =
+ *     AlignedAllocator< uint8_t, 64, PageMemory< HugePages::Explicit, 0 > >;
+ *
+ * Image< uint8_t, 1, Allocator > image( 8192, 8192 );
+ *
+ * The hints are dropped silently where the system does not support them, the
+ * memory is still valid. Each allocation takes at least one page, the policy
+ * is made for large images.
+ *
+ * @tparam Pages                The use of huge pages.
+ * @tparam Node                 The NUMA node to bind the memory to, -1 for
+ *                              none.
+ * @tparam ParallelFirstTouch   Touch the pages with all threads, so the
+ *                              first touch policy of the system spreads the
+ *                              pages over the nodes of the threads.
+ */
+template < HugePages Pages = HugePages::Transparent, int32_t Node = -1,
+           bool ParallelFirstTouch = false >
+struct PageMemory
+{
+    static constexpr PageOptions options { Pages, Node, ParallelFirstTouch };
+
+    static void* allocate( size_t bytes, size_t alignment )
+    {
+        return detail::allocatePages( bytes, alignment, options );
+    }
+
+    static void deallocate( void* p, size_t bytes )
+    {
+        detail::deallocatePages( p, bytes, options );
+    }
+};
+
+} // namespace cvl::core
@@ -0,0 +1,150 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/export.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+IGNORE_WARNINGS_STD_PUSH
+#include <mutex>
+#include <thread>
+IGNORE_WARNINGS_POP
+
+namespace cvl::core
+{
+
+/**
+ * Function that resolves the number of threads to use.
+ *
+ * @param [in]  numberThreads   The requested number of threads. 0 selects
+ *                              the number of hardware threads.
+ *
+ * @return The number of threads, at least 1.
+ */
+inline int32_t getNumberThreads( int32_t numberThreads = 0 )
+{
+    if ( numberThreads > 0 )
+    {
+        return numberThreads;
+    }
+
+    return std::max( static_cast< int32_t >(
+                         std::thread::hardware_concurrency( ) ),
+                     1 );
+}
+
+/**
+ * @brief The ThreadPool class
+ *
+ * The persistent workers of parallelFor. The workers are created on first use
+ * and the pool grows to the largest number of workers requested.
+ */
+class CVL_CORE_EXPORT ThreadPool final
+{
+public:
+    ThreadPool( ) = delete;
+
+    /**
+     * Function that runs a task on the calling thread and on workers of the
+     * pool. Returns when every started worker finished the task. While the
+     * pool runs the task of another thread, the task runs on the calling
+     * thread only.
+     *
+     * @param [in]  task            The task. Must not throw.
+     * @param [in]  context         The argument of the task.
+     * @param [in]  numberWorkers   The number of workers besides the calling
+     *                              thread.
+     */
+    static void run( void ( *task )( void* ), void* context,
+                     int32_t numberWorkers );
+
+    /**
+     * Function that checks if the calling thread runs a task of the pool.
+     * Nested parallel loops run on the calling thread.
+     *
+     * @return True inside of a task, else false.
+     */
+    [[nodiscard]] static bool isInsideTask( );
+};
+
+/**
+ * Function that calls a function for every index of a range in parallel.
+ * The indices are distributed dynamically to the threads of a persistent
+ * pool, so thread local caches of the workers survive between calls. The
+ * calling thread takes part in the work. Nested calls run serially on the
+ * calling thread. If a call throws, the remaining indices are still
+ * processed and the first exception is rethrown after all threads finished.
+ *
+ * E.g.:
+ *
+ * parallelFor( 0, numberStrips, [ & ]( int32_t strip ) { ... } );
+ *
+ * @param [in]  begin           The first index.
+ * @param [in]  end             The index behind the last index.
+ * @param [in]  function        The function called with each index.
+ * @param [in]  numberThreads   The maximum number of threads. 0 selects the
+ *                              number of hardware threads.
+ */
+template < typename Function >
+void parallelFor( int32_t begin, int32_t end, const Function& function,
+                  int32_t numberThreads = 0 )
+{
+    if ( end <= begin )
+    {
+        return;
+    }
+
+    const auto threads =
+        std::min( getNumberThreads( numberThreads ), end - begin );
+
+    if ( threads == 1 || ThreadPool::isInsideTask( ) )
+    {
+        for ( auto i = begin; i < end; i++ )
+        {
+            function( i );
+        }
+
+        return;
+    }
+
+    std::atomic< int32_t > next { begin };
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [ & ]( )
+    {
+        for ( auto i = next++; i < end; i = next++ )
+        {
+            try
+            {
+                function( i );
+            }
+            catch ( ... )
+            {
+                std::lock_guard< std::mutex > lock( errorMutex );
+
+                if ( ! error )
+                {
+                    error = std::current_exception( );
+                }
+            }
+        }
+    };
+
+    ThreadPool::run(
+        [ ]( void* context )
+        { ( *static_cast< decltype( worker )* >( context ) )( ); },
+        &worker,
+        threads - 1 );
+
+    if ( error )
+    {
+        std::rethrow_exception( error );
+    }
+}
+
+} // namespace cvl::core
@@ -6,6 +6,7 @@
 #include <cvl/core/Types.h>
 
 // STD includes
+#include <utility>
 
 namespace cvl::core
 {
@@ -77,7 +78,8 @@ public:
      * Copy constructor
      *
      * @brief The copy constructor creates a shallow copy of the region and the
-     * underlying image. No memory is copied.
+     * underlying image. No memory is copied. The values of the region features
+     * are copied.
      *
      * @param other The region to copy from
      */
@@ -169,7 +171,8 @@ Region< PixelType, Allocator, RegionFeature... >::Region(
 template < Arithmetic PixelType, typename Allocator,
            template < typename > typename... RegionFeature >
 Region< PixelType, Allocator, RegionFeature... >::Region( const Region& other )
-    : mLabelNumber( other.mLabelNumber )
+    : RegionFeature< Region >( other )...
+    , mLabelNumber( other.mLabelNumber )
     , mLabelImage( other.mLabelImage )
 {
 }
@@ -178,7 +181,8 @@ template < Arithmetic PixelType, typename Allocator,
            template < typename > typename... RegionFeature >
 Region< PixelType, Allocator, RegionFeature... >::Region(
     Region&& other ) noexcept
-    : mLabelNumber( other.mLabelNumber )
+    : RegionFeature< Region >( std::move( other ) )...
+    , mLabelNumber( other.mLabelNumber )
     , mLabelImage( std::move( other.mLabelImage ) )
 {
 }
@@ -214,6 +218,10 @@ Region< PixelType, Allocator, RegionFeature... >::operator=(
 {
     if ( this != &other )
     {
+        ( ( static_cast< RegionFeature< Region >& >( *this ) =
+                std::move( static_cast< RegionFeature< Region >& >( other ) ) ),
+          ... );
+
         this->mLabelNumber = other.mLabelNumber;
         this->mLabelImage = std::move( other.mLabelImage );
     }
@@ -249,6 +257,10 @@ template < Arithmetic PixelType, typename Allocator,
 void Region< PixelType, Allocator, RegionFeature... >::swap(
     Region& other ) noexcept
 {
+    ( std::swap( static_cast< RegionFeature< Region >& >( *this ),
+                 static_cast< RegionFeature< Region >& >( other ) ),
+      ... );
+
     std::swap( this->mLabelImage, other.mLabelImage );
     std::swap( this->mLabelNumber, other.mLabelNumber );
 }
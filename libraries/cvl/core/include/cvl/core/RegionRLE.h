@@ -0,0 +1,366 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/Image.h>
+#include <cvl/core/Point.h>
+#include <cvl/core/Rectangle.h>
+#include <cvl/core/Region.h>
+#include <cvl/core/Size.h>
+#include <cvl/core/export.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cvl::core
+{
+
+/**
+ * @brief A horizontal run of foreground pixels
+ *
+ * The run covers the columns colStart to colEnd of a row. Both columns are
+ * part of the run.
+ */
+struct Run
+{
+    int32_t row { };
+    int32_t colStart { };
+    int32_t colEnd { };
+
+    [[nodiscard]] constexpr int32_t getLength( ) const
+    {
+        return colEnd - colStart + 1;
+    }
+
+    constexpr bool operator==( const Run& other ) const = default;
+};
+
+/**
+ * @brief The raw moments of a region up to the second order
+ */
+struct RegionMoments
+{
+    double m00 { };
+    double m10 { };
+    double m01 { };
+    double m20 { };
+    double m11 { };
+    double m02 { };
+};
+
+/**
+ * @brief The RegionRLE class
+ *
+ * A run length encoded region. In contrast to the Region class, that
+ * references a label image of the full frame, the RegionRLE class only stores
+ * the foreground runs. The runs are sorted by row and column and do not
+ * overlap. Queries like area, bounding box or moments are proportional to the
+ * number of runs instead of the number of pixels.
+ *
+ * The size of the image the region originates from is kept, so that the
+ * region can be converted back to a label image.
+ */
+class CVL_CORE_EXPORT RegionRLE final : public IRegion
+{
+public:
+    /**
+     * Default constructor
+     */
+    RegionRLE( ) = default;
+
+    /**
+     * Value constructor
+     *
+     * @brief The constructor creates an empty region for an image size.
+     *
+     * @param imageSize     The size of the image the region belongs to.
+     */
+    explicit RegionRLE( const SizeI& imageSize );
+
+    /**
+     * Value constructor
+     *
+     * @brief The constructor creates a region from already sorted runs.
+     *
+     * @param imageSize     The size of the image the region belongs to.
+     * @param runs          The runs sorted by row and column.
+     */
+    RegionRLE( const SizeI& imageSize, std::vector< Run > runs );
+
+    /**
+     * Copy constructor
+     *
+     * @param other The region to copy from
+     */
+    RegionRLE( const RegionRLE& other );
+
+    /**
+     * Move constructor
+     *
+     * @param [in]  other     The region to move
+     */
+    RegionRLE( RegionRLE&& other ) noexcept;
+
+    /**
+     * Assignment operator
+     *
+     * @param [in]  other     The region to assign from
+     */
+    RegionRLE& operator=( const RegionRLE& other );
+
+    /**
+     * Move operator
+     *
+     * @param [in]  other  The region to move from
+     */
+    RegionRLE& operator=( RegionRLE&& other ) noexcept;
+
+    /**
+     * Destructor
+     */
+    ~RegionRLE( ) override = default;
+
+    /**
+     * Equal operator
+     *
+     * @param [in]  other  The region to compare
+     */
+    bool operator==( const RegionRLE& other ) const;
+
+    /**
+     * Function that creates a run length encoded region from a label image.
+     * All pixels with the label number are part of the region.
+     *
+     * @param [in]  labelImage    The label image.
+     * @param [in]  labelNumber   The label number.
+     *
+     * @return The run length encoded region.
+     */
+    template < Arithmetic PixelType, typename Allocator >
+    static RegionRLE
+    fromLabelImage( const Image< PixelType, 1, Allocator >& labelImage,
+                    int32_t labelNumber );
+
+    /**
+     * Function that creates a run length encoded region from a region.
+     *
+     * @param [in]  region    The region to encode.
+     *
+     * @return The run length encoded region.
+     */
+    template < Arithmetic PixelType, typename Allocator,
+               template < typename > typename... RegionFeature >
+    static RegionRLE fromRegion(
+        const Region< PixelType, Allocator, RegionFeature... >& region );
+
+    /**
+     * Function that creates a label image of the image size containing the
+     * region.
+     *
+     * @param [in]  labelNumber   The value of the foreground pixels.
+     * @param [in]  allocator     The allocator object to be used.
+     *
+     * @return The label image.
+     */
+    template < Arithmetic PixelType,
+               typename Allocator = AlignedAllocator< PixelType > >
+    [[nodiscard]] Image< PixelType, 1, Allocator >
+    toLabelImage( PixelType labelNumber,
+                  const Allocator& allocator = Allocator( ) ) const;
+
+    /**
+     * Function that writes the region into an existing label image. Pixels
+     * outside of the region are not changed.
+     *
+     * @param [in]  labelImage    The label image to write to.
+     * @param [in]  labelNumber   The value of the foreground pixels.
+     */
+    template < Arithmetic PixelType, typename Allocator >
+    void paint( const Image< PixelType, 1, Allocator >& labelImage,
+                PixelType labelNumber ) const;
+
+    /**
+     * Function that appends a run. The run must be located behind the last
+     * run of the region.
+     *
+     * @param [in]  row         The row of the run.
+     * @param [in]  colStart    The first column of the run.
+     * @param [in]  colEnd      The last column of the run.
+     */
+    void addRun( int32_t row, int32_t colStart, int32_t colEnd );
+
+    /**
+     * Function that reserves memory for runs.
+     *
+     * @param [in]  numberRuns    The number of runs.
+     */
+    void reserve( size_t numberRuns );
+
+    /**
+     * Function that removes all runs.
+     */
+    void clear( );
+
+    /**
+     * Accessor runs
+     *
+     * @returns The sorted runs of the region
+     */
+    [[nodiscard]] const std::vector< Run >& getRuns( ) const;
+
+    /**
+     * Accessor number of runs
+     *
+     * @returns The number of runs
+     */
+    [[nodiscard]] size_t getNumberRuns( ) const;
+
+    /**
+     * Accessor image size
+     *
+     * @returns The size of the image the region belongs to
+     */
+    [[nodiscard]] SizeI getImageSize( ) const;
+
+    /**
+     * Function that sets the size of the image the region belongs to.
+     *
+     * @param [in]  imageSize   The image size.
+     */
+    void setImageSize( const SizeI& imageSize );
+
+    /**
+     * Function that checks if the region does not contain any pixel.
+     *
+     * @returns True if empty, else false
+     */
+    [[nodiscard]] bool isEmpty( ) const;
+
+    /**
+     * Function that checks if a pixel is part of the region. The runs are
+     * searched with a binary search.
+     *
+     * @param [in]  row       The row of the pixel.
+     * @param [in]  column    The column of the pixel.
+     *
+     * @returns True if the pixel is part of the region, else false
+     */
+    [[nodiscard]] bool contains( int32_t row, int32_t column ) const;
+
+    /**
+     * Function that calculates the number of pixels of the region.
+     *
+     * @returns The area of the region
+     */
+    [[nodiscard]] int64_t getArea( ) const;
+
+    /**
+     * Function that calculates the bounding box of the region.
+     *
+     * @returns The bounding box of the region
+     */
+    [[nodiscard]] Rectangle< int32_t > getBoundingBox( ) const;
+
+    /**
+     * Function that calculates the center of gravity of the region.
+     *
+     * @returns The center of the region
+     */
+    [[nodiscard]] Point2d getCenter( ) const;
+
+    /**
+     * Function that calculates the raw moments of the region up to the second
+     * order. The sums over the columns of a run are calculated in closed form.
+     *
+     * @returns The raw moments of the region
+     */
+    [[nodiscard]] RegionMoments getMoments( ) const;
+
+private:
+    SizeI mImageSize { };
+    std::vector< Run > mRuns;
+};
+
+//
+// Template implementations
+//
+
+template < Arithmetic PixelType, typename Allocator >
+RegionRLE
+RegionRLE::fromLabelImage( const Image< PixelType, 1, Allocator >& labelImage,
+                           int32_t labelNumber )
+{
+    RegionRLE region( labelImage.getSize( ) );
+
+    const auto label = static_cast< PixelType >( labelNumber );
+    const auto width = labelImage.getWidth( );
+    const auto height = labelImage.getHeight( );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        const auto rowPtr = labelImage.getRowPointer( y );
+
+        int32_t x = 0;
+        while ( x < width )
+        {
+            if ( rowPtr[ x ] != label )
+            {
+                x++;
+                continue;
+            }
+
+            const auto colStart = x;
+
+            while ( x < width && rowPtr[ x ] == label )
+            {
+                x++;
+            }
+
+            region.mRuns.push_back( { y, colStart, x - 1 } );
+        }
+    }
+
+    return region;
+}
+
+template < Arithmetic PixelType, typename Allocator,
+           template < typename > typename... RegionFeature >
+RegionRLE RegionRLE::fromRegion(
+    const Region< PixelType, Allocator, RegionFeature... >& region )
+{
+    return fromLabelImage( region.getLabelImage( ), region.getLabelNumber( ) );
+}
+
+template < Arithmetic PixelType, typename Allocator >
+Image< PixelType, 1, Allocator >
+RegionRLE::toLabelImage( PixelType labelNumber,
+                         const Allocator& allocator /*= Allocator( )*/ ) const
+{
+    Image< PixelType, 1, Allocator > labelImage( mImageSize, true, allocator );
+
+    paint( labelImage, labelNumber );
+
+    return labelImage;
+}
+
+template < Arithmetic PixelType, typename Allocator >
+void RegionRLE::paint( const Image< PixelType, 1, Allocator >& labelImage,
+                       PixelType labelNumber ) const
+{
+    EXPECT_MSG( labelImage.getSize( ) == mImageSize,
+                "Label image size(" << labelImage.getSize( )
+                                    << ") does not match region image size("
+                                    << mImageSize << ")" );
+
+    for ( const auto& run : mRuns )
+    {
+        const auto rowPtr = labelImage.getRowPointer( run.row );
+
+        std::fill(
+            rowPtr + run.colStart, rowPtr + run.colEnd + 1, labelNumber );
+    }
+}
+
+} // namespace cvl::core
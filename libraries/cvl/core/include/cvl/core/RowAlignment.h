@@ -0,0 +1,88 @@
+#pragma once
+
+// STD includes
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace cvl::core
+{
+
+/**
+ * The default row alignment of an image in bytes
+ */
+constexpr std::size_t width_alignment = 1;
+
+/**
+ * @brief The row alignment policy of an image
+ *
+ * Each row of an image starts on a multiple of Bytes. The stride is padded
+ * accordingly and the buffer is allocated on the boundary. The padding is
+ * part of the buffer, so a vector load of up to Bytes that is aligned and
+ * contains at least one pixel of a row stays inside the buffer. Kernels can
+ * process the tail of a row with a full vector instead of scalar code.
+ *
+ * The padding is not initialized and not copied.
+ */
+template < std::size_t Bytes >
+struct RowAlignment
+{
+    static_assert( Bytes > 0 && ( Bytes & ( Bytes - 1 ) ) == 0,
+                   "The row alignment must be a power of two" );
+
+    static constexpr std::size_t bytes = Bytes;
+
+    /**
+     * Function that calculates the stride of an image row.
+     *
+     * @param [in]  rowElements     The number of elements of a row.
+     *
+     * @return The stride in elements
+     */
+    template < typename PixelType >
+    static constexpr int32_t getStride( int32_t rowElements )
+    {
+        constexpr auto alignment = static_cast< int32_t >(
+            std::max< std::size_t >( Bytes / sizeof( PixelType ), 1 ) );
+
+        return ( rowElements + alignment - 1 ) / alignment * alignment;
+    }
+
+    /**
+     * Function that checks if a pointer is aligned to the policy.
+     *
+     * @param [in]  data    The pointer.
+     */
+    static bool isAligned( const void* data )
+    {
+        return reinterpret_cast< std::uintptr_t >( data ) % Bytes == 0;
+    }
+};
+
+/**
+ * The rows are packed, no alignment is applied
+ */
+using PackedRows = RowAlignment< width_alignment >;
+
+/**
+ * The rows start on an AVX2 register boundary
+ */
+using Avx2Rows = RowAlignment< 32 >;
+
+/**
+ * The rows start on a cache line and AVX-512 register boundary
+ */
+using Avx512Rows = RowAlignment< 64 >;
+
+/**
+ * @brief Concept of a row alignment policy of an image
+ */
+template < typename Alignment >
+concept RowAlignmentPolicy = requires( int32_t value, const void* data ) {
+    { Alignment::bytes } -> std::convertible_to< std::size_t >;
+    Alignment::template getStride< uint8_t >( value );
+    Alignment::isAligned( data );
+};
+
+} // namespace cvl::core
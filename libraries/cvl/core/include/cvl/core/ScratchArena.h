@@ -0,0 +1,187 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/Image.h>
+#include <cvl/core/Size.h>
+#include <cvl/core/export.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace cvl::core
+{
+
+/**
+ * @brief The ScratchArena class
+ *
+ * A monotonic memory resource for temporaries, e.g. the intermediate image of
+ * a separable filter. Allocating moves a pointer, deallocating does nothing.
+ * The memory is given back by a Scope, which rewinds the arena to the state
+ * of its construction.
+ *
+ * In contrast to std::pmr::monotonic_buffer_resource the blocks are kept when
+ * the arena is rewound. If the outermost scope needed more than one block,
+ * the blocks are merged into one, so after the first run of a loop every
+ * further run allocates nothing from the upstream resource. E.g.:
+ *
+ * auto& arena = ScratchArena::getThreadArena( );
+ * ScratchArena::Scope scope( arena );
+ *
+ * auto image = arena.createImage< Image< float, 1 > >( size );
+ *
+ * The arena is not thread safe. Each thread has its own arena, returned by
+ * getThreadArena. The workers of parallelFor are persistent, so their arenas
+ * keep the blocks between parallel loops.
+ */
+class CVL_CORE_EXPORT ScratchArena final : public std::pmr::memory_resource
+{
+public:
+    /**
+     * @brief The Scope class
+     *
+     * Rewinds the arena on destruction. Everything allocated from the arena
+     * during the lifetime of the scope must not be used afterwards. Scopes
+     * can be nested.
+     */
+    class CVL_CORE_EXPORT Scope
+    {
+    public:
+        CVT_DISABLE_COPY( Scope );
+        CVT_DISABLE_MOVE( Scope );
+
+        explicit Scope( ScratchArena& arena );
+
+        ~Scope( );
+
+    private:
+        ScratchArena& mArena;
+        size_t mBlock { };
+        size_t mOffset { };
+    };
+
+    CVT_DISABLE_COPY( ScratchArena );
+    CVT_DISABLE_MOVE( ScratchArena );
+
+    /**
+     * Value constructor
+     *
+     * @param [in]  blockSize   The size of the first block in bytes. The
+     *                          block is allocated on first use.
+     * @param [in]  upstream    The resource the blocks are allocated from.
+     */
+    explicit ScratchArena( size_t blockSize = size_t { 1 } << 20,
+                           std::pmr::memory_resource* upstream =
+                               std::pmr::get_default_resource( ) );
+
+    /**
+     * Destructor
+     */
+    ~ScratchArena( ) override;
+
+    /**
+     * Function that returns the arena of the calling thread
+     */
+    [[nodiscard]] static ScratchArena& getThreadArena( );
+
+    /**
+     * Function that creates an image on the memory of the arena. The pixels
+     * are not initialized. The image does not own the memory, neither the
+     * image nor its copies may outlive the current scope.
+     *
+     * @param [in]  size    The size of the image.
+     *
+     * @returns The image
+     */
+    template < typename ImageType >
+    [[nodiscard]] ImageType createImage( const SizeI& size );
+
+    /**
+     * Function that gives back all memory and keeps the blocks. Must not be
+     * called inside a scope.
+     */
+    void reset( );
+
+    /**
+     * Function that frees all blocks. Must not be called inside a scope.
+     */
+    void release( );
+
+    /**
+     * Accessor capacity
+     *
+     * @returns The size of all blocks in bytes
+     */
+    [[nodiscard]] size_t getCapacity( ) const noexcept;
+
+    /**
+     * Accessor used bytes
+     *
+     * @returns The bytes in use including the alignment padding
+     */
+    [[nodiscard]] size_t getUsed( ) const noexcept;
+
+    /**
+     * Accessor upstream allocations
+     *
+     * The number of blocks allocated from the upstream resource since the
+     * construction. Tests use it to assert that a steady state loop does not
+     * allocate.
+     *
+     * @returns The number of allocations
+     */
+    [[nodiscard]] size_t getUpstreamAllocations( ) const noexcept;
+
+private:
+    struct Block
+    {
+        std::byte* data { };
+        size_t size { };
+    };
+
+    void* do_allocate( size_t bytes, size_t alignment ) override;
+
+    void do_deallocate( void* p, size_t bytes, size_t alignment ) override;
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other ) const noexcept override;
+
+    void rewind( size_t block, size_t offset );
+
+    void mergeBlocks( );
+
+    std::pmr::memory_resource* mUpstream { };
+    std::vector< Block > mBlocks;
+    size_t mBlockSize { };
+    size_t mBlock { };
+    size_t mOffset { };
+    int32_t mScopeDepth { };
+    size_t mUpstreamAllocations { };
+};
+
+template < typename ImageType >
+ImageType ScratchArena::createImage( const SizeI& size )
+{
+    using PixelType = typename ImageType::value_type;
+
+    const auto stride = ImageType::calculateStride( size.getWidth( ) );
+    const auto bytes = static_cast< size_t >( stride ) *
+                       static_cast< size_t >( size.getHeight( ) ) *
+                       static_cast< size_t >( ImageType::number_planes ) *
+                       sizeof( PixelType );
+
+    // The alignment of the heap images, the rows of padded images stay
+    // aligned
+    constexpr size_t alignment = std::max< size_t >( 64, alignof( PixelType ) );
+
+    return ImageType( size.getWidth( ),
+                      size.getHeight( ),
+                      allocate( std::max< size_t >( bytes, 1 ), alignment ),
+                      stride * static_cast< int32_t >( sizeof( PixelType ) ) );
+}
+
+} // namespace cvl::core
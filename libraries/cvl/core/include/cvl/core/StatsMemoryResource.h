@@ -0,0 +1,151 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/export.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cvl::core
+{
+
+/**
+ * @brief The AllocationStats struct
+ *
+ * A snapshot of the counters of a StatsMemoryResource. Size class 0 counts
+ * allocations up to 64 bytes, each further class doubles the upper bound.
+ * The last class counts everything above.
+ */
+struct AllocationStats
+{
+    static constexpr size_t number_size_classes = 24;
+
+    /**
+     * Function that returns the size class of an allocation
+     *
+     * @param [in]  bytes   The size of the allocation in bytes.
+     */
+    [[nodiscard]] static size_t getSizeClass( size_t bytes ) noexcept;
+
+    /**
+     * Function that returns the upper bound of a size class in bytes
+     *
+     * @param [in]  sizeClass   The size class.
+     */
+    [[nodiscard]] static size_t getSizeClassLimit( size_t sizeClass ) noexcept;
+
+    std::string tag;
+    int64_t liveBytes { };
+    int64_t peakBytes { };
+    int64_t allocations { };
+    int64_t deallocations { };
+    int64_t allocatedBytes { }; ///< All bytes ever allocated
+    std::array< int64_t, number_size_classes > sizeClasses { };
+};
+
+/**
+ * Function that writes a snapshot as one line of text
+ */
+CVL_CORE_EXPORT std::ostream& operator<<( std::ostream& os,
+                                          const AllocationStats& stats );
+
+/**
+ * @brief The StatsMemoryResource class
+ *
+ * Memory resource that counts the allocations of an upstream resource. The
+ * counters are atomics updated with relaxed ordering, no lock is taken and
+ * nothing is logged on allocation. Each resource has a tag, e.g. the name of
+ * a pipeline stage, and the counters can be exported per tag at any time.
+ * E.g.:
+ *
+ * StatsMemoryResource stats( "pool", &poolResource );
+ * std::pmr::polymorphic_allocator< uint8_t > allocator( &stats );
+ * ...
+ * LOG_INFO( stats.getSnapshot( ) );
+ *
+ * The upstream resource must outlive this resource.
+ */
+class CVL_CORE_EXPORT StatsMemoryResource final
+    : public std::pmr::memory_resource
+{
+public:
+    CVT_DISABLE_COPY( StatsMemoryResource );
+    CVT_DISABLE_MOVE( StatsMemoryResource );
+
+    /**
+     * Value constructor
+     *
+     * @param [in]  tag         The tag of the counters.
+     * @param [in]  upstream    The resource that allocates.
+     */
+    StatsMemoryResource( std::string tag,
+                         std::pmr::memory_resource* upstream =
+                             std::pmr::get_default_resource( ) );
+
+    /**
+     * Destructor
+     */
+    ~StatsMemoryResource( ) override;
+
+    /**
+     * Function that returns a snapshot of the counters. The counters are read
+     * one after another while other threads may allocate, so the snapshot is
+     * not exact under concurrent use.
+     */
+    [[nodiscard]] AllocationStats getSnapshot( ) const;
+
+    /**
+     * Function that returns one snapshot per tag of all existing resources.
+     * The counters of resources with the same tag are summed, the peak is the
+     * largest peak of them. The tags are ordered by the construction of their
+     * first resource.
+     */
+    [[nodiscard]] static std::vector< AllocationStats > getAllSnapshots( );
+
+    /**
+     * Function that resets the peak to the live bytes and clears the counts.
+     * The live bytes are kept.
+     */
+    void resetCounters( );
+
+    /**
+     * Accessor tag
+     */
+    [[nodiscard]] const std::string& getTag( ) const noexcept;
+
+    /**
+     * Accessor upstream
+     */
+    [[nodiscard]] std::pmr::memory_resource* getUpstream( ) const noexcept;
+
+private:
+    void* do_allocate( size_t bytes, size_t alignment ) override;
+
+    void do_deallocate( void* p, size_t bytes, size_t alignment ) override;
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other ) const noexcept override;
+
+    std::string mTag;
+    std::pmr::memory_resource* mUpstream { };
+
+    // The live and peak bytes change together with every call, they share a
+    // cache line that no counter is placed on
+    alignas( 64 ) std::atomic< int64_t > mLiveBytes { };
+    std::atomic< int64_t > mPeakBytes { };
+    alignas( 64 ) std::atomic< int64_t > mAllocations { };
+    std::atomic< int64_t > mDeallocations { };
+    std::atomic< int64_t > mAllocatedBytes { };
+    std::array< std::atomic< int64_t >, AllocationStats::number_size_classes >
+        mSizeClasses { };
+};
+
+} // namespace cvl::core
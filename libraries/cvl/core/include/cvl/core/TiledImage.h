@@ -0,0 +1,822 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/AlignedAllocator.h>
+#include <cvl/core/ChannelLayout.h>
+#include <cvl/core/Image.h>
+#include <cvl/core/ImageBuffer.h>
+#include <cvl/core/Parallel.h>
+#include <cvl/core/Point.h>
+#include <cvl/core/Rectangle.h>
+#include <cvl/core/RowAlignment.h>
+#include <cvl/core/Size.h>
+#include <cvl/core/Types.h>
+#include <cvl/core/macros.h>
+
+// STD includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace cvl::core
+{
+
+/**
+ * @brief This class describes an image stored in square tiles.
+ *
+ * The image is split into tiles of TileSize x TileSize pixels, the tiles of
+ * the last column and row are cut at the image border. Each tile is stored
+ * contiguously in one buffer, row by row with a stride of TileSize pixels.
+ * Work on a tile touches only a few pages and cache lines, even if it walks
+ * along the columns of a very large image.
+ *
+ * A tile is accessed as an image view on the shared buffer. The buffer is
+ * released with the last tiled image or tile view referencing it.
+ *
+ * E.g.:
+ *
+ * TiledImage< uint8_t, 1 > image( 20000, 10000 );
+ *
+ * for ( const auto& tile : image )
+ * {
+ *     processImage( tile.image );
+ * }
+ */
+template < Arithmetic PixelType, int32_t Channels,
+           typename Allocator = AlignedAllocator< PixelType >,
+           ChannelLayout Layout = PlanarLayout, int32_t TileSize = 64 >
+class TiledImage
+{
+public:
+    static_assert( TileSize > 0, "The tile size must be positive" );
+
+    using value_type = PixelType;
+    using reference_type = PixelType&;
+    using pointer_type = PixelType*;
+    using const_reference_type = const PixelType&;
+    using allocator_type = Allocator;
+    using layout_type = Layout;
+    using image_type = Image< PixelType, Channels, Allocator, Layout >;
+
+    static constexpr int32_t tile_size = TileSize;
+
+    /**
+     * @brief The Tile struct
+     *
+     * A tile of the image and its position in the image
+     */
+    struct Tile
+    {
+        Rectangle< int32_t > rect;
+        image_type image;
+    };
+
+    /**
+     * @brief The TileIterator class
+     *
+     * Iterates the tiles row by row. Dereferencing creates the view of the
+     * tile.
+     */
+    class TileIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Tile;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Tile;
+
+        TileIterator( ) = default;
+
+        TileIterator( const TiledImage* image, int32_t index )
+            : mImage( image )
+            , mIndex( index )
+        {
+        }
+
+        Tile operator*( ) const
+        {
+            return mImage->getTile( mIndex );
+        }
+
+        TileIterator& operator++( )
+        {
+            mIndex++;
+            return *this;
+        }
+
+        TileIterator operator++( int )
+        {
+            auto iterator = *this;
+            mIndex++;
+            return iterator;
+        }
+
+        bool operator==( const TileIterator& other ) const = default;
+
+    private:
+        const TiledImage* mImage { };
+        int32_t mIndex { };
+    };
+
+    /**
+     * Default constructor
+     */
+    TiledImage( ) = default;
+
+    /**
+     * Value construct
+     *
+     * @brief The constructor creates a tiled image with the defined
+     * dimensions
+     *
+     * @param width             The width of the image
+     * @param height            The height of the image
+     * @param zeroInitialize    Flag that signals if the buffer should be
+     *                          initialized
+     * @param allocator         The allocator object to be used
+     */
+    TiledImage( int32_t width, int32_t height, bool zeroInitialize = false,
+                const Allocator& allocator = Allocator( ) );
+
+    /**
+     * Value construct
+     *
+     * @brief The constructor creates a tiled image with the defined
+     * dimensions
+     *
+     * @param size              The size of the image
+     * @param zeroInitialize    Flag that signals if the buffer should be
+     *                          initialized
+     * @param allocator         The allocator object to be used
+     */
+    TiledImage( const SizeI& size, bool zeroInitialize = false,
+                const Allocator& allocator = Allocator( ) );
+
+    /**
+     * Copy constructor
+     *
+     * @brief The copy constructor creates a shallow copy of the image. No
+     * memory is copied.
+     *
+     * @param [in]  other     The image to copy from
+     */
+    TiledImage( const TiledImage& other ) = default;
+
+    /**
+     * Move constructor
+     *
+     * @param [in]  other     The image to move
+     */
+    TiledImage( TiledImage&& other ) noexcept = default;
+
+    /**
+     * Assignment operator
+     *
+     * @brief The assignment operator creates a shallow copy of the image. No
+     * memory is copied. Allocators that are not assignable, e.g. the
+     * polymorphic allocator, are kept. The memory is still released by the
+     * allocator it was allocated with.
+     *
+     * @param [in]  other     The image to assign from
+     */
+    TiledImage& operator=( const TiledImage& other ) noexcept;
+
+    /**
+     * Move operator
+     *
+     * @param [in]  other     The image to move from
+     */
+    TiledImage& operator=( TiledImage&& other ) noexcept;
+
+    /**
+     * Accessor size
+     *
+     * @returns The size of the image
+     */
+    [[nodiscard]] SizeI getSize( ) const;
+
+    /**
+     * Accessor width
+     *
+     * @returns The width of the image
+     */
+    [[nodiscard]] int32_t getWidth( ) const;
+
+    /**
+     * Accessor height
+     *
+     * @returns The height of the image
+     */
+    [[nodiscard]] int32_t getHeight( ) const;
+
+    /**
+     * Accessor number of tiles in x
+     *
+     * @returns The number of tile columns
+     */
+    [[nodiscard]] int32_t getNumberTilesX( ) const;
+
+    /**
+     * Accessor number of tiles in y
+     *
+     * @returns The number of tile rows
+     */
+    [[nodiscard]] int32_t getNumberTilesY( ) const;
+
+    /**
+     * Accessor number of tiles
+     *
+     * @returns The number of tiles of the image
+     */
+    [[nodiscard]] int32_t getNumberTiles( ) const;
+
+    /**
+     * Accessor allocator
+     *
+     * @returns The allocator of the image
+     */
+    [[nodiscard]] allocator_type getAllocator( ) const;
+
+    /**
+     * Function that returns the area of a tile in the image
+     *
+     * @param [in]  tileX   The tile column.
+     * @param [in]  tileY   The tile row.
+     *
+     * @returns The rectangle of the tile
+     */
+    [[nodiscard]] Rectangle< int32_t > getTileRect( int32_t tileX,
+                                                    int32_t tileY ) const;
+
+    /**
+     * Function that returns a tile. The image of the tile is a view on the
+     * buffer of the tiled image, no memory is copied.
+     *
+     * @param [in]  tileX   The tile column.
+     * @param [in]  tileY   The tile row.
+     *
+     * @returns The tile
+     */
+    [[nodiscard]] Tile getTile( int32_t tileX, int32_t tileY ) const;
+
+    /**
+     * Function that returns a tile.
+     *
+     * @param [in]  index   The index of the tile, counted row by row.
+     *
+     * @returns The tile
+     */
+    [[nodiscard]] Tile getTile( int32_t index ) const;
+
+    /**
+     * Accessor to the pixel
+     *
+     * @param [in]  row         The row of the pixel.
+     * @param [in]  column      The column of the pixel.
+     * @param [in]  channel     The channel of the pixel.
+     *
+     * @returns Reference to the pixel
+     */
+    [[nodiscard]] reference_type at( int32_t row, int32_t column,
+                                     int32_t channel = 0 );
+
+    /**
+     * Accessor to the pixel
+     *
+     * @param [in]  row         The row of the pixel.
+     * @param [in]  column      The column of the pixel.
+     * @param [in]  channel     The channel of the pixel.
+     *
+     * @returns Const reference to the pixel
+     */
+    [[nodiscard]] const_reference_type at( int32_t row, int32_t column,
+                                           int32_t channel = 0 ) const;
+
+    /**
+     * Function that copies a region of the tiled image into a linear image.
+     *
+     * @param [in]  region      The region in the tiled image.
+     * @param [out] imageOut    The linear image. It must hold the region at
+     *                          the position.
+     * @param [in]  position    The position of the region in the linear
+     *                          image.
+     */
+    template < RowAlignmentPolicy Alignment >
+    void readRegion(
+        const Rectangle< int32_t >& region,
+        Image< PixelType, Channels, Allocator, Layout, Alignment >& imageOut,
+        const Point2i& position = Point2i( 0, 0 ) ) const;
+
+    /**
+     * Function that copies a region of a linear image into the tiled image.
+     *
+     * @param [in]  imageIn     The linear image.
+     * @param [in]  region      The region in the linear image.
+     * @param [in]  position    The position of the region in the tiled
+     *                          image.
+     */
+    template < RowAlignmentPolicy Alignment >
+    void writeRegion(
+        const Image< PixelType, Channels, Allocator, Layout, Alignment >&
+            imageIn,
+        const Rectangle< int32_t >& region, const Point2i& position );
+
+    /**
+     * Function that returns the iterator to the first tile
+     */
+    [[nodiscard]] TileIterator begin( ) const;
+
+    /**
+     * Function that returns the iterator behind the last tile
+     */
+    [[nodiscard]] TileIterator end( ) const;
+
+private:
+    static constexpr int32_t pixel_step = image_type::pixel_step;
+    static constexpr int32_t number_planes = image_type::number_planes;
+
+    // The stride of the tile rows in elements
+    static constexpr int32_t tile_stride =
+        Layout::template getRowElements< Channels >( TileSize );
+
+    [[nodiscard]] int32_t getTileHeight( int32_t tileY ) const;
+
+    [[nodiscard]] pointer_type getTileData( int32_t tileX,
+                                            int32_t tileY ) const;
+
+    [[nodiscard]] static size_t getTileElements( int32_t tileHeight );
+
+    /*
+     * The pointer to a pixel of a plane. The following pixels of the row up
+     * to the end of the tile are stored behind it.
+     */
+    [[nodiscard]] pointer_type getPixelPointer( int32_t row, int32_t column,
+                                                int32_t plane ) const;
+
+    SizeI mSize;
+    int32_t mTilesX { };
+    int32_t mTilesY { };
+    pointer_type mData { };
+    Allocator mAllocator;
+    ImageBufferPointer mMemoryHandle;
+};
+
+//
+// Implementation
+//
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::TiledImage(
+    int32_t width, int32_t height, bool zeroInitialize /*= false*/,
+    const Allocator& allocator /*= Allocator( )*/ )
+    : mSize( width, height )
+    , mTilesX( ( width + TileSize - 1 ) / TileSize )
+    , mTilesY( ( height + TileSize - 1 ) / TileSize )
+    , mAllocator( allocator )
+{
+    EXPECT_MSG( width >= 0 && height >= 0,
+                "Invalid image size(" << mSize << ")" );
+
+    // All tile rows but the last have full tiles
+    const auto elements =
+        mTilesY == 0 ? size_t { 0 }
+                     : static_cast< size_t >( mTilesY - 1 ) *
+                               static_cast< size_t >( mTilesX ) *
+                               getTileElements( TileSize ) +
+                           static_cast< size_t >( mTilesX ) *
+                               getTileElements( getTileHeight( mTilesY - 1 ) );
+
+    auto* buffer = AllocatedImageBuffer< Allocator >::create(
+        mAllocator, std::max< size_t >( elements, 1 ), 64 );
+
+    mMemoryHandle = ImageBufferPointer( buffer );
+    mData = buffer->getData( );
+
+    if ( zeroInitialize )
+    {
+        std::memset( mData, 0x00, elements * sizeof( PixelType ) );
+    }
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::TiledImage(
+    const SizeI& size, bool zeroInitialize /*= false*/,
+    const Allocator& allocator /*= Allocator( )*/ )
+    : TiledImage( size.getWidth( ), size.getHeight( ), zeroInitialize,
+                  allocator )
+{
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >&
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::operator=(
+    const TiledImage& other ) noexcept
+{
+    if ( this != &other )
+    {
+        mSize = other.mSize;
+        mTilesX = other.mTilesX;
+        mTilesY = other.mTilesY;
+        mData = other.mData;
+        mMemoryHandle = other.mMemoryHandle;
+
+        if constexpr ( std::is_copy_assignable_v< Allocator > )
+        {
+            mAllocator = other.mAllocator;
+        }
+    }
+
+    return *this;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >&
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::operator=(
+    TiledImage&& other ) noexcept
+{
+    if ( this != &other )
+    {
+        mSize = other.mSize;
+        mTilesX = other.mTilesX;
+        mTilesY = other.mTilesY;
+        mData = other.mData;
+        mMemoryHandle = std::move( other.mMemoryHandle );
+
+        if constexpr ( std::is_move_assignable_v< Allocator > )
+        {
+            mAllocator = std::move( other.mAllocator );
+        }
+
+        // Invalidate the data of the moved object
+        other.mData = nullptr;
+    }
+
+    return *this;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+SizeI TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::getSize( )
+    const
+{
+    return mSize;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+int32_t
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::getWidth( )
+    const
+{
+    return mSize.getWidth( );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+int32_t
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::getHeight( )
+    const
+{
+    return mSize.getHeight( );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+int32_t TiledImage< PixelType, Channels, Allocator, Layout,
+                    TileSize >::getNumberTilesX( ) const
+{
+    return mTilesX;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+int32_t TiledImage< PixelType, Channels, Allocator, Layout,
+                    TileSize >::getNumberTilesY( ) const
+{
+    return mTilesY;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+int32_t TiledImage< PixelType, Channels, Allocator, Layout,
+                    TileSize >::getNumberTiles( ) const
+{
+    return mTilesX * mTilesY;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+Allocator TiledImage< PixelType, Channels, Allocator, Layout,
+                      TileSize >::getAllocator( ) const
+{
+    return mAllocator;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+Rectangle< int32_t >
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::getTileRect(
+    int32_t tileX, int32_t tileY ) const
+{
+    const auto left = tileX * TileSize;
+    const auto top = tileY * TileSize;
+
+    return { Point2i( left, top ),
+             SizeI( std::min( TileSize, mSize.getWidth( ) - left ),
+                    std::min( TileSize, mSize.getHeight( ) - top ) ) };
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::Tile
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::getTile(
+    int32_t tileX, int32_t tileY ) const
+{
+    EXPECT_MSG( tileX >= 0 && tileX < mTilesX && tileY >= 0 &&
+                    tileY < mTilesY,
+                "Invalid tile(" << tileX << ", " << tileY << ")" );
+
+    const auto rect = getTileRect( tileX, tileY );
+
+    // The planes of a tile are separated by the tile height, so the tile is
+    // a complete image
+    return { rect,
+             image_type( rect.getWidth( ),
+                         rect.getHeight( ),
+                         getTileData( tileX, tileY ),
+                         tile_stride * static_cast< int32_t >(
+                                           sizeof( PixelType ) ),
+                         mMemoryHandle,
+                         mAllocator ) };
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::Tile
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::getTile(
+    int32_t index ) const
+{
+    return getTile( index % mTilesX, index / mTilesX );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout,
+                     TileSize >::reference_type
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::at(
+    int32_t row, int32_t column, int32_t channel /*= 0*/ )
+{
+    const auto tileY = row / TileSize;
+    const auto offset = Layout::template getOffset< Channels >(
+        tile_stride,
+        getTileHeight( tileY ),
+        row % TileSize,
+        column % TileSize,
+        channel );
+
+    return getTileData( column / TileSize, tileY )[ offset ];
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout,
+                     TileSize >::const_reference_type
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::at(
+    int32_t row, int32_t column, int32_t channel /*= 0*/ ) const
+{
+    const auto tileY = row / TileSize;
+    const auto offset = Layout::template getOffset< Channels >(
+        tile_stride,
+        getTileHeight( tileY ),
+        row % TileSize,
+        column % TileSize,
+        channel );
+
+    return getTileData( column / TileSize, tileY )[ offset ];
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+template < RowAlignmentPolicy Alignment >
+void TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::
+    readRegion(
+        const Rectangle< int32_t >& region,
+        Image< PixelType, Channels, Allocator, Layout, Alignment >& imageOut,
+        const Point2i& position /*= Point2i( 0, 0 )*/ ) const
+{
+    const auto offsetX = position.getX( ) - region.getLeft( );
+    const auto offsetY = position.getY( ) - region.getTop( );
+
+    for ( int32_t plane = 0; plane < number_planes; plane++ )
+    {
+        for ( int32_t y = region.getTop( ); y < region.getBottom( ); y++ )
+        {
+            auto* dstPtr = imageOut.getRowPointer( y + offsetY, plane );
+
+            // Copy the row piece by piece, one piece per tile
+            for ( int32_t x = region.getLeft( ); x < region.getRight( ); )
+            {
+                const auto length = std::min( TileSize - x % TileSize,
+                                              region.getRight( ) - x );
+
+                std::memcpy( dstPtr + ( x + offsetX ) * pixel_step,
+                             getPixelPointer( y, x, plane ),
+                             static_cast< size_t >( length * pixel_step ) *
+                                 sizeof( PixelType ) );
+
+                x += length;
+            }
+        }
+    }
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+template < RowAlignmentPolicy Alignment >
+void TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::
+    writeRegion(
+        const Image< PixelType, Channels, Allocator, Layout, Alignment >&
+            imageIn,
+        const Rectangle< int32_t >& region, const Point2i& position )
+{
+    const auto offsetX = position.getX( ) - region.getLeft( );
+    const auto offsetY = position.getY( ) - region.getTop( );
+
+    for ( int32_t plane = 0; plane < number_planes; plane++ )
+    {
+        for ( int32_t y = region.getTop( ); y < region.getBottom( ); y++ )
+        {
+            const auto* srcPtr = imageIn.getRowPointer( y, plane );
+
+            for ( int32_t x = region.getLeft( ); x < region.getRight( ); )
+            {
+                const auto tileX = x + offsetX;
+                const auto length = std::min( TileSize - tileX % TileSize,
+                                              region.getRight( ) - x );
+
+                std::memcpy( getPixelPointer( y + offsetY, tileX, plane ),
+                             srcPtr + x * pixel_step,
+                             static_cast< size_t >( length * pixel_step ) *
+                                 sizeof( PixelType ) );
+
+                x += length;
+            }
+        }
+    }
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout,
+                     TileSize >::TileIterator
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::begin( ) const
+{
+    return TileIterator( this, 0 );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout,
+                     TileSize >::TileIterator
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::end( ) const
+{
+    return TileIterator( this, getNumberTiles( ) );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+int32_t TiledImage< PixelType, Channels, Allocator, Layout,
+                    TileSize >::getTileHeight( int32_t tileY ) const
+{
+    return std::min( TileSize, mSize.getHeight( ) - tileY * TileSize );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout,
+                     TileSize >::pointer_type
+TiledImage< PixelType, Channels, Allocator, Layout, TileSize >::getTileData(
+    int32_t tileX, int32_t tileY ) const
+{
+    // The tiles of the last row are not as high as the others
+    const auto offset =
+        static_cast< size_t >( tileY ) * static_cast< size_t >( mTilesX ) *
+            getTileElements( TileSize ) +
+        static_cast< size_t >( tileX ) *
+            getTileElements( getTileHeight( tileY ) );
+
+    return mData + offset;
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+size_t TiledImage< PixelType, Channels, Allocator, Layout,
+                   TileSize >::getTileElements( int32_t tileHeight )
+{
+    return static_cast< size_t >( tile_stride ) *
+           static_cast< size_t >( tileHeight ) *
+           static_cast< size_t >( number_planes );
+}
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, int32_t TileSize >
+typename TiledImage< PixelType, Channels, Allocator, Layout,
+                     TileSize >::pointer_type
+TiledImage< PixelType, Channels, Allocator, Layout,
+            TileSize >::getPixelPointer( int32_t row, int32_t column,
+                                         int32_t plane ) const
+{
+    const auto tileY = row / TileSize;
+    const auto offset = Layout::template getOffset< Channels >(
+        tile_stride,
+        getTileHeight( tileY ),
+        row % TileSize,
+        column % TileSize,
+        plane );
+
+    return getTileData( column / TileSize, tileY ) + offset;
+}
+
+/**
+ * Function that converts a linear image into a tiled image. The tiles are
+ * converted in parallel.
+ *
+ * @param [in]   imageIn    The linear image
+ * @param [out]  imageOut   The tiled image. The image is reallocated if the
+ *                          size does not match.
+ */
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment,
+           int32_t TileSize >
+void toTiled(
+    const Image< PixelType, Channels, Allocator, Layout, Alignment >& imageIn,
+    TiledImage< PixelType, Channels, Allocator, Layout, TileSize >& imageOut )
+{
+    using TiledImageType =
+        TiledImage< PixelType, Channels, Allocator, Layout, TileSize >;
+
+    if ( imageOut.getSize( ) != imageIn.getSize( ) )
+    {
+        imageOut = TiledImageType(
+            imageIn.getSize( ), false, imageIn.getAllocator( ) );
+    }
+
+    parallelFor( 0,
+                 imageOut.getNumberTiles( ),
+                 [ & ]( int32_t index )
+                 {
+                     const auto tileX = index % imageOut.getNumberTilesX( );
+                     const auto tileY = index / imageOut.getNumberTilesX( );
+                     const auto rect = imageOut.getTileRect( tileX, tileY );
+
+                     imageOut.writeRegion( imageIn, rect, rect.getTopLeft( ) );
+                 } );
+}
+
+/**
+ * Function that converts a tiled image into a linear image. The tiles are
+ * converted in parallel.
+ *
+ * @param [in]   imageIn    The tiled image
+ * @param [out]  imageOut   The linear image. The image is reallocated if the
+ *                          size does not match.
+ */
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           ChannelLayout Layout, RowAlignmentPolicy Alignment,
+           int32_t TileSize >
+void toLinear(
+    const TiledImage< PixelType, Channels, Allocator, Layout, TileSize >&
+        imageIn,
+    Image< PixelType, Channels, Allocator, Layout, Alignment >& imageOut )
+{
+    using ImageType =
+        Image< PixelType, Channels, Allocator, Layout, Alignment >;
+
+    if ( imageOut.getSize( ) != imageIn.getSize( ) )
+    {
+        imageOut =
+            ImageType( imageIn.getSize( ), false, imageIn.getAllocator( ) );
+    }
+
+    parallelFor( 0,
+                 imageIn.getNumberTiles( ),
+                 [ & ]( int32_t index )
+                 {
+                     const auto tileX = index % imageIn.getNumberTilesX( );
+                     const auto tileY = index / imageIn.getNumberTilesX( );
+                     const auto rect = imageIn.getTileRect( tileX, tileY );
+
+                     imageIn.readRegion( rect, imageOut, rect.getTopLeft( ) );
+                 } );
+}
+
+} // namespace cvl::core
@@ -20,9 +20,10 @@ enum class Norm
 
 enum class BorderType
 {
-    Replicate, // aaaaaa|abcdefgh|hhhhhhh
-    Reflect,   // fedcba | abcdefgh | hgfedcb
-    Wrap,      // cdefgh|abcdefgh|abcdefg
+    Replicate,  // aaaaaa|abcdefgh|hhhhhhh
+    Reflect,    // fedcba | abcdefgh | hgfedcb
+    Wrap,       // cdefgh|abcdefgh|abcdefg
+    Reflect101, // gfedcb|abcdefgh|gfedcba
 };
 
 enum class PixelDirection
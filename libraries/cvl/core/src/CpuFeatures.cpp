@@ -0,0 +1,97 @@
+// Own includes
+#include <cvl/core/CpuFeatures.h>
+
+#if CVL_ARCH_X86 && defined( _MSC_VER )
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace cvl::core
+{
+namespace
+{
+SimdLevel detectSimdLevel( )
+{
+#if CVL_ARCH_X86 && ( defined( __GNUC__ ) || defined( __clang__ ) )
+    __builtin_cpu_init( );
+
+    if ( __builtin_cpu_supports( "avx512f" ) &&
+         __builtin_cpu_supports( "avx512bw" ) &&
+         __builtin_cpu_supports( "avx512vl" ) )
+    {
+        return SimdLevel::AVX512;
+    }
+
+    if ( __builtin_cpu_supports( "avx2" ) )
+    {
+        return SimdLevel::AVX2;
+    }
+
+    if ( __builtin_cpu_supports( "sse2" ) )
+    {
+        return SimdLevel::SSE2;
+    }
+
+    return SimdLevel::Scalar;
+#elif CVL_ARCH_X86 && defined( _MSC_VER )
+    int info[ 4 ] { };
+
+    __cpuid( info, 0 );
+    const auto maxLeaf = info[ 0 ];
+
+    __cpuid( info, 1 );
+    const auto sse2 = ( info[ 3 ] & ( 1 << 26 ) ) != 0;
+    const auto osxsave = ( info[ 2 ] & ( 1 << 27 ) ) != 0;
+
+    if ( ! sse2 )
+    {
+        return SimdLevel::Scalar;
+    }
+
+    if ( ! osxsave || maxLeaf < 7 )
+    {
+        return SimdLevel::SSE2;
+    }
+
+    // The operating system has to save the YMM and ZMM registers
+    const auto xcr0 = _xgetbv( 0 );
+    const auto ymmEnabled = ( xcr0 & 0x06 ) == 0x06;
+    const auto zmmEnabled = ( xcr0 & 0xE6 ) == 0xE6;
+
+    __cpuidex( info, 7, 0 );
+    const auto avx2 = ( info[ 1 ] & ( 1 << 5 ) ) != 0;
+    const auto avx512f = ( info[ 1 ] & ( 1 << 16 ) ) != 0;
+    const auto avx512bw = ( info[ 1 ] & ( 1 << 30 ) ) != 0;
+    const auto avx512vl = ( info[ 1 ] & ( 1 << 31 ) ) != 0;
+
+    if ( zmmEnabled && avx512f && avx512bw && avx512vl )
+    {
+        return SimdLevel::AVX512;
+    }
+
+    if ( ymmEnabled && avx2 )
+    {
+        return SimdLevel::AVX2;
+    }
+
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+} // namespace
+
+SimdLevel getSimdLevel( )
+{
+    static const auto level = detectSimdLevel( );
+
+    return level;
+}
+
+bool isSimdLevelSupported( SimdLevel level )
+{
+    return static_cast< int32_t >( level ) <=
+           static_cast< int32_t >( getSimdLevel( ) );
+}
+
+} // namespace cvl::core
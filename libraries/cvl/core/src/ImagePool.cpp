@@ -0,0 +1,151 @@
+// Own includes
+#include <cvl/core/ImagePool.h>
+
+// STD includes
+#include <map>
+#include <tuple>
+#include <utility>
+IGNORE_WARNINGS_STD_PUSH
+#include <mutex>
+IGNORE_WARNINGS_POP
+
+namespace cvl::core
+{
+
+struct ImagePool::State
+{
+    mutable std::mutex mutex;
+    std::map< Key, std::vector< std::unique_ptr< Buffer > > > buffers;
+    size_t maxCachedBytes { };
+    size_t cachedBytes { };
+    size_t numberCachedBuffers { };
+    size_t numberAllocations { };
+    bool closed { };
+};
+
+bool ImagePool::Key::operator<( const Key& other ) const
+{
+    return std::make_tuple(
+               type, size.getWidth( ), size.getHeight( ), resource ) <
+           std::make_tuple( other.type,
+                            other.size.getWidth( ),
+                            other.size.getHeight( ),
+                            other.resource );
+}
+
+ImagePool::ImagePool( size_t maxCachedBytes /* = unlimited*/ )
+    : mState( std::make_shared< State >( ) )
+{
+    mState->maxCachedBytes = maxCachedBytes;
+}
+
+ImagePool::~ImagePool( )
+{
+    // Images still alive keep the state, their buffers are deallocated on
+    // release
+    {
+        std::lock_guard< std::mutex > lock( mState->mutex );
+        mState->closed = true;
+    }
+
+    clear( );
+}
+
+void ImagePool::clear( )
+{
+    std::map< Key, std::vector< std::unique_ptr< Buffer > > > buffers;
+
+    {
+        std::lock_guard< std::mutex > lock( mState->mutex );
+
+        std::swap( buffers, mState->buffers );
+        mState->cachedBytes = 0;
+        mState->numberCachedBuffers = 0;
+    }
+
+    // The buffers are deallocated outside of the lock
+}
+
+size_t ImagePool::getMaxCachedBytes( ) const
+{
+    std::lock_guard< std::mutex > lock( mState->mutex );
+    return mState->maxCachedBytes;
+}
+
+size_t ImagePool::getCachedBytes( ) const
+{
+    std::lock_guard< std::mutex > lock( mState->mutex );
+    return mState->cachedBytes;
+}
+
+size_t ImagePool::getNumberCachedBuffers( ) const
+{
+    std::lock_guard< std::mutex > lock( mState->mutex );
+    return mState->numberCachedBuffers;
+}
+
+size_t ImagePool::getNumberAllocations( ) const
+{
+    std::lock_guard< std::mutex > lock( mState->mutex );
+    return mState->numberAllocations;
+}
+
+ImagePool::Buffer* ImagePool::takeBuffer( const Key& key )
+{
+    std::unique_ptr< Buffer > buffer;
+
+    {
+        std::lock_guard< std::mutex > lock( mState->mutex );
+
+        const auto it = mState->buffers.find( key );
+
+        if ( it == mState->buffers.end( ) || it->second.empty( ) )
+        {
+            return nullptr;
+        }
+
+        buffer = std::move( it->second.back( ) );
+        it->second.pop_back( );
+
+        mState->cachedBytes -= buffer->bytes;
+        mState->numberCachedBuffers--;
+    }
+
+    buffer->state = mState;
+
+    return buffer.release( );
+}
+
+ImagePool::Buffer* ImagePool::addBuffer( std::unique_ptr< Buffer > buffer )
+{
+    {
+        std::lock_guard< std::mutex > lock( mState->mutex );
+        mState->numberAllocations++;
+    }
+
+    buffer->state = mState;
+
+    return buffer.release( );
+}
+
+void ImagePool::releaseBuffer( ImageBuffer* buffer )
+{
+    // Declared first, so a buffer that is not cached is deallocated after the
+    // lock is released
+    std::unique_ptr< Buffer > owned( static_cast< Buffer* >( buffer ) );
+    const auto state = std::move( owned->state );
+
+    std::lock_guard< std::mutex > lock( state->mutex );
+
+    if ( state->closed ||
+         owned->bytes > state->maxCachedBytes - state->cachedBytes )
+    {
+        return;
+    }
+
+    state->cachedBytes += owned->bytes;
+    state->numberCachedBuffers++;
+    state->buffers[ owned->key ].push_back( std::move( owned ) );
+}
+
+} // namespace cvl::core
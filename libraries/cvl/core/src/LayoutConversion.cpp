@@ -0,0 +1,392 @@
+// Own includes
+#include <cvl/core/LayoutConversion.h>
+
+// CVL includes
+#include <cvl/core/macros.h>
+
+#if CVL_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace cvl::core::detail
+{
+namespace
+{
+
+void interleaveRowTail( const uint8_t* const* srcPtrs, uint8_t* dstPtr,
+                        int32_t x, int32_t width, int32_t channels )
+{
+    for ( ; x < width; x++ )
+    {
+        for ( int32_t c = 0; c < channels; c++ )
+        {
+            dstPtr[ x * channels + c ] = srcPtrs[ c ][ x ];
+        }
+    }
+}
+
+void deinterleaveRowTail( const uint8_t* srcPtr, uint8_t* const* dstPtrs,
+                          int32_t x, int32_t width, int32_t channels )
+{
+    for ( ; x < width; x++ )
+    {
+        for ( int32_t c = 0; c < channels; c++ )
+        {
+            dstPtrs[ c ][ x ] = srcPtr[ x * channels + c ];
+        }
+    }
+}
+
+#if CVL_ARCH_X86
+
+//
+// SSE2
+//
+// Two and four channels are converted with byte and word unpacks. The
+// deinterleaving masks the channel in each 16 or 32 bit pixel and packs the
+// values back to bytes.
+//
+
+CVL_TARGET_SSE2
+void interleave2SSE2( const uint8_t* const* srcPtrs, uint8_t* dstPtr,
+                      int32_t width )
+{
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto c0 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 0 ] + x ) );
+        const auto c1 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 1 ] + x ) );
+
+        auto* dst = reinterpret_cast< __m128i* >( dstPtr + x * 2 );
+
+        _mm_storeu_si128( dst, _mm_unpacklo_epi8( c0, c1 ) );
+        _mm_storeu_si128( dst + 1, _mm_unpackhi_epi8( c0, c1 ) );
+    }
+
+    interleaveRowTail( srcPtrs, dstPtr, x, width, 2 );
+}
+
+CVL_TARGET_SSE2
+void interleave4SSE2( const uint8_t* const* srcPtrs, uint8_t* dstPtr,
+                      int32_t width )
+{
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto c0 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 0 ] + x ) );
+        const auto c1 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 1 ] + x ) );
+        const auto c2 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 2 ] + x ) );
+        const auto c3 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 3 ] + x ) );
+
+        const auto c01Low = _mm_unpacklo_epi8( c0, c1 );
+        const auto c01High = _mm_unpackhi_epi8( c0, c1 );
+        const auto c23Low = _mm_unpacklo_epi8( c2, c3 );
+        const auto c23High = _mm_unpackhi_epi8( c2, c3 );
+
+        auto* dst = reinterpret_cast< __m128i* >( dstPtr + x * 4 );
+
+        _mm_storeu_si128( dst, _mm_unpacklo_epi16( c01Low, c23Low ) );
+        _mm_storeu_si128( dst + 1, _mm_unpackhi_epi16( c01Low, c23Low ) );
+        _mm_storeu_si128( dst + 2, _mm_unpacklo_epi16( c01High, c23High ) );
+        _mm_storeu_si128( dst + 3, _mm_unpackhi_epi16( c01High, c23High ) );
+    }
+
+    interleaveRowTail( srcPtrs, dstPtr, x, width, 4 );
+}
+
+CVL_TARGET_SSE2
+void deinterleave2SSE2( const uint8_t* srcPtr, uint8_t* const* dstPtrs,
+                        int32_t width )
+{
+    const auto lowMask = _mm_set1_epi16( 0x00FF );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto* src = reinterpret_cast< const __m128i* >( srcPtr + x * 2 );
+        const auto p0 = _mm_loadu_si128( src );
+        const auto p1 = _mm_loadu_si128( src + 1 );
+
+        const auto c0 = _mm_packus_epi16( _mm_and_si128( p0, lowMask ),
+                                          _mm_and_si128( p1, lowMask ) );
+        const auto c1 = _mm_packus_epi16( _mm_srli_epi16( p0, 8 ),
+                                          _mm_srli_epi16( p1, 8 ) );
+
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dstPtrs[ 0 ] + x ),
+                          c0 );
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dstPtrs[ 1 ] + x ),
+                          c1 );
+    }
+
+    deinterleaveRowTail( srcPtr, dstPtrs, x, width, 2 );
+}
+
+CVL_TARGET_SSE2
+void deinterleave4SSE2( const uint8_t* srcPtr, uint8_t* const* dstPtrs,
+                        int32_t width )
+{
+    const auto lowMask = _mm_set1_epi32( 0x000000FF );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto* src = reinterpret_cast< const __m128i* >( srcPtr + x * 4 );
+        const auto p0 = _mm_loadu_si128( src );
+        const auto p1 = _mm_loadu_si128( src + 1 );
+        const auto p2 = _mm_loadu_si128( src + 2 );
+        const auto p3 = _mm_loadu_si128( src + 3 );
+
+        // The channel values are at most 255, so the signed saturation of the
+        // 32 bit pack keeps them
+        for ( int32_t c = 0; c < 4; c++ )
+        {
+            const auto shift = _mm_cvtsi32_si128( c * 8 );
+
+            const auto v0 =
+                _mm_and_si128( _mm_srl_epi32( p0, shift ), lowMask );
+            const auto v1 =
+                _mm_and_si128( _mm_srl_epi32( p1, shift ), lowMask );
+            const auto v2 =
+                _mm_and_si128( _mm_srl_epi32( p2, shift ), lowMask );
+            const auto v3 =
+                _mm_and_si128( _mm_srl_epi32( p3, shift ), lowMask );
+
+            _mm_storeu_si128(
+                reinterpret_cast< __m128i* >( dstPtrs[ c ] + x ),
+                _mm_packus_epi16( _mm_packs_epi32( v0, v1 ),
+                                  _mm_packs_epi32( v2, v3 ) ) );
+        }
+    }
+
+    deinterleaveRowTail( srcPtr, dstPtrs, x, width, 4 );
+}
+
+//
+// AVX2
+//
+// Three channels do not map onto the unpack instructions. The byte shuffle of
+// SSSE3, which is part of every AVX2 CPU, gathers the bytes of each channel
+// from the three vectors of 16 pixels.
+//
+
+struct ShuffleMasks3
+{
+    // [vector][channel][byte]
+    int8_t values[ 3 ][ 3 ][ 16 ];
+};
+
+constexpr ShuffleMasks3 createInterleaveMasks3( )
+{
+    ShuffleMasks3 masks { };
+
+    for ( int32_t v = 0; v < 3; v++ )
+    {
+        for ( int32_t c = 0; c < 3; c++ )
+        {
+            for ( int32_t i = 0; i < 16; i++ )
+            {
+                // Output byte i of vector v is channel k % 3 of pixel k / 3
+                const auto k = 16 * v + i;
+
+                masks.values[ v ][ c ][ i ] =
+                    k % 3 == c ? static_cast< int8_t >( k / 3 ) : int8_t { -1 };
+            }
+        }
+    }
+
+    return masks;
+}
+
+constexpr ShuffleMasks3 createDeinterleaveMasks3( )
+{
+    ShuffleMasks3 masks { };
+
+    for ( int32_t v = 0; v < 3; v++ )
+    {
+        for ( int32_t c = 0; c < 3; c++ )
+        {
+            for ( int32_t i = 0; i < 16; i++ )
+            {
+                // Channel c of pixel i is the input byte 3 * i + c
+                const auto k = 3 * i + c;
+
+                masks.values[ v ][ c ][ i ] =
+                    k / 16 == v ? static_cast< int8_t >( k % 16 )
+                                : int8_t { -1 };
+            }
+        }
+    }
+
+    return masks;
+}
+
+constexpr auto interleaveMasks3 = createInterleaveMasks3( );
+constexpr auto deinterleaveMasks3 = createDeinterleaveMasks3( );
+
+CVL_TARGET_AVX2
+__m128i loadMask3( const ShuffleMasks3& masks, int32_t v, int32_t c )
+{
+    return _mm_loadu_si128(
+        reinterpret_cast< const __m128i* >( masks.values[ v ][ c ] ) );
+}
+
+CVL_TARGET_AVX2
+void interleave3AVX2( const uint8_t* const* srcPtrs, uint8_t* dstPtr,
+                      int32_t width )
+{
+    __m128i masks[ 3 ][ 3 ];
+
+    for ( int32_t v = 0; v < 3; v++ )
+    {
+        for ( int32_t c = 0; c < 3; c++ )
+        {
+            masks[ v ][ c ] = loadMask3( interleaveMasks3, v, c );
+        }
+    }
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto c0 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 0 ] + x ) );
+        const auto c1 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 1 ] + x ) );
+        const auto c2 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtrs[ 2 ] + x ) );
+
+        auto* dst = reinterpret_cast< __m128i* >( dstPtr + x * 3 );
+
+        for ( int32_t v = 0; v < 3; v++ )
+        {
+            const auto out = _mm_or_si128(
+                _mm_or_si128( _mm_shuffle_epi8( c0, masks[ v ][ 0 ] ),
+                              _mm_shuffle_epi8( c1, masks[ v ][ 1 ] ) ),
+                _mm_shuffle_epi8( c2, masks[ v ][ 2 ] ) );
+
+            _mm_storeu_si128( dst + v, out );
+        }
+    }
+
+    interleaveRowTail( srcPtrs, dstPtr, x, width, 3 );
+}
+
+CVL_TARGET_AVX2
+void deinterleave3AVX2( const uint8_t* srcPtr, uint8_t* const* dstPtrs,
+                        int32_t width )
+{
+    __m128i masks[ 3 ][ 3 ];
+
+    for ( int32_t v = 0; v < 3; v++ )
+    {
+        for ( int32_t c = 0; c < 3; c++ )
+        {
+            masks[ v ][ c ] = loadMask3( deinterleaveMasks3, v, c );
+        }
+    }
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto* src = reinterpret_cast< const __m128i* >( srcPtr + x * 3 );
+        const auto p0 = _mm_loadu_si128( src );
+        const auto p1 = _mm_loadu_si128( src + 1 );
+        const auto p2 = _mm_loadu_si128( src + 2 );
+
+        for ( int32_t c = 0; c < 3; c++ )
+        {
+            const auto out = _mm_or_si128(
+                _mm_or_si128( _mm_shuffle_epi8( p0, masks[ 0 ][ c ] ),
+                              _mm_shuffle_epi8( p1, masks[ 1 ][ c ] ) ),
+                _mm_shuffle_epi8( p2, masks[ 2 ][ c ] ) );
+
+            _mm_storeu_si128(
+                reinterpret_cast< __m128i* >( dstPtrs[ c ] + x ), out );
+        }
+    }
+
+    deinterleaveRowTail( srcPtr, dstPtrs, x, width, 3 );
+}
+
+#endif
+
+} // namespace
+
+void interleaveRow( const uint8_t* const* srcPtrs, uint8_t* dstPtr,
+                    int32_t width, int32_t channels, SimdLevel level )
+{
+    EXPECT_MSG( isSimdLevelSupported( level ),
+                "SIMD level " << level << " is not supported by the CPU" );
+
+#if CVL_ARCH_X86
+    if ( level != SimdLevel::Scalar )
+    {
+        switch ( channels )
+        {
+        case 2:
+            interleave2SSE2( srcPtrs, dstPtr, width );
+            return;
+        case 3:
+            if ( level >= SimdLevel::AVX2 )
+            {
+                interleave3AVX2( srcPtrs, dstPtr, width );
+                return;
+            }
+            break;
+        case 4:
+            interleave4SSE2( srcPtrs, dstPtr, width );
+            return;
+        default:
+            break;
+        }
+    }
+#endif
+
+    interleaveRowScalar( srcPtrs, dstPtr, width, channels );
+}
+
+void deinterleaveRow( const uint8_t* srcPtr, uint8_t* const* dstPtrs,
+                      int32_t width, int32_t channels, SimdLevel level )
+{
+    EXPECT_MSG( isSimdLevelSupported( level ),
+                "SIMD level " << level << " is not supported by the CPU" );
+
+#if CVL_ARCH_X86
+    if ( level != SimdLevel::Scalar )
+    {
+        switch ( channels )
+        {
+        case 2:
+            deinterleave2SSE2( srcPtr, dstPtrs, width );
+            return;
+        case 3:
+            if ( level >= SimdLevel::AVX2 )
+            {
+                deinterleave3AVX2( srcPtr, dstPtrs, width );
+                return;
+            }
+            break;
+        case 4:
+            deinterleave4SSE2( srcPtr, dstPtrs, width );
+            return;
+        default:
+            break;
+        }
+    }
+#endif
+
+    deinterleaveRowScalar( srcPtr, dstPtrs, width, channels );
+}
+
+} // namespace cvl::core::detail
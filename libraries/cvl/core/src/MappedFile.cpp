@@ -0,0 +1,153 @@
+// Own includes
+#include <cvl/core/MappedFile.h>
+
+#if defined( _WIN32 )
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// STD includes
+#include <cerrno>
+#include <cstring>
+#include <tuple>
+
+namespace cvl::core
+{
+
+#if defined( _WIN32 )
+
+MappedFile::MappedFile( const std::string& path,
+                        MappedAccess access /*= MappedAccess::Normal*/ )
+{
+    // The hint selects the cache strategy of the file
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+
+    if ( access == MappedAccess::Sequential )
+    {
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    }
+    else if ( access == MappedAccess::Random )
+    {
+        flags |= FILE_FLAG_RANDOM_ACCESS;
+    }
+
+    const auto file = CreateFileA( path.c_str( ),
+                                   GENERIC_READ,
+                                   FILE_SHARE_READ,
+                                   nullptr,
+                                   OPEN_EXISTING,
+                                   flags,
+                                   nullptr );
+
+    EXPECT_MSG( file != INVALID_HANDLE_VALUE,
+                "Cannot open file(" << path << ")" );
+
+    LARGE_INTEGER fileSize { };
+
+    if ( ! GetFileSizeEx( file, &fileSize ) || fileSize.QuadPart == 0 )
+    {
+        CloseHandle( file );
+        THROW_MSG( "Cannot map empty file(" << path << ")" );
+    }
+
+    const auto mapping =
+        CreateFileMappingA( file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr );
+
+    CloseHandle( file );
+
+    EXPECT_MSG( mapping != nullptr, "Cannot map file(" << path << ")" );
+
+    auto* data = MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 );
+
+    CloseHandle( mapping );
+
+    EXPECT_MSG( data != nullptr, "Cannot map file(" << path << ")" );
+
+    mData = static_cast< uint8_t* >( data );
+    mSize = static_cast< size_t >( fileSize.QuadPart );
+    mHandle = Handle( [ data ]( ) { UnmapViewOfFile( data ); } );
+}
+
+void MappedFile::advise( [[maybe_unused]] MappedAccess access )
+{
+    // Windows only takes the hint when the file is opened
+}
+
+#else
+
+MappedFile::MappedFile( const std::string& path,
+                        MappedAccess access /*= MappedAccess::Normal*/ )
+{
+    const auto file = ::open( path.c_str( ), O_RDONLY );
+
+    EXPECT_MSG( file >= 0,
+                "Cannot open file(" << path
+                                    << "): " << std::strerror( errno ) );
+
+    struct stat fileStat
+    {
+    };
+
+    if ( ::fstat( file, &fileStat ) != 0 || fileStat.st_size == 0 )
+    {
+        ::close( file );
+        THROW_MSG( "Cannot map empty file(" << path << ")" );
+    }
+
+    const auto size = static_cast< size_t >( fileStat.st_size );
+
+    // A private mapping is copy on write, images can be modified in place
+    // without changing the file
+    auto* data = ::mmap(
+        nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0 );
+
+    // The mapping keeps a reference to the file
+    ::close( file );
+
+    EXPECT_MSG( data != MAP_FAILED,
+                "Cannot map file(" << path << "): " << std::strerror( errno ) );
+
+    mData = static_cast< uint8_t* >( data );
+    mSize = size;
+    mHandle = Handle( [ data, size ]( ) { ::munmap( data, size ); } );
+
+    advise( access );
+}
+
+void MappedFile::advise( MappedAccess access )
+{
+    auto advice = MADV_NORMAL;
+
+    if ( access == MappedAccess::Sequential )
+    {
+        advice = MADV_SEQUENTIAL;
+    }
+    else if ( access == MappedAccess::Random )
+    {
+        advice = MADV_RANDOM;
+    }
+
+    // The advice is only a hint, a failure is not an error
+    std::ignore = ::madvise( mData, mSize, advice );
+}
+
+#endif
+
+uint8_t* MappedFile::getData( ) const
+{
+    return mData;
+}
+
+size_t MappedFile::getSize( ) const
+{
+    return mSize;
+}
+
+} // namespace cvl::core
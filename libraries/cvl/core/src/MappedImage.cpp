@@ -0,0 +1,133 @@
+// Own includes
+#include <cvl/core/MappedImage.h>
+
+// STD includes
+#include <cctype>
+#include <cstring>
+
+namespace cvl::core
+{
+namespace
+{
+/*
+ * Function that reads the next number of a PNM header. Whitespace and
+ * comments in front of the number are skipped.
+ */
+int32_t readPnmNumber( const uint8_t* data, size_t size, size_t& pos )
+{
+    while ( pos < size )
+    {
+        if ( data[ pos ] == '#' )
+        {
+            while ( pos < size && data[ pos ] != '\n' )
+            {
+                pos++;
+            }
+        }
+        else if ( std::isspace( data[ pos ] ) != 0 )
+        {
+            pos++;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    EXPECT_MSG( pos < size && std::isdigit( data[ pos ] ) != 0,
+                "Invalid PNM header" );
+
+    int64_t value { };
+
+    while ( pos < size && std::isdigit( data[ pos ] ) != 0 )
+    {
+        value = value * 10 + ( data[ pos ] - '0' );
+        pos++;
+
+        EXPECT_MSG( value <= std::numeric_limits< int32_t >::max( ),
+                    "Invalid PNM header" );
+    }
+
+    return static_cast< int32_t >( value );
+}
+
+ImageFileInfo readPnmInfo( const uint8_t* data, size_t size )
+{
+    ImageFileInfo info;
+    info.format = data[ 1 ] == '5' ? ImageFileFormat::Pgm : ImageFileFormat::Ppm;
+    info.channels = info.format == ImageFileFormat::Pgm ? 1 : 3;
+    info.interleaved = info.channels > 1;
+
+    size_t pos = 2;
+    const auto width = readPnmNumber( data, size, pos );
+    const auto height = readPnmNumber( data, size, pos );
+    const auto maxValue = readPnmNumber( data, size, pos );
+
+    // 16 bit PNM pixels are big endian and cannot be used without a copy
+    EXPECT_MSG( maxValue > 0 && maxValue < 256,
+                "Unsupported PNM maximum value(" << maxValue << ")" );
+
+    // A single whitespace separates the header from the pixels
+    EXPECT_MSG( pos < size && std::isspace( data[ pos ] ) != 0,
+                "Invalid PNM header" );
+
+    info.size = SizeI( width, height );
+    info.stride = static_cast< size_t >( width ) *
+                  static_cast< size_t >( info.channels );
+    info.dataOffset = pos + 1;
+
+    return info;
+}
+
+ImageFileInfo readCvlInfo( const uint8_t* data, size_t size )
+{
+    EXPECT_MSG( size >= sizeof( CvlImageHeader ), "Invalid cvl header" );
+
+    CvlImageHeader header;
+    std::memcpy( &header, data, sizeof( header ) );
+
+    EXPECT_MSG( header.version == CvlImageHeader::current_version,
+                "Unsupported cvl image version(" << header.version << ")" );
+
+    EXPECT_MSG( header.width >= 0 && header.height >= 0 &&
+                    header.channels > 0,
+                "Invalid cvl header" );
+
+    ImageFileInfo info;
+    info.format = ImageFileFormat::Cvl;
+    info.size = SizeI( header.width, header.height );
+    info.channels = header.channels;
+    info.elementSize = header.elementSize;
+    info.elementKind = header.elementKind;
+    info.interleaved = header.interleaved != 0;
+    info.stride = static_cast< size_t >( header.stride );
+    info.dataOffset = static_cast< size_t >( header.dataOffset );
+
+    return info;
+}
+} // namespace
+
+ImageFileInfo readImageFileInfo( const MappedFile& file )
+{
+    const auto* data = file.getData( );
+    const auto size = file.getSize( );
+
+    EXPECT_MSG( size >= 4, "File too small for an image header" );
+
+    if ( data[ 0 ] == 'P' && ( data[ 1 ] == '5' || data[ 1 ] == '6' ) )
+    {
+        return readPnmInfo( data, size );
+    }
+
+    uint32_t magic { };
+    std::memcpy( &magic, data, sizeof( magic ) );
+
+    if ( magic == CvlImageHeader::magic_number )
+    {
+        return readCvlInfo( data, size );
+    }
+
+    THROW_MSG( "Unknown image file format" );
+}
+
+} // namespace cvl::core
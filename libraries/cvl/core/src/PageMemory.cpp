@@ -0,0 +1,334 @@
+// Own includes
+#include <cvl/core/PageMemory.h>
+
+// CVL includes
+#include <cvl/core/Parallel.h>
+
+#if defined( _WIN32 )
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// STD includes
+#include <algorithm>
+#include <climits>
+#include <new>
+#include <vector>
+
+namespace cvl::core::detail
+{
+namespace
+{
+// The size of a huge page on x86-64 and ARM64 with 4 KiB pages
+constexpr size_t defaultHugePageSize = size_t { 2 } << 20;
+
+size_t roundUp( size_t value, size_t multiple )
+{
+    return ( value + multiple - 1 ) / multiple * multiple;
+}
+
+/*
+ * Function that writes one byte of each page with all threads. The node of a
+ * page is selected by the thread that touches it first.
+ */
+void touchPages( void* p, size_t bytes, size_t pageSize )
+{
+    auto* data = static_cast< uint8_t* >( p );
+
+    const auto chunkSize = std::max( pageSize, defaultHugePageSize );
+    const auto numberChunks =
+        static_cast< int32_t >( roundUp( bytes, chunkSize ) / chunkSize );
+
+    parallelFor( 0,
+                 numberChunks,
+                 [ & ]( int32_t chunk )
+                 {
+                     const auto begin = static_cast< size_t >( chunk ) *
+                                        chunkSize;
+                     const auto end = std::min( begin + chunkSize, bytes );
+
+                     for ( auto offset = begin; offset < end;
+                           offset += pageSize )
+                     {
+                         data[ offset ] = 0;
+                     }
+                 } );
+}
+} // namespace
+
+#if defined( _WIN32 )
+
+namespace
+{
+size_t getPageSize( )
+{
+    SYSTEM_INFO info { };
+    GetSystemInfo( &info );
+
+    return static_cast< size_t >( info.dwPageSize );
+}
+
+/*
+ * Windows has no transparent huge pages. Explicit huge pages are large pages,
+ * they need the lock pages in memory privilege.
+ */
+size_t getMappingSize( size_t bytes, const PageOptions& options )
+{
+    const auto largePageSize = static_cast< size_t >( GetLargePageMinimum( ) );
+
+    if ( options.hugePages == HugePages::Explicit && largePageSize > 0 )
+    {
+        return roundUp( bytes, largePageSize );
+    }
+
+    return roundUp( bytes, getPageSize( ) );
+}
+
+void* virtualAlloc( size_t size, DWORD type, int32_t node )
+{
+    if ( node >= 0 )
+    {
+        return VirtualAllocExNuma( GetCurrentProcess( ),
+                                   nullptr,
+                                   size,
+                                   type,
+                                   PAGE_READWRITE,
+                                   static_cast< DWORD >( node ) );
+    }
+
+    return VirtualAlloc( nullptr, size, type, PAGE_READWRITE );
+}
+} // namespace
+
+void* allocatePages( size_t bytes, size_t alignment,
+                     const PageOptions& options )
+{
+    SYSTEM_INFO info { };
+    GetSystemInfo( &info );
+
+    // VirtualAlloc aligns to the allocation granularity only
+    if ( alignment > static_cast< size_t >( info.dwAllocationGranularity ) )
+    {
+        throw std::bad_alloc( );
+    }
+
+    const auto size = getMappingSize( bytes, options );
+
+    void* p { };
+
+    if ( options.hugePages == HugePages::Explicit )
+    {
+        p = virtualAlloc(
+            size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, options.node );
+    }
+
+    if ( p == nullptr )
+    {
+        p = virtualAlloc( size, MEM_RESERVE | MEM_COMMIT, options.node );
+    }
+
+    if ( p == nullptr )
+    {
+        throw std::bad_alloc( );
+    }
+
+    if ( options.parallelFirstTouch )
+    {
+        touchPages( p, size, getPageSize( ) );
+    }
+
+    return p;
+}
+
+void deallocatePages( void* p, [[maybe_unused]] size_t bytes,
+                      [[maybe_unused]] const PageOptions& options )
+{
+    if ( p != nullptr )
+    {
+        VirtualFree( p, 0, MEM_RELEASE );
+    }
+}
+
+#else
+
+namespace
+{
+size_t getPageSize( )
+{
+    static const auto pageSize =
+        static_cast< size_t >( sysconf( _SC_PAGESIZE ) );
+
+    return pageSize;
+}
+
+/*
+ * The size of the mapping of an allocation. Allocations smaller than a huge
+ * page are not worth a transparent huge page.
+ */
+size_t getMappingSize( size_t bytes, const PageOptions& options )
+{
+    const auto useHugePages =
+        options.hugePages == HugePages::Explicit ||
+        ( options.hugePages == HugePages::Transparent &&
+          bytes >= defaultHugePageSize );
+
+    return roundUp( bytes,
+                    useHugePages ? defaultHugePageSize : getPageSize( ) );
+}
+
+/*
+ * Function that maps anonymous memory aligned to the boundary. More memory is
+ * mapped and the parts in front of and behind the boundary are unmapped
+ * again. The kernel only backs aligned memory with transparent huge pages.
+ */
+void* mapAligned( size_t size, size_t boundary )
+{
+    if ( boundary <= getPageSize( ) )
+    {
+        auto* p = mmap( nullptr,
+                        size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS,
+                        -1,
+                        0 );
+
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    auto* p = mmap( nullptr,
+                    size + boundary,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS,
+                    -1,
+                    0 );
+
+    if ( p == MAP_FAILED )
+    {
+        return nullptr;
+    }
+
+    const auto address = reinterpret_cast< uintptr_t >( p );
+    const auto alignedAddress = roundUp( address, boundary );
+    const auto front = alignedAddress - address;
+    const auto back = boundary - front;
+
+    if ( front > 0 )
+    {
+        munmap( p, front );
+    }
+
+    if ( back > 0 )
+    {
+        munmap( reinterpret_cast< void* >( alignedAddress + size ), back );
+    }
+
+    return reinterpret_cast< void* >( alignedAddress );
+}
+
+/*
+ * Function that binds the memory to a NUMA node. The call is made without
+ * libnuma, the binding is dropped if the node does not exist.
+ */
+void bindNode( [[maybe_unused]] void* p, [[maybe_unused]] size_t size,
+               [[maybe_unused]] int32_t node )
+{
+#if defined( SYS_mbind )
+    constexpr auto bitsPerMask = sizeof( unsigned long ) * CHAR_BIT;
+    constexpr int mpolBind = 2; // MPOL_BIND of linux/mempolicy.h
+
+    std::vector< unsigned long > mask(
+        static_cast< size_t >( node ) / bitsPerMask + 1 );
+
+    mask[ static_cast< size_t >( node ) / bitsPerMask ] |=
+        1UL << ( static_cast< size_t >( node ) % bitsPerMask );
+
+    // The kernel reads one bit less than the given maximum node
+    syscall( SYS_mbind,
+             p,
+             size,
+             mpolBind,
+             mask.data( ),
+             mask.size( ) * bitsPerMask + 1,
+             0 );
+#endif
+}
+} // namespace
+
+void* allocatePages( size_t bytes, size_t alignment,
+                     const PageOptions& options )
+{
+    const auto size = getMappingSize( bytes, options );
+    const auto useHugePages = size % defaultHugePageSize == 0 &&
+                              options.hugePages != HugePages::None;
+
+    void* p { };
+
+#if defined( MAP_HUGETLB )
+    if ( options.hugePages == HugePages::Explicit &&
+         alignment <= defaultHugePageSize )
+    {
+        p = mmap( nullptr,
+                  size,
+                  PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                  -1,
+                  0 );
+
+        p = p == MAP_FAILED ? nullptr : p;
+    }
+#endif
+
+    if ( p == nullptr )
+    {
+        // Without reserved huge pages the kernel may still use transparent
+        // huge pages
+        const auto boundary =
+            std::max( alignment,
+                      useHugePages ? defaultHugePageSize : getPageSize( ) );
+
+        p = mapAligned( size, boundary );
+
+        if ( p == nullptr )
+        {
+            throw std::bad_alloc( );
+        }
+
+#if defined( MADV_HUGEPAGE )
+        if ( useHugePages )
+        {
+            madvise( p, size, MADV_HUGEPAGE );
+        }
+#endif
+    }
+
+    // The binding must be set before the pages are touched
+    if ( options.node >= 0 )
+    {
+        bindNode( p, size, options.node );
+    }
+
+    if ( options.parallelFirstTouch )
+    {
+        touchPages( p, size, getPageSize( ) );
+    }
+
+    return p;
+}
+
+void deallocatePages( void* p, size_t bytes, const PageOptions& options )
+{
+    if ( p != nullptr )
+    {
+        munmap( p, getMappingSize( bytes, options ) );
+    }
+}
+
+#endif
+
+} // namespace cvl::core::detail
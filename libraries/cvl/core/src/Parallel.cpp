@@ -0,0 +1,147 @@
+// Own includes
+#include <cvl/core/Parallel.h>
+
+// STD includes
+#include <vector>
+IGNORE_WARNINGS_STD_PUSH
+#include <condition_variable>
+IGNORE_WARNINGS_POP
+
+namespace cvl::core
+{
+namespace
+{
+thread_local bool insideTask { };
+
+/*
+ * The workers wait for a task. A task is offered to a number of workers,
+ * each started worker claims one of them. The caller closes the task after
+ * its own run, so workers that did not start yet do not start anymore.
+ */
+class Workers
+{
+public:
+    CVT_DISABLE_COPY( Workers );
+    CVT_DISABLE_MOVE( Workers );
+
+    Workers( ) = default;
+
+    ~Workers( )
+    {
+        {
+            std::lock_guard< std::mutex > lock( mMutex );
+            mStop = true;
+        }
+
+        mWake.notify_all( );
+
+        for ( auto& thread : mThreads )
+        {
+            thread.join( );
+        }
+    }
+
+    void run( void ( *task )( void* ), void* context, int32_t numberWorkers )
+    {
+        // The workers are busy with the task of another thread, this task
+        // runs on the calling thread instead of waiting for them
+        std::unique_lock< std::mutex > runLock( mRunMutex, std::try_to_lock );
+
+        if ( ! runLock.owns_lock( ) )
+        {
+            insideTask = true;
+            task( context );
+            insideTask = false;
+
+            return;
+        }
+
+        {
+            std::lock_guard< std::mutex > lock( mMutex );
+
+            while ( static_cast< int32_t >( mThreads.size( ) ) <
+                    numberWorkers )
+            {
+                mThreads.emplace_back( [ this ]( ) { work( ); } );
+            }
+
+            mTask = task;
+            mContext = context;
+            mClaimed = 0;
+            mOffered = numberWorkers;
+        }
+
+        mWake.notify_all( );
+
+        insideTask = true;
+        task( context );
+        insideTask = false;
+
+        std::unique_lock< std::mutex > lock( mMutex );
+
+        mOffered = mClaimed;
+        mDone.wait( lock, [ this ]( ) { return mActive == 0; } );
+    }
+
+private:
+    void work( )
+    {
+        insideTask = true;
+
+        std::unique_lock< std::mutex > lock( mMutex );
+
+        while ( true )
+        {
+            mWake.wait( lock,
+                        [ this ]( ) { return mStop || mClaimed < mOffered; } );
+
+            if ( mStop )
+            {
+                return;
+            }
+
+            mClaimed++;
+            mActive++;
+
+            auto* task = mTask;
+            auto* context = mContext;
+
+            lock.unlock( );
+            task( context );
+            lock.lock( );
+
+            if ( --mActive == 0 )
+            {
+                mDone.notify_all( );
+            }
+        }
+    }
+
+    std::mutex mRunMutex;
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::condition_variable mDone;
+    std::vector< std::thread > mThreads;
+    void ( *mTask )( void* ) { };
+    void* mContext { };
+    int32_t mClaimed { };
+    int32_t mOffered { };
+    int32_t mActive { };
+    bool mStop { };
+};
+} // namespace
+
+void ThreadPool::run( void ( *task )( void* ), void* context,
+                      int32_t numberWorkers )
+{
+    static Workers workers;
+
+    workers.run( task, context, numberWorkers );
+}
+
+bool ThreadPool::isInsideTask( )
+{
+    return insideTask;
+}
+
+} // namespace cvl::core
@@ -0,0 +1,218 @@
+// Own includes
+#include <cvl/core/RegionRLE.h>
+
+// STD includes
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace cvl::core
+{
+namespace
+{
+/**
+ * Function that calculates the sum of squares 0^2 + 1^2 + ... + n^2.
+ */
+constexpr int64_t sumOfSquares( int64_t n )
+{
+    return n * ( n + 1 ) * ( 2 * n + 1 ) / 6;
+}
+} // namespace
+
+RegionRLE::RegionRLE( const SizeI& imageSize )
+    : mImageSize( imageSize )
+{
+}
+
+RegionRLE::RegionRLE( const SizeI& imageSize, std::vector< Run > runs )
+    : mImageSize( imageSize )
+    , mRuns( std::move( runs ) )
+{
+}
+
+RegionRLE::RegionRLE( const RegionRLE& other )
+    : mImageSize( other.mImageSize )
+    , mRuns( other.mRuns )
+{
+}
+
+RegionRLE::RegionRLE( RegionRLE&& other ) noexcept
+    : mImageSize( other.mImageSize )
+    , mRuns( std::move( other.mRuns ) )
+{
+}
+
+RegionRLE& RegionRLE::operator=( const RegionRLE& other )
+{
+    if ( this != &other )
+    {
+        mImageSize = other.mImageSize;
+        mRuns = other.mRuns;
+    }
+
+    return *this;
+}
+
+RegionRLE& RegionRLE::operator=( RegionRLE&& other ) noexcept
+{
+    if ( this != &other )
+    {
+        mImageSize = other.mImageSize;
+        mRuns = std::move( other.mRuns );
+    }
+
+    return *this;
+}
+
+bool RegionRLE::operator==( const RegionRLE& other ) const
+{
+    return mImageSize == other.mImageSize && mRuns == other.mRuns;
+}
+
+void RegionRLE::addRun( int32_t row, int32_t colStart, int32_t colEnd )
+{
+    EXPECT_MSG( colStart <= colEnd,
+                "Run start(" << colStart << ") is behind run end(" << colEnd
+                             << ")" );
+
+    EXPECT_MSG( mRuns.empty( ) || row > mRuns.back( ).row ||
+                    ( row == mRuns.back( ).row &&
+                      colStart > mRuns.back( ).colEnd ),
+                "Run(" << row << ", " << colStart << ", " << colEnd
+                       << ") is not located behind the last run" );
+
+    mRuns.push_back( { row, colStart, colEnd } );
+}
+
+void RegionRLE::reserve( size_t numberRuns )
+{
+    mRuns.reserve( numberRuns );
+}
+
+void RegionRLE::clear( )
+{
+    mRuns.clear( );
+}
+
+const std::vector< Run >& RegionRLE::getRuns( ) const
+{
+    return mRuns;
+}
+
+size_t RegionRLE::getNumberRuns( ) const
+{
+    return mRuns.size( );
+}
+
+SizeI RegionRLE::getImageSize( ) const
+{
+    return mImageSize;
+}
+
+void RegionRLE::setImageSize( const SizeI& imageSize )
+{
+    mImageSize = imageSize;
+}
+
+bool RegionRLE::isEmpty( ) const
+{
+    return mRuns.empty( );
+}
+
+bool RegionRLE::contains( int32_t row, int32_t column ) const
+{
+    // Find the first run that ends at or behind the pixel
+    const auto it = std::lower_bound(
+        mRuns.begin( ), mRuns.end( ), Run { row, column, column },
+        []( const Run& run, const Run& pixel )
+        {
+            return run.row < pixel.row ||
+                   ( run.row == pixel.row && run.colEnd < pixel.colStart );
+        } );
+
+    return it != mRuns.end( ) && it->row == row && it->colStart <= column;
+}
+
+int64_t RegionRLE::getArea( ) const
+{
+    int64_t area { };
+
+    for ( const auto& run : mRuns )
+    {
+        area += run.getLength( );
+    }
+
+    return area;
+}
+
+Rectangle< int32_t > RegionRLE::getBoundingBox( ) const
+{
+    if ( mRuns.empty( ) )
+    {
+        return { };
+    }
+
+    auto left = std::numeric_limits< int32_t >::max( );
+    auto right = std::numeric_limits< int32_t >::min( );
+
+    for ( const auto& run : mRuns )
+    {
+        left = std::min( left, run.colStart );
+        right = std::max( right, run.colEnd );
+    }
+
+    // Runs are sorted by row
+    const auto top = mRuns.front( ).row;
+    const auto bottom = mRuns.back( ).row;
+
+    return { Point2i( left, top ),
+             SizeI( right - left + 1, bottom - top + 1 ) };
+}
+
+Point2d RegionRLE::getCenter( ) const
+{
+    const auto moments = getMoments( );
+
+    if ( moments.m00 == 0.0 )
+    {
+        return { };
+    }
+
+    return Point2d( moments.m10 / moments.m00, moments.m01 / moments.m00 );
+}
+
+RegionMoments RegionRLE::getMoments( ) const
+{
+    int64_t m00 { };
+    int64_t m10 { };
+    int64_t m01 { };
+    int64_t m20 { };
+    int64_t m11 { };
+    int64_t m02 { };
+
+    for ( const auto& run : mRuns )
+    {
+        const int64_t y = run.row;
+        const int64_t length = run.getLength( );
+
+        // Closed form sums over the columns colStart to colEnd
+        const int64_t sumX =
+            ( static_cast< int64_t >( run.colStart ) + run.colEnd ) * length /
+            2;
+        const int64_t sumXX =
+            sumOfSquares( run.colEnd ) - sumOfSquares( run.colStart - 1 );
+
+        m00 += length;
+        m10 += sumX;
+        m01 += y * length;
+        m20 += sumXX;
+        m11 += y * sumX;
+        m02 += y * y * length;
+    }
+
+    return { static_cast< double >( m00 ), static_cast< double >( m10 ),
+             static_cast< double >( m01 ), static_cast< double >( m20 ),
+             static_cast< double >( m11 ), static_cast< double >( m02 ) };
+}
+
+} // namespace cvl::core
@@ -0,0 +1,182 @@
+// Own includes
+#include <cvl/core/ScratchArena.h>
+
+// CVL includes
+#include <cvl/core/Error.h>
+
+namespace cvl::core
+{
+
+//
+// Scope
+//
+
+ScratchArena::Scope::Scope( ScratchArena& arena )
+    : mArena( arena )
+    , mBlock( arena.mBlock )
+    , mOffset( arena.mOffset )
+{
+    mArena.mScopeDepth++;
+}
+
+ScratchArena::Scope::~Scope( )
+{
+    mArena.mScopeDepth--;
+    mArena.rewind( mBlock, mOffset );
+}
+
+//
+// ScratchArena
+//
+
+ScratchArena::ScratchArena(
+    size_t blockSize /*= size_t { 1 } << 20*/,
+    std::pmr::memory_resource* upstream /*= get_default_resource( )*/ )
+    : mUpstream( upstream )
+    , mBlockSize( std::max< size_t >( blockSize, 64 ) )
+{
+    EXPECT_MSG( upstream != nullptr, "Upstream resource is invalid" );
+}
+
+ScratchArena::~ScratchArena( )
+{
+    release( );
+}
+
+ScratchArena& ScratchArena::getThreadArena( )
+{
+    thread_local ScratchArena arena;
+
+    return arena;
+}
+
+void ScratchArena::reset( )
+{
+    EXPECT_MSG( mScopeDepth == 0, "Cannot reset the arena inside a scope" );
+
+    rewind( 0, 0 );
+}
+
+void ScratchArena::release( )
+{
+    EXPECT_MSG( mScopeDepth == 0, "Cannot release the arena inside a scope" );
+
+    for ( const auto& block : mBlocks )
+    {
+        mUpstream->deallocate( block.data, block.size );
+    }
+
+    mBlocks.clear( );
+    mBlock = 0;
+    mOffset = 0;
+}
+
+size_t ScratchArena::getCapacity( ) const noexcept
+{
+    size_t capacity { };
+
+    for ( const auto& block : mBlocks )
+    {
+        capacity += block.size;
+    }
+
+    return capacity;
+}
+
+size_t ScratchArena::getUsed( ) const noexcept
+{
+    size_t used { mOffset };
+
+    for ( size_t i = 0; i < mBlock && i < mBlocks.size( ); i++ )
+    {
+        used += mBlocks[ i ].size;
+    }
+
+    return used;
+}
+
+size_t ScratchArena::getUpstreamAllocations( ) const noexcept
+{
+    return mUpstreamAllocations;
+}
+
+void* ScratchArena::do_allocate( size_t bytes, size_t alignment )
+{
+    // Blocks behind the current one are reused before a new one is allocated.
+    // A block too small for the request is skipped.
+    for ( ; mBlock < mBlocks.size( ); mBlock++, mOffset = 0 )
+    {
+        const auto& block = mBlocks[ mBlock ];
+        const auto address = reinterpret_cast< uintptr_t >( block.data );
+        const auto aligned =
+            ( address + mOffset + alignment - 1 ) & ~( alignment - 1 );
+        const auto offset = static_cast< size_t >( aligned - address );
+
+        if ( offset + bytes <= block.size )
+        {
+            mOffset = offset + bytes;
+
+            return block.data + offset;
+        }
+    }
+
+    // Growing geometrically limits the number of blocks of the first run
+    const auto lastSize = mBlocks.empty( ) ? size_t { } : mBlocks.back( ).size;
+    const auto size =
+        std::max( { mBlockSize, 2 * lastSize, bytes + alignment } );
+
+    auto* data = static_cast< std::byte* >(
+        mUpstream->allocate( size, alignof( std::max_align_t ) ) );
+
+    mUpstreamAllocations++;
+    mBlocks.push_back( { data, size } );
+    mBlock = mBlocks.size( ) - 1;
+    mOffset = 0;
+
+    return do_allocate( bytes, alignment );
+}
+
+void ScratchArena::do_deallocate( [[maybe_unused]] void* p,
+                                  [[maybe_unused]] size_t bytes,
+                                  [[maybe_unused]] size_t alignment )
+{
+    // The memory is given back by rewinding the arena
+}
+
+bool ScratchArena::do_is_equal(
+    const std::pmr::memory_resource& other ) const noexcept
+{
+    return this == &other;
+}
+
+void ScratchArena::rewind( size_t block, size_t offset )
+{
+    mBlock = block;
+    mOffset = offset;
+
+    if ( mScopeDepth == 0 && block == 0 && offset == 0 )
+    {
+        mergeBlocks( );
+    }
+}
+
+void ScratchArena::mergeBlocks( )
+{
+    if ( mBlocks.size( ) < 2 )
+    {
+        return;
+    }
+
+    // The next run fits into one block
+    const auto size = getCapacity( );
+
+    release( );
+
+    auto* data = static_cast< std::byte* >(
+        mUpstream->allocate( size, alignof( std::max_align_t ) ) );
+
+    mUpstreamAllocations++;
+    mBlocks.push_back( { data, size } );
+}
+
+} // namespace cvl::core
@@ -0,0 +1,253 @@
+// Own includes
+#include <cvl/core/StatsMemoryResource.h>
+
+// CVL includes
+#include <cvl/core/Error.h>
+
+// STD includes
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <utility>
+IGNORE_WARNINGS_STD_PUSH
+#include <mutex>
+IGNORE_WARNINGS_POP
+
+namespace cvl::core
+{
+namespace
+{
+/*
+ * The registry of all resources. The lock is only taken on construction,
+ * destruction and export, never on allocation.
+ */
+struct Registry
+{
+    std::mutex mutex;
+    std::vector< const StatsMemoryResource* > resources;
+};
+
+Registry& getRegistry( )
+{
+    static Registry registry;
+
+    return registry;
+}
+
+/*
+ * Function that adds the counters of a snapshot with the same tag
+ */
+void merge( AllocationStats& stats, const AllocationStats& other )
+{
+    stats.liveBytes += other.liveBytes;
+    stats.peakBytes = std::max( stats.peakBytes, other.peakBytes );
+    stats.allocations += other.allocations;
+    stats.deallocations += other.deallocations;
+    stats.allocatedBytes += other.allocatedBytes;
+
+    for ( size_t i = 0; i < stats.sizeClasses.size( ); i++ )
+    {
+        stats.sizeClasses[ i ] += other.sizeClasses[ i ];
+    }
+}
+} // namespace
+
+//
+// AllocationStats
+//
+
+size_t AllocationStats::getSizeClass( size_t bytes ) noexcept
+{
+    if ( bytes <= 64 )
+    {
+        return 0;
+    }
+
+    // 65 to 128 bytes is class 1, 129 to 256 bytes is class 2, ...
+    const auto sizeClass =
+        static_cast< size_t >( std::bit_width( ( bytes - 1 ) >> 6 ) );
+
+    return std::min( sizeClass, number_size_classes - 1 );
+}
+
+size_t AllocationStats::getSizeClassLimit( size_t sizeClass ) noexcept
+{
+    if ( sizeClass >= number_size_classes - 1 )
+    {
+        return std::numeric_limits< size_t >::max( );
+    }
+
+    return size_t { 64 } << sizeClass;
+}
+
+std::ostream& operator<<( std::ostream& os, const AllocationStats& stats )
+{
+    os << "[" << stats.tag << "] live: " << stats.liveBytes
+       << " peak: " << stats.peakBytes
+       << " allocations: " << stats.allocations
+       << " deallocations: " << stats.deallocations
+       << " allocated: " << stats.allocatedBytes << " sizes:";
+
+    for ( size_t i = 0; i < stats.sizeClasses.size( ); i++ )
+    {
+        if ( stats.sizeClasses[ i ] == 0 )
+        {
+            continue;
+        }
+
+        os << " ";
+
+        if ( i == AllocationStats::number_size_classes - 1 )
+        {
+            os << ">" << AllocationStats::getSizeClassLimit( i - 1 );
+        }
+        else
+        {
+            os << "<=" << AllocationStats::getSizeClassLimit( i );
+        }
+
+        os << ":" << stats.sizeClasses[ i ];
+    }
+
+    return os;
+}
+
+//
+// StatsMemoryResource
+//
+
+StatsMemoryResource::StatsMemoryResource(
+    std::string tag,
+    std::pmr::memory_resource* upstream /*= get_default_resource( )*/ )
+    : mTag( std::move( tag ) )
+    , mUpstream( upstream )
+{
+    EXPECT_MSG( upstream != nullptr, "Upstream resource is invalid" );
+
+    auto& registry = getRegistry( );
+    std::lock_guard lock( registry.mutex );
+
+    registry.resources.push_back( this );
+}
+
+StatsMemoryResource::~StatsMemoryResource( )
+{
+    auto& registry = getRegistry( );
+    std::lock_guard lock( registry.mutex );
+
+    std::erase( registry.resources, this );
+}
+
+AllocationStats StatsMemoryResource::getSnapshot( ) const
+{
+    AllocationStats stats;
+    stats.tag = mTag;
+    stats.liveBytes = mLiveBytes.load( std::memory_order_relaxed );
+    stats.peakBytes = mPeakBytes.load( std::memory_order_relaxed );
+    stats.allocations = mAllocations.load( std::memory_order_relaxed );
+    stats.deallocations = mDeallocations.load( std::memory_order_relaxed );
+    stats.allocatedBytes = mAllocatedBytes.load( std::memory_order_relaxed );
+
+    for ( size_t i = 0; i < mSizeClasses.size( ); i++ )
+    {
+        stats.sizeClasses[ i ] =
+            mSizeClasses[ i ].load( std::memory_order_relaxed );
+    }
+
+    return stats;
+}
+
+std::vector< AllocationStats > StatsMemoryResource::getAllSnapshots( )
+{
+    auto& registry = getRegistry( );
+    std::lock_guard lock( registry.mutex );
+
+    std::vector< AllocationStats > snapshots;
+    snapshots.reserve( registry.resources.size( ) );
+
+    for ( const auto* resource : registry.resources )
+    {
+        auto stats = resource->getSnapshot( );
+
+        const auto it = std::ranges::find(
+            snapshots, stats.tag, &AllocationStats::tag );
+
+        if ( it != snapshots.end( ) )
+        {
+            merge( *it, stats );
+        }
+        else
+        {
+            snapshots.push_back( std::move( stats ) );
+        }
+    }
+
+    return snapshots;
+}
+
+void StatsMemoryResource::resetCounters( )
+{
+    mPeakBytes.store( mLiveBytes.load( std::memory_order_relaxed ),
+                      std::memory_order_relaxed );
+    mAllocations.store( 0, std::memory_order_relaxed );
+    mDeallocations.store( 0, std::memory_order_relaxed );
+    mAllocatedBytes.store( 0, std::memory_order_relaxed );
+
+    for ( auto& sizeClass : mSizeClasses )
+    {
+        sizeClass.store( 0, std::memory_order_relaxed );
+    }
+}
+
+const std::string& StatsMemoryResource::getTag( ) const noexcept
+{
+    return mTag;
+}
+
+std::pmr::memory_resource* StatsMemoryResource::getUpstream( ) const noexcept
+{
+    return mUpstream;
+}
+
+void* StatsMemoryResource::do_allocate( size_t bytes, size_t alignment )
+{
+    auto* p = mUpstream->allocate( bytes, alignment );
+
+    const auto size = static_cast< int64_t >( bytes );
+    const auto liveBytes =
+        mLiveBytes.fetch_add( size, std::memory_order_relaxed ) + size;
+
+    // The peak is only written if it grows
+    auto peakBytes = mPeakBytes.load( std::memory_order_relaxed );
+
+    while ( liveBytes > peakBytes &&
+            ! mPeakBytes.compare_exchange_weak(
+                peakBytes, liveBytes, std::memory_order_relaxed ) )
+    {
+    }
+
+    mAllocations.fetch_add( 1, std::memory_order_relaxed );
+    mAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+    mSizeClasses[ AllocationStats::getSizeClass( bytes ) ].fetch_add(
+        1, std::memory_order_relaxed );
+
+    return p;
+}
+
+void StatsMemoryResource::do_deallocate( void* p, size_t bytes,
+                                         size_t alignment )
+{
+    mUpstream->deallocate( p, bytes, alignment );
+
+    mLiveBytes.fetch_sub( static_cast< int64_t >( bytes ),
+                          std::memory_order_relaxed );
+    mDeallocations.fetch_add( 1, std::memory_order_relaxed );
+}
+
+bool StatsMemoryResource::do_is_equal(
+    const std::pmr::memory_resource& other ) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace cvl::core
@@ -1,5 +1,7 @@
 // CVL includes
 #include <cvl/core/AlignedAllocator.h>
+#include <cvl/core/Image.h>
+#include <cvl/core/PageMemory.h>
 #include <cvl/core/macros.h>
 
 // STD includes
@@ -196,4 +198,80 @@ TYPED_TEST( TestCvlCoreAlignedAllocator, Check64ByteAligned )
     const auto adr = reinterpret_cast< uintptr_t >( buffer ) % BYTE_ALIGNMENT;
 
     EXPECT_EQ( adr, 0 );
-}
\ No newline at end of file
+}
+
+TEST( TestCvlCoreAlignedAllocator, RebindKeepsPolicy )
+{
+    using Allocator =
+        AlignedAllocator< uint8_t, 4096, PageMemory< HugePages::None > >;
+    using Rebound = std::allocator_traits< Allocator >::rebind_alloc< float >;
+
+    EXPECT_TRUE( ( std::is_same_v<
+                   Rebound,
+                   AlignedAllocator< float, 4096,
+                                     PageMemory< HugePages::None > > > ) );
+    EXPECT_EQ( Rebound::alignment( ), 4096 );
+}
+
+TEST( TestCvlCoreAlignedAllocator, HeapMemoryOddSize )
+{
+    // The size is not a multiple of the alignment
+    AlignedAllocator< uint8_t, 256 > allocator;
+    auto buffer = allocator.allocate( 1000 );
+
+    ASSERT_NE( buffer, nullptr );
+    EXPECT_EQ( reinterpret_cast< uintptr_t >( buffer ) % 256, 0 );
+
+    allocator.deallocate( buffer, 1000 );
+}
+
+TEST( TestCvlCoreAlignedAllocator, PageMemory )
+{
+    constexpr size_t numElements = ( size_t { 4 } << 20 ) + 3;
+
+    const auto check = [ & ]( auto allocator )
+    {
+        auto buffer = allocator.allocate( numElements );
+
+        ASSERT_NE( buffer, nullptr );
+        EXPECT_EQ( reinterpret_cast< uintptr_t >( buffer ) % 64, 0 );
+
+        // The pages are zero initialized
+        EXPECT_EQ( buffer[ 0 ], 0 );
+        EXPECT_EQ( buffer[ numElements - 1 ], 0 );
+
+        buffer[ 0 ] = 1;
+        buffer[ numElements - 1 ] = 2;
+
+        EXPECT_NO_THROW( allocator.deallocate( buffer, numElements ) );
+    };
+
+    check( AlignedAllocator< uint8_t, 64, PageMemory< HugePages::None > >( ) );
+    check( AlignedAllocator< uint8_t, 64,
+                             PageMemory< HugePages::Transparent > >( ) );
+    check(
+        AlignedAllocator< uint8_t, 64, PageMemory< HugePages::Explicit > >( ) );
+
+    // The binding is dropped if the node does not exist
+    check(
+        AlignedAllocator< uint8_t, 64,
+                          PageMemory< HugePages::Transparent, 0, true > >( ) );
+    check( AlignedAllocator< uint8_t, 64,
+                             PageMemory< HugePages::None, 1000, true > >( ) );
+}
+
+TEST( TestCvlCoreAlignedAllocator, PageMemoryImage )
+{
+    using Allocator = AlignedAllocator< uint16_t, 64,
+                                        PageMemory< HugePages::Transparent > >;
+
+    Image< uint16_t, 1, Allocator > image( 1500, 1000, true );
+
+    image.at( 999, 1499 ) = 42;
+
+    const auto roi = image( Rectangle( Point2i { 1000, 900 }, { 500, 100 } ) );
+    image = Image< uint16_t, 1, Allocator >( );
+
+    EXPECT_EQ( roi.at( 99, 499 ), 42 );
+    EXPECT_EQ( roi.at( 0, 0 ), 0 );
+}
@@ -0,0 +1,44 @@
+// CVL includes
+#include <cvl/core/CpuFeatures.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <sstream>
+
+using namespace cvl::core;
+
+TEST( TestCvlCoreCpuFeatures, SimdLevelSupported )
+{
+    const auto level = getSimdLevel( );
+
+    EXPECT_EQ( level, getSimdLevel( ) );
+
+    EXPECT_TRUE( isSimdLevelSupported( SimdLevel::Scalar ) );
+    EXPECT_TRUE( isSimdLevelSupported( level ) );
+
+    for ( const auto other : { SimdLevel::Scalar, SimdLevel::SSE2,
+                               SimdLevel::AVX2, SimdLevel::AVX512 } )
+    {
+        EXPECT_EQ( isSimdLevelSupported( other ),
+                   static_cast< int32_t >( other ) <=
+                       static_cast< int32_t >( level ) );
+    }
+
+#if CVL_ARCH_X86 && ( defined( __x86_64__ ) || defined( _M_X64 ) )
+    // SSE2 is part of the x86-64 base instruction set
+    EXPECT_TRUE( isSimdLevelSupported( SimdLevel::SSE2 ) );
+#endif
+}
+
+TEST( TestCvlCoreCpuFeatures, SimdLevelStream )
+{
+    std::stringstream stream;
+    stream << SimdLevel::AVX2;
+
+    EXPECT_EQ( stream.str( ), "AVX2" );
+}
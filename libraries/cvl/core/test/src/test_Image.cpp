@@ -773,4 +773,175 @@ TYPED_TEST( TestCvlCoreImage, FillImgae )
             EXPECT_EQ( rowPtr[ x ], TypeParam { 5 } );
         }
     }
-}
\ No newline at end of file
+}
+
+TYPED_TEST( TestCvlCoreImage, AccessAt3ChannelInterleavedTyped )
+{
+    constexpr int32_t width = 16;
+    constexpr int32_t height = 16;
+
+    Image< TypeParam, 3, AlignedAllocator< TypeParam >, InterleavedLayout >
+        image( width, height, true );
+
+    EXPECT_EQ( image.getStride( ), width * 3 );
+    EXPECT_EQ( image.pixel_step, 3 );
+
+    // The channels of a pixel are next to each other
+    auto data = image.getData( ) + image.getStride( );
+
+    data[ 0 ] = TypeParam { 100 };
+    data[ 1 ] = TypeParam { 101 };
+    data[ 2 ] = TypeParam { 102 };
+    data[ 3 ] = TypeParam { 103 };
+
+    EXPECT_EQ( image.at( 1, 0, 0 ), TypeParam { 100 } );
+    EXPECT_EQ( image.at( 1, 0, 1 ), TypeParam { 101 } );
+    EXPECT_EQ( image.at( 1, 0, 2 ), TypeParam { 102 } );
+    EXPECT_EQ( image.at( 1, 1, 0 ), TypeParam { 103 } );
+
+    const auto rowPtr = image.getRowPointer( 1, 1 );
+
+    EXPECT_EQ( rowPtr[ 0 ], TypeParam { 101 } );
+    EXPECT_EQ( rowPtr - data, 1 );
+}
+
+TYPED_TEST( TestCvlCoreImage, CloneInterleavedRoi )
+{
+    using ImageType =
+        Image< TypeParam, 3, AlignedAllocator< TypeParam >, InterleavedLayout >;
+
+    ImageType image( 12, 10, true );
+
+    for ( int32_t y = 0; y < image.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < image.getWidth( ); x++ )
+        {
+            for ( int32_t c = 0; c < 3; c++ )
+            {
+                image.at( y, x, c ) = static_cast< TypeParam >( x + y + c );
+            }
+        }
+    }
+
+    const auto imageRoi = image( Rectangle( Point2i { 3, 2 }, { 5, 4 } ) );
+
+    EXPECT_EQ( imageRoi.getStride( ), image.getStride( ) );
+    EXPECT_EQ( imageRoi.at( 0, 0, 2 ), image.at( 2, 3, 2 ) );
+
+    const auto imageClone = imageRoi.clone( );
+
+    EXPECT_EQ( imageClone.getSize( ), SizeI( 5, 4 ) );
+    EXPECT_EQ( imageClone.getStride( ), 5 * 3 );
+
+    for ( int32_t y = 0; y < imageClone.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < imageClone.getWidth( ); x++ )
+        {
+            for ( int32_t c = 0; c < 3; c++ )
+            {
+                EXPECT_EQ( imageClone.at( y, x, c ), imageRoi.at( y, x, c ) );
+            }
+        }
+    }
+}
+
+TYPED_TEST( TestCvlCoreImage, RowAlignment )
+{
+    using ImageType =
+        Image< TypeParam, 3, std::allocator< TypeParam >, PlanarLayout,
+               Avx512Rows >;
+
+    for ( const auto width : { 1, 17, 64, 65, 100 } )
+    {
+        const ImageType image( width, 7, true );
+
+        EXPECT_GE( image.getStride( ), width );
+        EXPECT_EQ( image.getStrideInBytes( ) % Avx512Rows::bytes, 0U );
+        EXPECT_TRUE( image.isRowAligned( ) );
+
+        for ( int32_t c = 0; c < 3; c++ )
+        {
+            for ( int32_t y = 0; y < image.getHeight( ); y++ )
+            {
+                EXPECT_TRUE(
+                    Avx512Rows::isAligned( image.getRowPointer( y, c ) ) );
+            }
+        }
+    }
+
+    const Image< TypeParam, 1 > imagePacked( 17, 3 );
+
+    EXPECT_EQ( imagePacked.getStride( ), 17 );
+}
+
+TYPED_TEST( TestCvlCoreImage, RowAlignmentRoiClone )
+{
+    using ImageType = Image< TypeParam, 1, AlignedAllocator< TypeParam >,
+                             PlanarLayout, Avx2Rows >;
+
+    ImageType image( 50, 10, true );
+
+    for ( int32_t y = 0; y < image.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < image.getWidth( ); x++ )
+        {
+            image.at( y, x ) = static_cast< TypeParam >( x + y );
+        }
+    }
+
+    // The ROI keeps the stride, its rows start at the left column
+    const auto imageRoi = image( Rectangle( Point2i { 3, 2 }, { 21, 5 } ) );
+
+    EXPECT_EQ( imageRoi.getStride( ), image.getStride( ) );
+    EXPECT_FALSE( imageRoi.isRowAligned( ) );
+
+    const auto imageClone = imageRoi.clone( );
+
+    ImageType imageCopy( 21, 5 );
+    imageRoi.copyTo( imageCopy );
+
+    EXPECT_TRUE( imageClone.isRowAligned( ) );
+    EXPECT_TRUE( imageCopy.isRowAligned( ) );
+
+    for ( int32_t y = 0; y < imageRoi.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < imageRoi.getWidth( ); x++ )
+        {
+            EXPECT_EQ( imageClone.at( y, x ), imageRoi.at( y, x ) );
+            EXPECT_EQ( imageCopy.at( y, x ), imageRoi.at( y, x ) );
+        }
+    }
+}
+
+TYPED_TEST( TestCvlCoreImage, RowAlignmentEqualIgnoresPadding )
+{
+    using ImageType = Image< TypeParam, 3, AlignedAllocator< TypeParam >,
+                             PlanarLayout, Avx2Rows >;
+
+    ImageType image( 5, 4, true );
+    image.at( 2, 3, 1 ) = TypeParam { 7 };
+
+    auto imageClone = image.clone( );
+
+    // The padding behind the last pixel of each row differs
+    for ( int32_t c = 0; c < 3; c++ )
+    {
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 5; x < image.getStride( ); x++ )
+            {
+                image.getRowPointer( y, c )[ x ] = TypeParam { 1 };
+                imageClone.getRowPointer( y, c )[ x ] = TypeParam { 2 };
+            }
+        }
+    }
+
+    EXPECT_TRUE( image == imageClone );
+
+    imageClone.at( 3, 4, 2 ) = TypeParam { 9 };
+
+    EXPECT_FALSE( image == imageClone );
+
+    // Images without pixels have no stride
+    EXPECT_EQ( ImageType::calculateStride( 0 ), 0 );
+}
@@ -0,0 +1,210 @@
+// CVL includes
+#include <cvl/core/Image.h>
+#include <cvl/core/ImageBuffer.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace cvl::core;
+
+namespace
+{
+int32_t numberAllocations { };
+int32_t numberDeallocations { };
+
+template < typename T >
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator( ) noexcept = default;
+
+    template < typename U >
+    CountingAllocator( const CountingAllocator< U >& ) noexcept
+    {
+    }
+
+    T* allocate( size_t elements )
+    {
+        numberAllocations++;
+        return std::allocator< T >( ).allocate( elements );
+    }
+
+    void deallocate( T* data, size_t elements )
+    {
+        numberDeallocations++;
+        std::allocator< T >( ).deallocate( data, elements );
+    }
+
+    template < typename U >
+    bool operator==( const CountingAllocator< U >& ) const noexcept
+    {
+        return true;
+    }
+};
+
+class TestBuffer : public ImageBuffer
+{
+public:
+    explicit TestBuffer( int32_t& releaseCount )
+        : ImageBuffer( &TestBuffer::release )
+        , mReleaseCount( releaseCount )
+    {
+    }
+
+private:
+    static void release( ImageBuffer* buffer )
+    {
+        static_cast< TestBuffer* >( buffer )->mReleaseCount++;
+    }
+
+    int32_t& mReleaseCount;
+};
+} // namespace
+
+TEST( TestCvlCoreImageBuffer, ReferenceCount )
+{
+    int32_t releaseCount { };
+    TestBuffer buffer( releaseCount );
+
+    {
+        ImageBufferPointer pointer( &buffer );
+        EXPECT_EQ( buffer.getReferenceCount( ), 1 );
+
+        {
+            const auto copy = pointer;
+            EXPECT_EQ( buffer.getReferenceCount( ), 2 );
+
+            const auto moved = std::move( pointer );
+            EXPECT_EQ( buffer.getReferenceCount( ), 2 );
+            EXPECT_FALSE( pointer );
+            EXPECT_EQ( moved.get( ), &buffer );
+        }
+
+        EXPECT_EQ( buffer.getReferenceCount( ), 0 );
+        EXPECT_EQ( releaseCount, 1 );
+    }
+
+    EXPECT_EQ( releaseCount, 1 );
+}
+
+TEST( TestCvlCoreImageBuffer, Assignment )
+{
+    int32_t releaseCount { };
+    TestBuffer buffer( releaseCount );
+    TestBuffer bufferOther( releaseCount );
+
+    ImageBufferPointer pointer( &buffer );
+    ImageBufferPointer pointerOther( &bufferOther );
+
+    pointer = pointerOther;
+
+    EXPECT_EQ( releaseCount, 1 );
+    EXPECT_EQ( bufferOther.getReferenceCount( ), 2 );
+
+    const auto& self = pointer;
+    pointer = self;
+
+    EXPECT_EQ( bufferOther.getReferenceCount( ), 2 );
+
+    pointer.reset( );
+    pointerOther.reset( );
+
+    EXPECT_EQ( releaseCount, 2 );
+}
+
+TEST( TestCvlCoreImageBuffer, Shared )
+{
+    Image< uint8_t, 1 > image( 16, 8 );
+    EXPECT_FALSE( image.isShared( ) );
+
+    {
+        const auto copy = image;
+        EXPECT_TRUE( image.isShared( ) );
+
+        const auto roi = image( Rectangle( Point2i { 2, 2 }, { 4, 4 } ) );
+        EXPECT_TRUE( roi.isShared( ) );
+    }
+
+    EXPECT_FALSE( image.isShared( ) );
+    EXPECT_FALSE( image.clone( ).isShared( ) );
+
+    // An image without buffer cannot tell
+    const Image< uint8_t, 1 > imageEmpty;
+    EXPECT_TRUE( imageEmpty.isShared( ) );
+}
+
+TEST( TestCvlCoreImageBuffer, SingleAllocation )
+{
+    numberAllocations = 0;
+    numberDeallocations = 0;
+
+    {
+        const Image< uint16_t, 3, CountingAllocator< uint16_t > > image(
+            37, 11, true );
+
+        EXPECT_EQ( numberAllocations, 1 );
+
+        // Copies and ROIs only reference the buffer
+        const auto copy = image;
+        const auto roi = image(
+            Rectangle< int32_t >( Point2i( 3, 2 ), SizeI( 10, 5 ) ) );
+        const auto roiCopy = roi;
+
+        EXPECT_EQ( numberAllocations, 1 );
+        EXPECT_EQ( numberDeallocations, 0 );
+        EXPECT_EQ( roiCopy.at( 4, 9, 2 ), 0 );
+    }
+
+    EXPECT_EQ( numberAllocations, 1 );
+    EXPECT_EQ( numberDeallocations, 1 );
+}
+
+TEST( TestCvlCoreImageBuffer, DataAlignment )
+{
+    // The header is padded, so the pixels keep the alignment of the buffer
+    const Image< uint8_t, 1 > image( 13, 7 );
+    const Image< double, 1 > imageDouble( 13, 7 );
+
+    EXPECT_EQ( reinterpret_cast< uintptr_t >( image.getData( ) ) % 64, 0U );
+    EXPECT_EQ( reinterpret_cast< uintptr_t >( imageDouble.getData( ) ) % 64,
+               0U );
+}
+
+TEST( TestCvlCoreImageBuffer, ExternalBuffer )
+{
+    // E.g. a buffer of a camera SDK, requeued on release
+    std::vector< uint8_t > frame( 40 * 10, uint8_t { 7 } );
+    int32_t releaseCount { };
+
+    {
+        Image< uint8_t, 1 > image( 32,
+                                   10,
+                                   frame.data( ),
+                                   40,
+                                   [ &releaseCount ]( ) { releaseCount++; } );
+
+        EXPECT_EQ( image.getData( ), frame.data( ) );
+        EXPECT_EQ( image.getStride( ), 40 );
+
+        const auto roi = image(
+            Rectangle< int32_t >( Point2i( 3, 2 ), SizeI( 10, 5 ) ) );
+
+        // The image is gone, the ROI still references the buffer
+        image = Image< uint8_t, 1 >( );
+
+        EXPECT_EQ( releaseCount, 0 );
+        EXPECT_EQ( roi.at( 4, 9 ), 7 );
+    }
+
+    EXPECT_EQ( releaseCount, 1 );
+}
@@ -0,0 +1,245 @@
+// CVL includes
+#include <cvl/core/ImagePool.h>
+#include <cvl/core/Parallel.h>
+#include <cvl/core/StatsMemoryResource.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <memory>
+#include <vector>
+
+using namespace cvl::core;
+
+TEST( TestCvlCoreImagePool, Acquire )
+{
+    ImagePool pool;
+
+    const auto image = pool.acquire< uint16_t, 3 >( SizeI( 33, 17 ), true );
+
+    EXPECT_EQ( image.getSize( ), SizeI( 33, 17 ) );
+    EXPECT_NE( image.getData( ), nullptr );
+    EXPECT_EQ( pool.getNumberAllocations( ), 1U );
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 0U );
+
+    for ( int32_t c = 0; c < 3; c++ )
+    {
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                ASSERT_EQ( image.at( y, x, c ), 0 );
+            }
+        }
+    }
+}
+
+TEST( TestCvlCoreImagePool, RowAlignment )
+{
+    ImagePool pool;
+
+    const auto image = pool.acquire< uint8_t,
+                                     1,
+                                     std::allocator< uint8_t >,
+                                     PlanarLayout,
+                                     Avx512Rows >( SizeI( 33, 17 ), true );
+
+    EXPECT_EQ( image.getStride( ), 64 );
+    EXPECT_TRUE( image.isRowAligned( ) );
+
+    // Packed and aligned images do not share buffers
+    const auto imagePacked = pool.acquire< uint8_t, 1 >( SizeI( 33, 17 ) );
+
+    EXPECT_EQ( imagePacked.getStride( ), 33 );
+    EXPECT_EQ( pool.getNumberAllocations( ), 2U );
+}
+
+TEST( TestCvlCoreImagePool, Reuse )
+{
+    ImagePool pool;
+    const SizeI size( 64, 48 );
+
+    uint8_t* data { };
+
+    {
+        const auto image = pool.acquire< uint8_t, 1 >( size );
+        data = image.getData( );
+
+        // Copies and ROIs share the buffer
+        const auto copy = image;
+        const auto roi = image( Rectangle< int32_t >( Point2i( 1, 2 ),
+                                                      SizeI( 10, 10 ) ) );
+
+        EXPECT_EQ( pool.getNumberCachedBuffers( ), 0U );
+    }
+
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 1U );
+    EXPECT_EQ( pool.getCachedBytes( ), 64U * 48U );
+
+    const auto image = pool.acquire< uint8_t, 1 >( size );
+
+    EXPECT_EQ( image.getData( ), data );
+    EXPECT_EQ( pool.getNumberAllocations( ), 1U );
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 0U );
+}
+
+TEST( TestCvlCoreImagePool, Key )
+{
+    ImagePool pool;
+
+    {
+        const auto image = pool.acquire< uint8_t, 1 >( SizeI( 16, 16 ) );
+
+        // Different size, pixel type, channel count or allocator type
+        const auto imageSize = pool.acquire< uint8_t, 1 >( SizeI( 16, 15 ) );
+        const auto imageType = pool.acquire< int8_t, 1 >( SizeI( 16, 16 ) );
+        const auto imageChannels =
+            pool.acquire< uint8_t, 2 >( SizeI( 16, 16 ) );
+        const auto imageAllocator =
+            pool.acquire< uint8_t, 1, std::allocator< uint8_t > >(
+                SizeI( 16, 16 ) );
+    }
+
+    EXPECT_EQ( pool.getNumberAllocations( ), 5U );
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 5U );
+
+    const auto image = pool.acquire< uint8_t, 1 >( SizeI( 16, 16 ) );
+
+    EXPECT_EQ( pool.getNumberAllocations( ), 5U );
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 4U );
+}
+
+TEST( TestCvlCoreImagePool, KeyMemoryResource )
+{
+    using ImageType =
+        Image< uint8_t, 1, std::pmr::polymorphic_allocator< uint8_t > >;
+
+    StatsMemoryResource resource( "pool first" );
+    StatsMemoryResource resourceOther( "pool other" );
+
+    {
+        ImagePool pool;
+
+        const auto acquire = [ & ]( std::pmr::memory_resource* memory )
+        {
+            return pool.acquire< uint8_t,
+                                 1,
+                                 std::pmr::polymorphic_allocator< uint8_t > >(
+                SizeI( 16, 16 ),
+                false,
+                std::pmr::polymorphic_allocator< uint8_t >( memory ) );
+        };
+
+        static_cast< void >( acquire( &resource ) );
+
+        // The cached buffer belongs to the other resource
+        const ImageType imageOther = acquire( &resourceOther );
+
+        EXPECT_EQ( pool.getNumberAllocations( ), 2U );
+        EXPECT_EQ( resourceOther.getSnapshot( ).allocations, 1 );
+
+        const ImageType image = acquire( &resource );
+
+        EXPECT_EQ( pool.getNumberAllocations( ), 2U );
+        EXPECT_EQ( resource.getSnapshot( ).allocations, 1 );
+    }
+
+    // Each buffer is given back to its own resource
+    EXPECT_EQ( resource.getSnapshot( ).liveBytes, 0 );
+    EXPECT_EQ( resourceOther.getSnapshot( ).liveBytes, 0 );
+}
+
+TEST( TestCvlCoreImagePool, Reserve )
+{
+    ImagePool pool;
+    const SizeI size( 32, 32 );
+
+    pool.reserve< float, 1 >( size, 3 );
+
+    EXPECT_EQ( pool.getNumberAllocations( ), 3U );
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 3U );
+    EXPECT_EQ( pool.getCachedBytes( ), 3U * 32U * 32U * sizeof( float ) );
+
+    {
+        std::vector< Image< float, 1 > > images;
+
+        for ( int32_t i = 0; i < 3; i++ )
+        {
+            images.push_back( pool.acquire< float, 1 >( size ) );
+        }
+
+        EXPECT_EQ( pool.getNumberAllocations( ), 3U );
+        EXPECT_EQ( pool.getNumberCachedBuffers( ), 0U );
+    }
+
+    // Reserving fewer buffers than cached does not allocate
+    pool.reserve< float, 1 >( size, 2 );
+
+    EXPECT_EQ( pool.getNumberAllocations( ), 3U );
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 3U );
+
+    pool.clear( );
+
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 0U );
+    EXPECT_EQ( pool.getCachedBytes( ), 0U );
+}
+
+TEST( TestCvlCoreImagePool, MaxCachedBytes )
+{
+    const SizeI size( 100, 10 );
+
+    ImagePool pool( 2500 );
+
+    EXPECT_EQ( pool.getMaxCachedBytes( ), 2500U );
+
+    {
+        const auto image0 = pool.acquire< uint8_t, 1 >( size );
+        const auto image1 = pool.acquire< uint8_t, 1 >( size );
+        const auto image2 = pool.acquire< uint8_t, 1 >( size );
+    }
+
+    // The third buffer exceeds the cap and is deallocated
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), 2U );
+    EXPECT_EQ( pool.getCachedBytes( ), 2000U );
+}
+
+TEST( TestCvlCoreImagePool, OutlivePool )
+{
+    Image< int32_t, 1 > image;
+
+    {
+        ImagePool pool;
+        image = pool.acquire< int32_t, 1 >( SizeI( 8, 8 ), true );
+    }
+
+    // The buffer stays valid and is deallocated with the image
+    image.at( 7, 7 ) = 42;
+
+    EXPECT_EQ( image.at( 7, 7 ), 42 );
+}
+
+TEST( TestCvlCoreImagePool, Concurrent )
+{
+    ImagePool pool;
+    const SizeI size( 128, 128 );
+
+    parallelFor(
+        0,
+        64,
+        [ & ]( int32_t i )
+        {
+            auto image = pool.acquire< uint8_t, 1 >( size );
+            image.at( 0, 0 ) = static_cast< uint8_t >( i );
+
+            EXPECT_EQ( image.at( 0, 0 ), static_cast< uint8_t >( i ) );
+        },
+        4 );
+
+    // At most one buffer per thread was in use at the same time
+    EXPECT_LE( pool.getNumberAllocations( ), 4U );
+    EXPECT_EQ( pool.getNumberCachedBuffers( ), pool.getNumberAllocations( ) );
+}
@@ -0,0 +1,200 @@
+// CVL includes
+#include <cvl/core/LayoutConversion.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <random>
+#include <vector>
+
+using namespace cvl::core;
+
+template < typename T >
+class TestCvlCoreLayoutConversion : public testing::Test
+{
+public:
+    CVL_DEFAULT_ONLY( TestCvlCoreLayoutConversion );
+
+    template < int32_t Channels >
+    static Image< T, Channels > getRandomImage( int32_t width, int32_t height,
+                                                uint32_t seed )
+    {
+        std::mt19937 gen( seed );
+        std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+        Image< T, Channels > image( width, height );
+
+        for ( int32_t c = 0; c < Channels; c++ )
+        {
+            for ( int32_t y = 0; y < height; y++ )
+            {
+                for ( int32_t x = 0; x < width; x++ )
+                {
+                    image.at( y, x, c ) = static_cast< T >( dist( gen ) );
+                }
+            }
+        }
+
+        return image;
+    }
+
+    template < int32_t Channels >
+    static void testRoundTrip( int32_t width, int32_t height )
+    {
+        const auto image = getRandomImage< Channels >( width, height, 3 );
+
+        Image< T, Channels, AlignedAllocator< T >, InterleavedLayout >
+            imageInterleaved;
+        interleave( image, imageInterleaved );
+
+        ASSERT_EQ( imageInterleaved.getSize( ), image.getSize( ) );
+
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            const auto rowPtr = imageInterleaved.getRowPointer( y );
+
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                for ( int32_t c = 0; c < Channels; c++ )
+                {
+                    ASSERT_EQ( rowPtr[ x * Channels + c ],
+                               image.at( y, x, c ) );
+                }
+            }
+        }
+
+        Image< T, Channels > imagePlanar;
+        deinterleave( imageInterleaved, imagePlanar );
+
+        EXPECT_EQ( imagePlanar, image );
+    }
+};
+
+using Types = testing::Types< uint8_t, uint16_t, float >;
+
+TYPED_TEST_SUITE(
+    TestCvlCoreLayoutConversion,
+    Types ); // NOLINT(clang-diagnostic-gnu-zero-variadic-macro-arguments)
+
+TYPED_TEST( TestCvlCoreLayoutConversion, RoundTrip )
+{
+    for ( const auto width : { 1, 15, 16, 17, 33, 100 } )
+    {
+        this->template testRoundTrip< 1 >( width, 5 );
+        this->template testRoundTrip< 2 >( width, 5 );
+        this->template testRoundTrip< 3 >( width, 5 );
+        this->template testRoundTrip< 4 >( width, 5 );
+        this->template testRoundTrip< 5 >( width, 5 );
+    }
+}
+
+TYPED_TEST( TestCvlCoreLayoutConversion, Roi )
+{
+    const auto image = this->template getRandomImage< 3 >( 40, 20, 5 );
+    const Rectangle roi( Point2i { 3, 0 }, SizeI { 33, 20 } );
+
+    Image< TypeParam, 3, AlignedAllocator< TypeParam >, InterleavedLayout >
+        imageInterleaved;
+    interleave( image, imageInterleaved );
+
+    const auto imageInterleavedRoi = imageInterleaved( roi );
+
+    Image< TypeParam, 3 > imagePlanar;
+    deinterleave( imageInterleavedRoi, imagePlanar );
+
+    ASSERT_EQ( imagePlanar.getSize( ), roi.getSize( ) );
+
+    for ( int32_t c = 0; c < 3; c++ )
+    {
+        for ( int32_t y = 0; y < imagePlanar.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < imagePlanar.getWidth( ); x++ )
+            {
+                ASSERT_EQ( imagePlanar.at( y, x, c ), image.at( y, x + 3, c ) );
+            }
+        }
+    }
+}
+
+TEST( TestCvlCoreLayoutConversion, SimdKernelsBitIdentical )
+{
+    std::mt19937 gen( 11 ); // NOLINT(cert-msc51-cpp)
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    // Widths cover the vector bodies and the scalar tails
+    for ( const auto width : { 1, 15, 16, 17, 31, 48, 65, 259 } )
+    {
+        for ( int32_t channels = 1; channels <= 5; channels++ )
+        {
+            const auto elements = static_cast< size_t >( width * channels );
+
+            std::vector< uint8_t > interleaved( elements );
+
+            for ( auto& value : interleaved )
+            {
+                value = static_cast< uint8_t >( dist( gen ) );
+            }
+
+            std::vector< std::vector< uint8_t > > planesCmp(
+                static_cast< size_t >( channels ),
+                std::vector< uint8_t >( static_cast< size_t >( width ) ) );
+            std::vector< uint8_t* > planesCmpPtrs;
+
+            for ( auto& plane : planesCmp )
+            {
+                planesCmpPtrs.push_back( plane.data( ) );
+            }
+
+            detail::deinterleaveRowScalar(
+                interleaved.data( ), planesCmpPtrs.data( ), width, channels );
+
+            for ( const auto level : { SimdLevel::Scalar,
+                                       SimdLevel::SSE2,
+                                       SimdLevel::AVX2,
+                                       SimdLevel::AVX512 } )
+            {
+                if ( ! isSimdLevelSupported( level ) )
+                {
+                    continue;
+                }
+
+                auto planes = planesCmp;
+                std::vector< uint8_t* > planesPtrs;
+                std::vector< const uint8_t* > planesConstPtrs;
+
+                for ( auto& plane : planes )
+                {
+                    std::fill( plane.begin( ), plane.end( ), uint8_t { 1 } );
+                    planesPtrs.push_back( plane.data( ) );
+                    planesConstPtrs.push_back( plane.data( ) );
+                }
+
+                detail::deinterleaveRow( interleaved.data( ),
+                                         planesPtrs.data( ),
+                                         width,
+                                         channels,
+                                         level );
+
+                EXPECT_EQ( planes, planesCmp )
+                    << "level: " << level << ", width: " << width
+                    << ", channels: " << channels;
+
+                std::vector< uint8_t > result( elements, uint8_t { 1 } );
+
+                detail::interleaveRow( planesConstPtrs.data( ),
+                                       result.data( ),
+                                       width,
+                                       channels,
+                                       level );
+
+                EXPECT_EQ( result, interleaved )
+                    << "level: " << level << ", width: " << width
+                    << ", channels: " << channels;
+            }
+        }
+    }
+}
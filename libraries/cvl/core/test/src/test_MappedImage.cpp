@@ -0,0 +1,202 @@
+// CVL includes
+#include <cvl/core/Error.h>
+#include <cvl/core/MappedImage.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace cvl::core;
+
+namespace
+{
+class TestCvlCoreMappedImage : public testing::Test
+{
+public:
+    CVL_DEFAULT_ONLY( TestCvlCoreMappedImage );
+
+protected:
+    void TearDown( ) override
+    {
+        std::error_code error;
+        std::filesystem::remove( mPath, error );
+    }
+
+    void writeFile( const std::string& header,
+                    const std::vector< uint8_t >& pixels ) const
+    {
+        std::ofstream stream( mPath, std::ios::binary );
+        stream.write( header.data( ),
+                      static_cast< std::streamsize >( header.size( ) ) );
+        stream.write( reinterpret_cast< const char* >( pixels.data( ) ),
+                      static_cast< std::streamsize >( pixels.size( ) ) );
+    }
+
+    static std::vector< uint8_t > getPixels( size_t size )
+    {
+        std::vector< uint8_t > pixels( size );
+
+        for ( size_t i = 0; i < size; i++ )
+        {
+            pixels[ i ] = static_cast< uint8_t >( i * 7 );
+        }
+
+        return pixels;
+    }
+
+    std::string mPath =
+        ( std::filesystem::temp_directory_path( ) /
+          ( std::string( "cvl_mapped_" ) +
+            testing::UnitTest::GetInstance( )->current_test_info( )->name( ) ) )
+            .string( );
+};
+} // namespace
+
+TEST_F( TestCvlCoreMappedImage, Pgm )
+{
+    const auto pixels = getPixels( 13 * 5 );
+    writeFile( "P5\n# comment\n13 5\n255\n", pixels );
+
+    const auto image = mapImageFile< uint8_t, 1 >( mPath );
+
+    ASSERT_EQ( image.getSize( ), SizeI( 13, 5 ) );
+
+    for ( int32_t y = 0; y < image.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < image.getWidth( ); x++ )
+        {
+            ASSERT_EQ( image.at( y, x ), pixels[ y * 13 + x ] );
+        }
+    }
+
+    EXPECT_THROW( ( std::ignore = mapImageFile< uint16_t, 1 >( mPath ) ),
+                  Error );
+    EXPECT_THROW( ( std::ignore = mapImageFile< uint8_t, 3 >( mPath ) ),
+                  Error );
+}
+
+TEST_F( TestCvlCoreMappedImage, Ppm )
+{
+    const auto pixels = getPixels( 7 * 4 * 3 );
+    writeFile( "P6 7 4 255\n", pixels );
+
+    const auto image =
+        mapImageFile< uint8_t, 3, InterleavedLayout >( mPath,
+                                                       MappedAccess::Random );
+
+    ASSERT_EQ( image.getSize( ), SizeI( 7, 4 ) );
+
+    for ( int32_t y = 0; y < image.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < image.getWidth( ); x++ )
+        {
+            for ( int32_t c = 0; c < 3; c++ )
+            {
+                const auto index = ( y * 7 + x ) * 3 + c;
+
+                ASSERT_EQ( image.at( y, x, c ), pixels[ index ] );
+            }
+        }
+    }
+
+    // PPM pixels are interleaved
+    EXPECT_THROW( ( std::ignore = mapImageFile< uint8_t, 3 >( mPath ) ),
+                  Error );
+}
+
+TEST_F( TestCvlCoreMappedImage, CvlRoundTrip )
+{
+    Image< float, 3 > image( 19, 6 );
+
+    for ( int32_t c = 0; c < 3; c++ )
+    {
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                image.at( y, x, c ) = static_cast< float >( x + y * 0.5f + c );
+            }
+        }
+    }
+
+    writeCvlImageFile( mPath, image );
+
+    const auto imageMapped =
+        mapImageFile< float, 3 >( mPath, MappedAccess::Sequential );
+
+    ASSERT_EQ( imageMapped.getSize( ), image.getSize( ) );
+
+    for ( int32_t c = 0; c < 3; c++ )
+    {
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                ASSERT_EQ( imageMapped.at( y, x, c ), image.at( y, x, c ) );
+            }
+        }
+    }
+
+    EXPECT_THROW( ( std::ignore = mapImageFile< int32_t, 3 >( mPath ) ),
+                  Error );
+}
+
+TEST_F( TestCvlCoreMappedImage, RawRoiOutlivesImage )
+{
+    // 16 bytes of header and rows padded to 24 bytes
+    const auto pixels = getPixels( 16 + 24 * 8 );
+    writeFile( "", pixels );
+
+    auto image = mapRawImageFile< uint8_t, 1 >( mPath, SizeI( 20, 8 ), 16, 24 );
+
+    EXPECT_EQ( image.getStride( ), 24 );
+
+    const auto roi = image( Rectangle( Point2i { 4, 3 }, { 5, 5 } ) );
+    image = Image< uint8_t, 1 >( );
+
+    for ( int32_t y = 0; y < roi.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < roi.getWidth( ); x++ )
+        {
+            ASSERT_EQ( roi.at( y, x ), pixels[ 16 + ( y + 3 ) * 24 + x + 4 ] );
+        }
+    }
+
+    EXPECT_THROW( ( std::ignore = mapRawImageFile< uint8_t, 1 >(
+                        mPath, SizeI( 20, 9 ), 16, 24 ) ),
+                  Error );
+
+    // The end of the data would wrap around
+    EXPECT_THROW( ( std::ignore = mapRawImageFile< uint8_t, 1 >(
+                        mPath,
+                        SizeI( 20, 8 ),
+                        std::numeric_limits< size_t >::max( ) - 100,
+                        24 ) ),
+                  Error );
+}
+
+TEST_F( TestCvlCoreMappedImage, PrivateMapping )
+{
+    const auto pixels = getPixels( 16 );
+    writeFile( "P5 4 4 255 ", pixels );
+
+    {
+        auto image = mapImageFile< uint8_t, 1 >( mPath );
+        image.at( 1, 1 ) = 0xFF;
+
+        EXPECT_EQ( image.at( 1, 1 ), 0xFF );
+    }
+
+    const auto image = mapImageFile< uint8_t, 1 >( mPath );
+
+    EXPECT_EQ( image.at( 1, 1 ), pixels[ 5 ] );
+}
@@ -0,0 +1,225 @@
+// CVL includes
+#include <cvl/core/Parallel.h>
+#include <cvl/core/ScratchArena.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace cvl::core;
+
+TEST( TestCvlCoreParallel, NumberThreads )
+{
+    EXPECT_EQ( getNumberThreads( 3 ), 3 );
+    EXPECT_GE( getNumberThreads( 0 ), 1 );
+    EXPECT_GE( getNumberThreads( -1 ), 1 );
+}
+
+TEST( TestCvlCoreParallel, ParallelForVisitsAllIndices )
+{
+    for ( const auto numberThreads : { 0, 1, 2, 5, 64 } )
+    {
+        std::vector< std::atomic< int32_t > > visits( 37 );
+
+        parallelFor(
+            3,
+            37,
+            [ & ]( int32_t i ) { visits[ static_cast< size_t >( i ) ]++; },
+            numberThreads );
+
+        for ( size_t i = 0; i < visits.size( ); i++ )
+        {
+            EXPECT_EQ( visits[ i ].load( ), i >= 3 ? 1 : 0 )
+                << "threads: " << numberThreads << ", index: " << i;
+        }
+    }
+}
+
+TEST( TestCvlCoreParallel, ParallelForEmptyRange )
+{
+    int32_t calls { };
+
+    parallelFor( 5, 5, [ & ]( int32_t ) { calls++; } );
+    parallelFor( 5, 2, [ & ]( int32_t ) { calls++; } );
+
+    EXPECT_EQ( calls, 0 );
+}
+
+TEST( TestCvlCoreParallel, ParallelForRethrows )
+{
+    std::atomic< int32_t > calls { };
+
+    EXPECT_THROW( parallelFor(
+                      0,
+                      16,
+                      [ & ]( int32_t i )
+                      {
+                          calls++;
+
+                          if ( i == 7 )
+                          {
+                              throw std::runtime_error( "Failure" );
+                          }
+                      },
+                      4 ),
+                  std::runtime_error );
+
+    // The remaining indices are still processed
+    EXPECT_EQ( calls.load( ), 16 );
+}
+
+TEST( TestCvlCoreParallel, ParallelForNested )
+{
+    std::vector< std::atomic< int32_t > > visits( 8 * 8 );
+
+    parallelFor(
+        0,
+        8,
+        [ & ]( int32_t y )
+        {
+            parallelFor( 0,
+                         8,
+                         [ & ]( int32_t x )
+                         { visits[ static_cast< size_t >( y * 8 + x ) ]++; } );
+        },
+        4 );
+
+    for ( const auto& visit : visits )
+    {
+        EXPECT_EQ( visit.load( ), 1 );
+    }
+}
+
+TEST( TestCvlCoreParallel, ParallelForReusesThreads )
+{
+    static std::atomic< int32_t > constructions { };
+
+    struct ThreadState
+    {
+        ThreadState( )
+        {
+            constructions++;
+        }
+    };
+
+    constexpr int32_t numberCalls = 100;
+
+    for ( int32_t call = 0; call < numberCalls; call++ )
+    {
+        parallelFor(
+            0,
+            16,
+            [ ]( int32_t )
+            {
+                thread_local ThreadState state;
+                static_cast< void >( state );
+            },
+            4 );
+    }
+
+    // New threads for every call would construct the state every time
+    EXPECT_LE( constructions.load( ),
+               std::max( getNumberThreads( ), 64 ) + 1 );
+}
+
+TEST( TestCvlCoreParallel, ParallelForKeepsThreadArenas )
+{
+    static std::atomic< int32_t > coldRuns { };
+
+    constexpr int32_t numberCalls = 100;
+
+    for ( int32_t call = 0; call < numberCalls; call++ )
+    {
+        parallelFor(
+            0,
+            16,
+            [ ]( int32_t )
+            {
+                auto& arena = ScratchArena::getThreadArena( );
+                ScratchArena::Scope scope( arena );
+
+                const auto allocations = arena.getUpstreamAllocations( );
+                static_cast< void >( arena.allocate( 4096, 64 ) );
+
+                if ( arena.getUpstreamAllocations( ) != allocations )
+                {
+                    coldRuns++;
+                }
+            },
+            4 );
+    }
+
+    // Only the first run on each thread allocates a block
+    EXPECT_LE( coldRuns.load( ), std::max( getNumberThreads( ), 64 ) + 1 );
+}
+
+TEST( TestCvlCoreParallel, ParallelForConcurrentCallers )
+{
+    std::atomic< bool > firstStarted { };
+    std::atomic< bool > secondFinished { };
+    std::atomic< bool > timedOut { };
+    std::atomic< int32_t > firstVisits { };
+    std::atomic< int32_t > secondVisits { };
+
+    // The first loop waits for the second one, a second caller blocked
+    // until the first loop finished would time out
+    std::thread first(
+        [ & ]( )
+        {
+            const auto deadline =
+                std::chrono::steady_clock::now( ) + std::chrono::seconds( 10 );
+
+            parallelFor(
+                0,
+                8,
+                [ & ]( int32_t )
+                {
+                    firstStarted = true;
+
+                    while ( ! secondFinished &&
+                            std::chrono::steady_clock::now( ) < deadline )
+                    {
+                        std::this_thread::yield( );
+                    }
+
+                    if ( ! secondFinished )
+                    {
+                        timedOut = true;
+                    }
+
+                    firstVisits++;
+                },
+                4 );
+        } );
+
+    std::thread second(
+        [ & ]( )
+        {
+            while ( ! firstStarted )
+            {
+                std::this_thread::yield( );
+            }
+
+            parallelFor(
+                0, 8, [ & ]( int32_t ) { secondVisits++; }, 4 );
+
+            secondFinished = true;
+        } );
+
+    second.join( );
+    first.join( );
+
+    EXPECT_FALSE( timedOut.load( ) );
+    EXPECT_EQ( firstVisits.load( ), 8 );
+    EXPECT_EQ( secondVisits.load( ), 8 );
+}
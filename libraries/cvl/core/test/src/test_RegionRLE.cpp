@@ -0,0 +1,200 @@
+// CVL includes
+#include <cvl/core/RegionRLE.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <list>
+#include <random>
+
+//
+// Typed tests
+// https://google.github.io/googletest/advanced.html#typed-tests
+
+using namespace cvl::core;
+
+template < typename T >
+class TestCvlCoreRegionRLE : public testing::Test
+{
+public:
+    using List = std::list< T >;
+    static T shared_;
+    T value_ { };
+
+    CVL_DEFAULT_ONLY( TestCvlCoreRegionRLE );
+
+    static Image< T, 1 > getRandomLabelImage( int32_t width, int32_t height )
+    {
+        auto image = Image< T, 1 >( width, height, true );
+
+        std::mt19937 generator( 42 ); // NOLINT(cert-msc51-cpp)
+        std::uniform_int_distribution< int32_t > distribution( 0, 2 );
+
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            auto rowPtr = image.getRowPointer( y );
+
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                rowPtr[ x ] = static_cast< T >( distribution( generator ) );
+            }
+        }
+
+        return image;
+    }
+};
+
+using Types = testing::Types< uint8_t, uint16_t, int32_t >;
+
+TYPED_TEST_SUITE(
+    TestCvlCoreRegionRLE,
+    Types ); // NOLINT(clang-diagnostic-gnu-zero-variadic-macro-arguments)
+
+TYPED_TEST( TestCvlCoreRegionRLE, DefaultConstruct )
+{
+    auto region = RegionRLE( );
+
+    EXPECT_TRUE( region.isEmpty( ) );
+    EXPECT_EQ( region.getArea( ), 0 );
+    EXPECT_EQ( region.getImageSize( ), SizeI( ) );
+    EXPECT_EQ( region.getBoundingBox( ), Rectangle< int32_t >( ) );
+}
+
+TYPED_TEST( TestCvlCoreRegionRLE, AddRun )
+{
+    auto region = RegionRLE( SizeI( 16, 8 ) );
+
+    region.addRun( 1, 2, 5 );
+    region.addRun( 1, 7, 7 );
+    region.addRun( 3, 0, 15 );
+
+    EXPECT_EQ( region.getNumberRuns( ), 3 );
+    EXPECT_EQ( region.getArea( ), 4 + 1 + 16 );
+    EXPECT_EQ( region.getBoundingBox( ),
+               Rectangle< int32_t >( Point2i( 0, 1 ), SizeI( 16, 3 ) ) );
+
+    // Runs have to be sorted and must not overlap
+    EXPECT_THROW( region.addRun( 3, 15, 15 ), Error );
+    EXPECT_THROW( region.addRun( 2, 0, 1 ), Error );
+    EXPECT_THROW( region.addRun( 4, 5, 4 ), Error );
+}
+
+TYPED_TEST( TestCvlCoreRegionRLE, Contains )
+{
+    auto region = RegionRLE( SizeI( 16, 8 ) );
+
+    region.addRun( 1, 2, 5 );
+    region.addRun( 1, 7, 7 );
+    region.addRun( 3, 0, 15 );
+
+    EXPECT_TRUE( region.contains( 1, 2 ) );
+    EXPECT_TRUE( region.contains( 1, 5 ) );
+    EXPECT_TRUE( region.contains( 1, 7 ) );
+    EXPECT_TRUE( region.contains( 3, 9 ) );
+
+    EXPECT_FALSE( region.contains( 0, 2 ) );
+    EXPECT_FALSE( region.contains( 1, 1 ) );
+    EXPECT_FALSE( region.contains( 1, 6 ) );
+    EXPECT_FALSE( region.contains( 1, 8 ) );
+    EXPECT_FALSE( region.contains( 2, 3 ) );
+    EXPECT_FALSE( region.contains( 4, 0 ) );
+}
+
+TYPED_TEST( TestCvlCoreRegionRLE, LabelImageRoundTrip )
+{
+    const auto labelImage = this->getRandomLabelImage( 67, 31 );
+
+    for ( int32_t label = 0; label <= 2; label++ )
+    {
+        const auto region = RegionRLE::fromLabelImage( labelImage, label );
+
+        EXPECT_EQ( region.getImageSize( ), labelImage.getSize( ) );
+
+        const auto image = region.toLabelImage( static_cast< TypeParam >( 1 ) );
+
+        int64_t area { };
+
+        for ( int32_t y = 0; y < labelImage.getHeight( ); y++ )
+        {
+            const auto labelPtr = labelImage.getRowPointer( y );
+            const auto imagePtr = image.getRowPointer( y );
+
+            for ( int32_t x = 0; x < labelImage.getWidth( ); x++ )
+            {
+                const auto expected = labelPtr[ x ] == label;
+
+                area += expected ? 1 : 0;
+
+                EXPECT_EQ( imagePtr[ x ], expected ? 1 : 0 );
+                EXPECT_EQ( region.contains( y, x ), expected );
+            }
+        }
+
+        EXPECT_EQ( region.getArea( ), area );
+    }
+}
+
+TYPED_TEST( TestCvlCoreRegionRLE, FromRegion )
+{
+    const auto labelImage = this->getRandomLabelImage( 32, 16 );
+
+    const auto region = Region( labelImage, TypeParam { 2 } );
+
+    EXPECT_EQ( RegionRLE::fromRegion( region ),
+               RegionRLE::fromLabelImage( labelImage, 2 ) );
+}
+
+TYPED_TEST( TestCvlCoreRegionRLE, Moments )
+{
+    const auto labelImage = this->getRandomLabelImage( 53, 29 );
+
+    const auto region = RegionRLE::fromLabelImage( labelImage, 1 );
+
+    RegionMoments expected { };
+
+    for ( int32_t y = 0; y < labelImage.getHeight( ); y++ )
+    {
+        const auto labelPtr = labelImage.getRowPointer( y );
+
+        for ( int32_t x = 0; x < labelImage.getWidth( ); x++ )
+        {
+            if ( labelPtr[ x ] == 1 )
+            {
+                expected.m00 += 1.0;
+                expected.m10 += x;
+                expected.m01 += y;
+                expected.m20 += x * x;
+                expected.m11 += x * y;
+                expected.m02 += y * y;
+            }
+        }
+    }
+
+    const auto moments = region.getMoments( );
+
+    EXPECT_DOUBLE_EQ( moments.m00, expected.m00 );
+    EXPECT_DOUBLE_EQ( moments.m10, expected.m10 );
+    EXPECT_DOUBLE_EQ( moments.m01, expected.m01 );
+    EXPECT_DOUBLE_EQ( moments.m20, expected.m20 );
+    EXPECT_DOUBLE_EQ( moments.m11, expected.m11 );
+    EXPECT_DOUBLE_EQ( moments.m02, expected.m02 );
+
+    const auto center = region.getCenter( );
+
+    EXPECT_DOUBLE_EQ( center.getX( ), expected.m10 / expected.m00 );
+    EXPECT_DOUBLE_EQ( center.getY( ), expected.m01 / expected.m00 );
+}
+
+TYPED_TEST( TestCvlCoreRegionRLE, PaintSizeMismatch )
+{
+    auto region = RegionRLE( SizeI( 16, 8 ) );
+    region.addRun( 0, 0, 3 );
+
+    auto image = Image< TypeParam, 1 >( 8, 8, true );
+
+    EXPECT_THROW( region.paint( image, TypeParam { 1 } ), Error );
+}
@@ -0,0 +1,118 @@
+// CVL includes
+#include <cvl/core/Error.h>
+#include <cvl/core/ScratchArena.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <thread>
+#include <vector>
+
+using namespace cvl::core;
+
+TEST( TestCvlCoreScratchArena, ScopeRewinds )
+{
+    ScratchArena arena( 1024 );
+
+    {
+        ScratchArena::Scope scope( arena );
+
+        auto* first = arena.allocate( 100, 16 );
+        EXPECT_EQ( reinterpret_cast< uintptr_t >( first ) % 16, 0 );
+
+        void* inner { };
+
+        {
+            ScratchArena::Scope innerScope( arena );
+
+            inner = arena.allocate( 200, 16 );
+            EXPECT_GE( arena.getUsed( ), 300 );
+        }
+
+        EXPECT_LT( arena.getUsed( ), 200 );
+
+        // The memory of the inner scope is handed out again
+        EXPECT_EQ( arena.allocate( 100, 16 ), inner );
+    }
+
+    EXPECT_EQ( arena.getUsed( ), 0 );
+    EXPECT_EQ( arena.getUpstreamAllocations( ), 1 );
+}
+
+TEST( TestCvlCoreScratchArena, SteadyState )
+{
+    ScratchArena arena( 256 );
+
+    const auto run = [ & ]( )
+    {
+        ScratchArena::Scope scope( arena );
+
+        // More than the first block, the arena grows during the first run
+        for ( int32_t i = 0; i < 10; i++ )
+        {
+            std::ignore = arena.allocate( 1000, 64 );
+        }
+
+        std::pmr::vector< int32_t > values( 500, 1, &arena );
+        EXPECT_EQ( values.back( ), 1 );
+    };
+
+    run( );
+
+    // The blocks are merged when the outermost scope ends
+    const auto allocations = arena.getUpstreamAllocations( );
+    const auto capacity = arena.getCapacity( );
+
+    EXPECT_GT( allocations, 1 );
+    EXPECT_GE( capacity, 10 * 1000 + 500 * sizeof( int32_t ) );
+
+    for ( int32_t i = 0; i < 5; i++ )
+    {
+        run( );
+    }
+
+    EXPECT_EQ( arena.getUpstreamAllocations( ), allocations );
+    EXPECT_EQ( arena.getCapacity( ), capacity );
+
+    arena.release( );
+    EXPECT_EQ( arena.getCapacity( ), 0 );
+}
+
+TEST( TestCvlCoreScratchArena, CreateImage )
+{
+    ScratchArena arena;
+    ScratchArena::Scope scope( arena );
+
+    auto image =
+        arena.createImage< Image< uint16_t, 3, AlignedAllocator< uint16_t >,
+                                  PlanarLayout, Avx2Rows > >( SizeI( 21, 5 ) );
+
+    EXPECT_EQ( image.getSize( ), SizeI( 21, 5 ) );
+    EXPECT_EQ( image.getStride( ), 32 );
+    EXPECT_EQ( reinterpret_cast< uintptr_t >( image.getData( ) ) % 64, 0 );
+
+    image.at( 4, 20, 2 ) = 42;
+    EXPECT_EQ( image.at( 4, 20, 2 ), 42 );
+
+    EXPECT_GE( arena.getUsed( ), 32 * 5 * 3 * sizeof( uint16_t ) );
+
+    EXPECT_THROW( arena.reset( ), Error );
+}
+
+TEST( TestCvlCoreScratchArena, ThreadArena )
+{
+    auto* arena = &ScratchArena::getThreadArena( );
+
+    EXPECT_EQ( &ScratchArena::getThreadArena( ), arena );
+
+    ScratchArena* otherArena { };
+    std::thread thread( [ & ]( )
+                        { otherArena = &ScratchArena::getThreadArena( ); } );
+    thread.join( );
+
+    EXPECT_NE( otherArena, arena );
+}
@@ -0,0 +1,178 @@
+// CVL includes
+#include <cvl/core/Image.h>
+#include <cvl/core/StatsMemoryResource.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cvl::core;
+
+TEST( TestCvlCoreStatsMemoryResource, SizeClasses )
+{
+    EXPECT_EQ( AllocationStats::getSizeClass( 0 ), 0 );
+    EXPECT_EQ( AllocationStats::getSizeClass( 64 ), 0 );
+    EXPECT_EQ( AllocationStats::getSizeClass( 65 ), 1 );
+    EXPECT_EQ( AllocationStats::getSizeClass( 128 ), 1 );
+    EXPECT_EQ( AllocationStats::getSizeClass( 129 ), 2 );
+    EXPECT_EQ( AllocationStats::getSizeClass( size_t { 1 } << 20 ), 14 );
+    EXPECT_EQ( AllocationStats::getSizeClass( size_t { 1 } << 40 ),
+               AllocationStats::number_size_classes - 1 );
+
+    for ( size_t i = 0; i + 1 < AllocationStats::number_size_classes; i++ )
+    {
+        const auto limit = AllocationStats::getSizeClassLimit( i );
+
+        EXPECT_EQ( AllocationStats::getSizeClass( limit ), i );
+        EXPECT_EQ( AllocationStats::getSizeClass( limit + 1 ), i + 1 );
+    }
+}
+
+TEST( TestCvlCoreStatsMemoryResource, Counters )
+{
+    StatsMemoryResource stats( "counters" );
+
+    auto* first = stats.allocate( 100 );
+    auto* second = stats.allocate( 1000 );
+
+    stats.deallocate( first, 100 );
+
+    auto snapshot = stats.getSnapshot( );
+
+    EXPECT_EQ( snapshot.tag, "counters" );
+    EXPECT_EQ( snapshot.liveBytes, 1000 );
+    EXPECT_EQ( snapshot.peakBytes, 1100 );
+    EXPECT_EQ( snapshot.allocations, 2 );
+    EXPECT_EQ( snapshot.deallocations, 1 );
+    EXPECT_EQ( snapshot.allocatedBytes, 1100 );
+    EXPECT_EQ( snapshot.sizeClasses[ 1 ], 1 );
+    EXPECT_EQ( snapshot.sizeClasses[ 4 ], 1 );
+
+    stats.resetCounters( );
+    stats.deallocate( second, 1000 );
+
+    snapshot = stats.getSnapshot( );
+
+    EXPECT_EQ( snapshot.liveBytes, 0 );
+    EXPECT_EQ( snapshot.peakBytes, 1000 );
+    EXPECT_EQ( snapshot.allocations, 0 );
+    EXPECT_EQ( snapshot.deallocations, 1 );
+
+    std::stringstream ss;
+    ss << snapshot;
+
+    EXPECT_NE( ss.str( ).find( "[counters] live: 0 peak: 1000" ),
+               std::string::npos );
+}
+
+TEST( TestCvlCoreStatsMemoryResource, Tags )
+{
+    std::pmr::unsynchronized_pool_resource pool;
+
+    StatsMemoryResource imageStats( "images", &pool );
+    StatsMemoryResource vectorStats( "vectors", &pool );
+
+    {
+        const Image< uint8_t, 1, std::pmr::polymorphic_allocator< uint8_t > >
+            image( 64,
+                   64,
+                   false,
+                   std::pmr::polymorphic_allocator< uint8_t >( &imageStats ) );
+
+        std::pmr::vector< int32_t > values( 10, &vectorStats );
+
+        EXPECT_GE( imageStats.getSnapshot( ).liveBytes, 64 * 64 );
+        EXPECT_EQ( vectorStats.getSnapshot( ).liveBytes,
+                   10 * static_cast< int64_t >( sizeof( int32_t ) ) );
+    }
+
+    const auto snapshots = StatsMemoryResource::getAllSnapshots( );
+
+    for ( const auto* tag : { "images", "vectors" } )
+    {
+        const auto it = std::ranges::find( snapshots, tag, [ ]( const auto& s )
+                                           { return s.tag; } );
+
+        ASSERT_NE( it, snapshots.end( ) );
+        EXPECT_EQ( it->liveBytes, 0 );
+        EXPECT_EQ( it->allocations, 1 );
+    }
+}
+
+TEST( TestCvlCoreStatsMemoryResource, SnapshotsByTag )
+{
+    StatsMemoryResource first( "shared tag" );
+    StatsMemoryResource second( "shared tag" );
+
+    auto* small = first.allocate( 100 );
+    auto* large = second.allocate( 1000 );
+    second.deallocate( second.allocate( 10 ), 10 );
+
+    const auto snapshots = StatsMemoryResource::getAllSnapshots( );
+
+    // The resources of a tag are merged into one snapshot
+    EXPECT_EQ( std::ranges::count( snapshots,
+                                   std::string( "shared tag" ),
+                                   &AllocationStats::tag ),
+               1 );
+
+    const auto it = std::ranges::find(
+        snapshots, std::string( "shared tag" ), &AllocationStats::tag );
+
+    ASSERT_NE( it, snapshots.end( ) );
+    EXPECT_EQ( it->liveBytes, 1100 );
+    EXPECT_EQ( it->peakBytes, 1010 );
+    EXPECT_EQ( it->allocations, 3 );
+    EXPECT_EQ( it->deallocations, 1 );
+    EXPECT_EQ( it->allocatedBytes, 1110 );
+    EXPECT_EQ( it->sizeClasses[ 0 ], 1 );
+    EXPECT_EQ( it->sizeClasses[ AllocationStats::getSizeClass( 100 ) ], 1 );
+    EXPECT_EQ( it->sizeClasses[ AllocationStats::getSizeClass( 1000 ) ], 1 );
+
+    first.deallocate( small, 100 );
+    second.deallocate( large, 1000 );
+}
+
+TEST( TestCvlCoreStatsMemoryResource, Concurrent )
+{
+    StatsMemoryResource stats( "concurrent" );
+
+    constexpr int32_t numberThreads = 4;
+    constexpr int32_t numberAllocations = 1000;
+
+    std::vector< std::thread > threads;
+
+    for ( int32_t t = 0; t < numberThreads; t++ )
+    {
+        threads.emplace_back(
+            [ & ]( )
+            {
+                for ( int32_t i = 0; i < numberAllocations; i++ )
+                {
+                    stats.deallocate( stats.allocate( 32 ), 32 );
+                }
+            } );
+    }
+
+    for ( auto& thread : threads )
+    {
+        thread.join( );
+    }
+
+    const auto snapshot = stats.getSnapshot( );
+
+    EXPECT_EQ( snapshot.liveBytes, 0 );
+    EXPECT_EQ( snapshot.allocations, numberThreads * numberAllocations );
+    EXPECT_EQ( snapshot.deallocations, numberThreads * numberAllocations );
+    EXPECT_GE( snapshot.peakBytes, 32 );
+    EXPECT_LE( snapshot.peakBytes, 32 * numberThreads );
+}
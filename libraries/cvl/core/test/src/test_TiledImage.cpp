@@ -0,0 +1,192 @@
+// CVL includes
+#include <cvl/core/StatsMemoryResource.h>
+#include <cvl/core/TiledImage.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <random>
+
+using namespace cvl::core;
+
+namespace
+{
+template < typename ImageType >
+ImageType getRandomImage( int32_t width, int32_t height, uint32_t seed )
+{
+    using PixelType = typename ImageType::value_type;
+    constexpr auto channels =
+        ImageType::number_planes > 1 ? ImageType::number_planes
+                                     : ImageType::pixel_step;
+
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    ImageType image( width, height );
+
+    for ( int32_t c = 0; c < channels; c++ )
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                image.at( y, x, c ) = static_cast< PixelType >( dist( gen ) );
+            }
+        }
+    }
+
+    return image;
+}
+} // namespace
+
+TEST( TestCvlCoreTiledImage, Tiles )
+{
+    const TiledImage< uint8_t, 1, AlignedAllocator< uint8_t >, PlanarLayout,
+                      16 >
+        image( 40, 17 );
+
+    EXPECT_EQ( image.getSize( ), SizeI( 40, 17 ) );
+    EXPECT_EQ( image.getNumberTilesX( ), 3 );
+    EXPECT_EQ( image.getNumberTilesY( ), 2 );
+    EXPECT_EQ( image.getNumberTiles( ), 6 );
+
+    EXPECT_EQ( image.getTileRect( 2, 1 ),
+               Rectangle( Point2i { 32, 16 }, { 8, 1 } ) );
+
+    int32_t numberTiles { };
+    int32_t numberPixels { };
+
+    for ( const auto& tile : image )
+    {
+        EXPECT_EQ( tile.image.getSize( ), tile.rect.getSize( ) );
+        EXPECT_EQ( tile.image.getStride( ), 16 );
+
+        numberTiles++;
+        numberPixels += tile.rect.getWidth( ) * tile.rect.getHeight( );
+    }
+
+    EXPECT_EQ( numberTiles, 6 );
+    EXPECT_EQ( numberPixels, 40 * 17 );
+}
+
+TEST( TestCvlCoreTiledImage, TileViewSharesBuffer )
+{
+    TiledImage< uint16_t, 3, AlignedAllocator< uint16_t >, PlanarLayout, 8 >
+        image( 20, 11, true );
+
+    // Last row and column of tiles, cut at the image border
+    auto tile = image.getTile( 2, 1 );
+    tile.image.at( 2, 3, 2 ) = 42;
+
+    EXPECT_EQ( image.at( 10, 19, 2 ), 42 );
+    EXPECT_EQ( image.at( 10, 19, 1 ), 0 );
+
+    image.at( 1, 1, 1 ) = 7;
+
+    EXPECT_EQ( image.getTile( 0 ).image.at( 1, 1, 1 ), 7 );
+}
+
+TEST( TestCvlCoreTiledImage, RoundTripPlanar )
+{
+    using ImageType = Image< uint16_t, 3 >;
+
+    for ( const auto& size : { SizeI( 1, 1 ), SizeI( 64, 64 ), SizeI( 65, 130 ),
+                               SizeI( 200, 3 ) } )
+    {
+        const auto image = getRandomImage< ImageType >(
+            size.getWidth( ), size.getHeight( ), 3 );
+
+        TiledImage< uint16_t, 3 > imageTiled;
+        toTiled( image, imageTiled );
+
+        ASSERT_EQ( imageTiled.getSize( ), image.getSize( ) );
+
+        for ( int32_t c = 0; c < 3; c++ )
+        {
+            for ( int32_t y = 0; y < image.getHeight( ); y++ )
+            {
+                for ( int32_t x = 0; x < image.getWidth( ); x++ )
+                {
+                    ASSERT_EQ( imageTiled.at( y, x, c ), image.at( y, x, c ) );
+                }
+            }
+        }
+
+        ImageType imageLinear;
+        toLinear( imageTiled, imageLinear );
+
+        EXPECT_EQ( imageLinear, image );
+    }
+}
+
+TEST( TestCvlCoreTiledImage, RoundTripInterleaved )
+{
+    using ImageType =
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >;
+
+    const auto image = getRandomImage< ImageType >( 75, 40, 5 );
+
+    TiledImage< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout,
+                32 >
+        imageTiled;
+    toTiled( image, imageTiled );
+
+    EXPECT_EQ( imageTiled.at( 39, 74, 2 ), image.at( 39, 74, 2 ) );
+
+    ImageType imageLinear;
+    toLinear( imageTiled, imageLinear );
+
+    EXPECT_EQ( imageLinear, image );
+}
+
+TEST( TestCvlCoreTiledImage, ToLinearAllocator )
+{
+    using Allocator = std::pmr::polymorphic_allocator< uint8_t >;
+
+    StatsMemoryResource resource( "tiled" );
+
+    TiledImage< uint8_t, 1, Allocator > imageTiled(
+        70, 33, true, Allocator( &resource ) );
+    imageTiled.at( 32, 69 ) = 42;
+
+    EXPECT_EQ( imageTiled.getAllocator( ).resource( ), &resource );
+
+    // The linear image is allocated on the resource of the tiled image
+    Image< uint8_t, 1, Allocator > imageLinear;
+    toLinear( imageTiled, imageLinear );
+
+    EXPECT_EQ( resource.getSnapshot( ).allocations, 2 );
+    EXPECT_EQ( imageLinear.at( 32, 69 ), 42 );
+}
+
+TEST( TestCvlCoreTiledImage, ReadRegion )
+{
+    using ImageType = Image< float, 1 >;
+
+    const auto image = getRandomImage< ImageType >( 50, 50, 7 );
+
+    TiledImage< float, 1, AlignedAllocator< float >, PlanarLayout, 16 >
+        imageTiled;
+    toTiled( image, imageTiled );
+
+    // The region spans several tiles
+    const Rectangle region( Point2i { 10, 12 }, { 30, 25 } );
+    ImageType imageRegion( 32, 27, true );
+
+    imageTiled.readRegion( region, imageRegion, Point2i( 1, 2 ) );
+
+    for ( int32_t y = 0; y < region.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < region.getWidth( ); x++ )
+        {
+            ASSERT_EQ( imageRegion.at( y + 2, x + 1 ),
+                       image.at( y + 12, x + 10 ) );
+        }
+    }
+
+    EXPECT_EQ( imageRegion.at( 0, 0 ), 0.0f );
+}
@@ -19,62 +19,294 @@ int main( )
     #pragma warning( disable : 5027 )
 
     // CVL includes
+    #include <cvl/core/CpuFeatures.h>
     #include <cvl/core/Image.h>
     #include <cvl/core/Rectangle.h>
+    #include <cvl/core/Region.h>
     #include <cvl/core/macros.h>
+    #include <cvl/processing/Threshold.h>
+    #include <cvl/processing/ThresholdKernels.h>
+
+    // TBB includes
+    #include <oneapi/tbb/blocked_range.h>
+    #include <oneapi/tbb/parallel_for.h>
+
+    // STD includes
+    #include <random>
+    #include <vector>
 
 using namespace cvl::core;
+using namespace cvl::processing;
 
     // Benchmark includes
     #include <benchmark/benchmark.h>
 
+    #pragma warning( disable : 4365 )
+
+//
+// Test data
+//
+// The pixels are either background (below the threshold) or foreground (above
+// the threshold). The foreground density is given in percent. Rows are
+// shifted copies of one random pattern to keep the set up of large images
+// fast.
+//
+
+constexpr auto backgroundValue = 10;
+constexpr auto foregroundValue = 200;
+constexpr auto thresholdValue = 100;
 
-class ThresholdFixture : public benchmark::Fixture
+template < typename PixelType >
+Image< PixelType, 1 > createImage( int32_t width, int32_t height,
+                                   int64_t densityPercent )
 {
-public:
-    CVL_DEFAULT_ONLY( ThresholdFixture );
+    constexpr int32_t patternPadding = 257;
 
-    void SetUp( [[maybe_unused]] const ::benchmark::State& state ) override {}
+    std::mt19937 gen( 42 ); // NOLINT(cert-msc51-cpp)
+    std::bernoulli_distribution dist( static_cast< double >( densityPercent ) /
+                                      100.0 );
 
-    void TearDown( [[maybe_unused]] const ::benchmark::State& state ) override
+    std::vector< PixelType > pattern(
+        static_cast< size_t >( width + patternPadding ) );
+
+    for ( auto& value : pattern )
     {
+        value = static_cast< PixelType >( dist( gen ) ? foregroundValue
+                                                      : backgroundValue );
     }
 
-private:
-};
+    Image< PixelType, 1 > image( width, height );
 
-    #pragma warning( disable : 4365 )
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        const auto offset =
+            static_cast< size_t >( ( y * 31 ) % patternPadding );
+
+        std::copy_n( pattern.begin( ) + static_cast< std::ptrdiff_t >( offset ),
+                     width,
+                     image.getRowPointer( y ) );
+    }
+
+    return image;
+}
+
+void setCounters( benchmark::State& state, int64_t width, int64_t height,
+                  size_t pixelSize )
+{
+    const auto pixels = static_cast< int64_t >( state.iterations( ) ) *
+                        width * height;
+
+    // Bytes read from the input plus bytes written to the output
+    state.SetBytesProcessed(
+        pixels * static_cast< int64_t >( pixelSize + sizeof( uint8_t ) ) );
+    state.SetItemsProcessed( pixels );
+
+    state.SetComplexityN( width * height );
+}
 
+//
+// Full frame
+//
 
+template < typename PixelType >
 static void BM_FixThreshold( benchmark::State& state )
 {
-    std::ignore = state;
-    /*const auto size = static_cast< int32_t >( state.range( 0 ) );
-    const Image< uint8_t, 1 > imgToCopy( size, size, false );
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+    const auto image = createImage< PixelType >( size, size, state.range( 1 ) );
+
+    Region< uint8_t > region;
+    threshold( image, region, static_cast< PixelType >( thresholdValue ) );
+
+    for ( auto _ : state )
+    {
+        threshold( image, region, static_cast< PixelType >( thresholdValue ) );
+
+        benchmark::DoNotOptimize( region.getLabelImage( ).getData( ) );
+        benchmark::ClobberMemory( );
+    }
+
+    setCounters( state, size, size, sizeof( PixelType ) );
+}
+
+    #define THRESHOLD_FULL_FRAME( PixelType )                                  \
+        BENCHMARK_TEMPLATE( BM_FixThreshold, PixelType )                       \
+            ->ArgNames( { "size", "density" } )                                \
+            ->ArgsProduct(                                                     \
+                { benchmark::CreateRange( 256, 8192, 2 ), { 50 } } )           \
+            ->Complexity( benchmark::oN )
+
+THRESHOLD_FULL_FRAME( uint8_t );
+THRESHOLD_FULL_FRAME( int16_t );
+THRESHOLD_FULL_FRAME( uint16_t );
+THRESHOLD_FULL_FRAME( float );
+THRESHOLD_FULL_FRAME( double );
+
+//
+// Foreground density
+//
+// The SIMD kernels are branch free. The scalar kernel, used for int16_t, may
+// suffer from branch mispredictions at medium densities.
+//
+
+    #define THRESHOLD_DENSITY( PixelType )                                     \
+        BENCHMARK_TEMPLATE( BM_FixThreshold, PixelType )                       \
+            ->Name( "BM_FixThresholdDensity<" #PixelType ">" )                 \
+            ->ArgNames( { "size", "density" } )                                \
+            ->ArgsProduct( { { 2048 }, { 0, 1, 10, 50, 90, 99, 100 } } )
+
+THRESHOLD_DENSITY( uint8_t );
+THRESHOLD_DENSITY( int16_t );
+THRESHOLD_DENSITY( float );
+
+//
+// ROI
+//
+// The ROI starts at an odd offset of a larger image, so the rows are neither
+// aligned nor contiguous.
+//
+
+template < typename PixelType >
+static void BM_FixThresholdRoi( benchmark::State& state )
+{
+    constexpr int32_t border = 33;
+
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+    const auto image = createImage< PixelType >(
+        size + 2 * border, size + 2 * border, state.range( 1 ) );
+    const auto roi = image( Rectangle< int32_t >( Point2i( border, border ),
+                                                  SizeI( size, size ) ) );
+
+    Region< uint8_t > region;
+    threshold( roi, region, static_cast< PixelType >( thresholdValue ) );
 
     for ( auto _ : state )
     {
-        Image< uint8_t, 1 > imgCopy( imgToCopy );
+        threshold( roi, region, static_cast< PixelType >( thresholdValue ) );
+
+        benchmark::DoNotOptimize( region.getLabelImage( ).getData( ) );
+        benchmark::ClobberMemory( );
     }
 
-    const auto bytesProcesses = static_cast< int64_t >( state.iterations( ) ) *
-                                static_cast< int64_t >( size * size );
+    setCounters( state, size, size, sizeof( PixelType ) );
+}
+
+    #define THRESHOLD_ROI( PixelType )                                         \
+        BENCHMARK_TEMPLATE( BM_FixThresholdRoi, PixelType )                    \
+            ->ArgNames( { "size", "density" } )                                \
+            ->ArgsProduct(                                                     \
+                { benchmark::CreateRange( 256, 8192, 2 ), { 50 } } )           \
+            ->Complexity( benchmark::oN )
+
+THRESHOLD_ROI( uint8_t );
+THRESHOLD_ROI( uint16_t );
+THRESHOLD_ROI( float );
+
+//
+// SIMD level
+//
+// Runs the row kernel with a fixed SIMD level to compare the kernels against
+// the scalar reference.
+//
+
+template < typename PixelType >
+static void BM_FixThresholdSimdLevel( benchmark::State& state )
+{
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+    const auto level = static_cast< SimdLevel >( state.range( 1 ) );
 
-    state.SetBytesProcessed( bytesProcesses );
+    if ( ! isSimdLevelSupported( level ) )
+    {
+        state.SkipWithError( "SIMD level not supported" );
+        return;
+    }
+
+    const auto image = createImage< PixelType >( size, size, 50 );
+    Image< uint8_t, 1 > labelImage( size, size );
+
+    for ( auto _ : state )
+    {
+        for ( int32_t y = 0; y < size; y++ )
+        {
+            detail::thresholdRow( image.getRowPointer( y ),
+                                  labelImage.getRowPointer( y ),
+                                  size,
+                                  static_cast< PixelType >( thresholdValue ),
+                                  uint8_t { 1 },
+                                  level );
+        }
+
+        benchmark::DoNotOptimize( labelImage.getData( ) );
+        benchmark::ClobberMemory( );
+    }
 
-    state.SetComplexityN( size * size );*/
+    setCounters( state, size, size, sizeof( PixelType ) );
 }
 
-BENCHMARK( BM_FixThreshold )
-    ->Arg( 256 )
-    ->Arg( 512 )
-    ->Arg( 1024 )
-    ->Arg( 2048 )
-    ->Arg( 4096 )
-    ->Complexity( benchmark::oN );
+    #define THRESHOLD_SIMD_LEVEL( PixelType )                                  \
+        BENCHMARK_TEMPLATE( BM_FixThresholdSimdLevel, PixelType )              \
+            ->ArgNames( { "size", "level" } )                                  \
+            ->ArgsProduct( { { 2048 },                                         \
+                             { static_cast< int64_t >( SimdLevel::Scalar ),    \
+                               static_cast< int64_t >( SimdLevel::SSE2 ),      \
+                               static_cast< int64_t >( SimdLevel::AVX2 ),      \
+                               static_cast< int64_t >( SimdLevel::AVX512 ) } } )
 
+THRESHOLD_SIMD_LEVEL( uint8_t );
+THRESHOLD_SIMD_LEVEL( uint16_t );
+THRESHOLD_SIMD_LEVEL( float );
 
-BENCHMARK_MAIN( );
+//
+// Multi threaded
+//
+// The image is split into horizontal strips processed by TBB. Each strip
+// writes into a view of the shared label image.
+//
+
+template < typename PixelType >
+static void BM_FixThresholdParallel( benchmark::State& state )
+{
+    constexpr int32_t stripHeight = 64;
+
+    const auto size = static_cast< int32_t >( state.range( 0 ) );
+    const auto image = createImage< PixelType >( size, size, 50 );
+    const Image< uint8_t, 1 > labelImage( size, size );
+
+    for ( auto _ : state )
+    {
+        oneapi::tbb::parallel_for(
+            oneapi::tbb::blocked_range< int32_t >( 0, size, stripHeight ),
+            [ & ]( const oneapi::tbb::blocked_range< int32_t >& range )
+            {
+                const auto strip = Rectangle< int32_t >(
+                    Point2i( 0, range.begin( ) ),
+                    SizeI( size, range.end( ) - range.begin( ) ) );
+
+                Region< uint8_t > region( labelImage( strip ), uint8_t { 1 } );
 
+                threshold( image( strip ),
+                           region,
+                           static_cast< PixelType >( thresholdValue ) );
+            } );
+
+        benchmark::DoNotOptimize( labelImage.getData( ) );
+        benchmark::ClobberMemory( );
+    }
+
+    setCounters( state, size, size, sizeof( PixelType ) );
+}
+
+    #define THRESHOLD_PARALLEL( PixelType )                                    \
+        BENCHMARK_TEMPLATE( BM_FixThresholdParallel, PixelType )               \
+            ->ArgName( "size" )                                                \
+            ->RangeMultiplier( 2 )                                             \
+            ->Range( 1024, 8192 )                                              \
+            ->Complexity( benchmark::oN )                                      \
+            ->UseRealTime( )
+
+THRESHOLD_PARALLEL( uint8_t );
+THRESHOLD_PARALLEL( uint16_t );
+THRESHOLD_PARALLEL( float );
+
+BENCHMARK_MAIN( );
 
 #endif
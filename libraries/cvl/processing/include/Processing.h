@@ -2,15 +2,22 @@
 
 // CVL includes
 #include <cvl/processing/Area.h>
+#include <cvl/processing/Blob.h>
 #include <cvl/processing/BoundingBox.h>
+#include <cvl/processing/BoxFilter.h>
 #include <cvl/processing/Center.h>
 #include <cvl/processing/ColumnFilter.h>
 #include <cvl/processing/ConnectedComponents.h>
+#include <cvl/processing/EquivalenceTable.h>
 #include <cvl/processing/Filter1D.h>
 #include <cvl/processing/Filter2D.h>
 #include <cvl/processing/FilterCoefficients.h>
+#include <cvl/processing/FilterKernels.h>
 #include <cvl/processing/FilterOperation.h>
+#include <cvl/processing/RegionSet.h>
 #include <cvl/processing/RowFilter.h>
 #include <cvl/processing/Smoothing.h>
+#include <cvl/processing/StreamingConnectedComponents.h>
 #include <cvl/processing/Threshold.h>
+#include <cvl/processing/ThresholdKernels.h>
 #include <cvl/processing/export.h>
@@ -3,8 +3,10 @@
 // CVL includes
 #include <cvl/core/CallOnce.h>
 #include <cvl/core/CrtpBase.h>
+#include <cvl/processing/Blob.h>
 
 // STD includes
+#include <cstdint>
 
 namespace cvl::processing
 {
@@ -24,6 +26,14 @@ public:
 
     [[nodiscard]] double getArea( );
 
+    /**
+     * Function that sets the area from the statistics of the labeling pass,
+     * so the label image does not need to be scanned again.
+     *
+     * @param [in]  blob    The statistics of the region.
+     */
+    void setStatistics( const Blob& blob );
+
 private:
     void calculate( );
 
@@ -45,12 +55,35 @@ double Area< Derived >::getArea( )
     return mArea;
 }
 
+template < typename Derived >
+void Area< Derived >::setStatistics( const Blob& blob )
+{
+    mArea = static_cast< double >( blob.area );
+    mCalculated = true;
+}
+
 template < typename Derived >
 void Area< Derived >::calculate( )
 {
-    //auto& labelImage = this->underlying( ).getLabelImage( );
-    //std::ignore = labelImage;
-    // mArea;
+    const auto& labelImage = this->underlying( ).getLabelImage( );
+    const auto labelNumber = this->underlying( ).getLabelNumber( );
+
+    int64_t area { };
+
+    for ( int32_t y = 0; y < labelImage.getHeight( ); y++ )
+    {
+        const auto rowPtr = labelImage.getRowPointer( y );
+
+        for ( int32_t x = 0; x < labelImage.getWidth( ); x++ )
+        {
+            if ( static_cast< int32_t >( rowPtr[ x ] ) == labelNumber )
+            {
+                area++;
+            }
+        }
+    }
+
+    mArea = static_cast< double >( area );
 }
 
 } // namespace cvl::processing
\ No newline at end of file
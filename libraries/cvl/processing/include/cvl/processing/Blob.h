@@ -0,0 +1,179 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/Point.h>
+#include <cvl/core/Rectangle.h>
+#include <cvl/core/Size.h>
+
+// STD includes
+#include <cstdint>
+
+namespace cvl::processing
+{
+
+/**
+ * @brief The statistics of a connected component
+ *
+ * The blob accumulates the area, the bounding box and the sums of the pixel
+ * coordinates of a connected component. The statistics of two blobs can be
+ * merged, so they can be collected for provisional labels and combined when
+ * the labels are resolved.
+ *
+ * The first column is the column of the leftmost pixel in the top row, i.e.
+ * the first pixel of the blob in raster scan order.
+ */
+struct Blob
+{
+    int32_t top { };
+    int32_t bottom { };
+    int32_t left { };
+    int32_t right { };
+    int32_t area { };
+    int32_t label { };
+    int32_t firstColumn { };
+    int64_t sumX { };
+    int64_t sumY { };
+
+    Blob( ) = default;
+
+    Blob( int32_t x, int32_t y, int32_t objectId )
+        : top( y )
+        , bottom( y )
+        , left( x )
+        , right( x )
+        , area( 1 )
+        , label( objectId )
+        , firstColumn( x )
+        , sumX( x )
+        , sumY( y )
+    {
+    }
+
+    void add( int32_t x, int32_t y )
+    {
+        area += 1;
+        sumX += x;
+        sumY += y;
+
+        if ( x < left )
+        {
+            left = x;
+        }
+
+        if ( x > right )
+        {
+            right = x;
+        }
+
+        if ( y < top )
+        {
+            top = y;
+            firstColumn = x;
+        }
+        else if ( y == top && x < firstColumn )
+        {
+            firstColumn = x;
+        }
+
+        if ( y > bottom )
+        {
+            bottom = y;
+        }
+    }
+
+    void addRun( int32_t colStart, int32_t colEnd, int32_t y )
+    {
+        const auto length = colEnd - colStart + 1;
+
+        area += length;
+        sumX += ( static_cast< int64_t >( colStart ) + colEnd ) * length / 2;
+        sumY += static_cast< int64_t >( y ) * length;
+
+        if ( colStart < left )
+        {
+            left = colStart;
+        }
+
+        if ( colEnd > right )
+        {
+            right = colEnd;
+        }
+
+        if ( y < top )
+        {
+            top = y;
+            firstColumn = colStart;
+        }
+        else if ( y == top && colStart < firstColumn )
+        {
+            firstColumn = colStart;
+        }
+
+        if ( y > bottom )
+        {
+            bottom = y;
+        }
+    }
+
+    void merge( const Blob& other )
+    {
+        area += other.area;
+        sumX += other.sumX;
+        sumY += other.sumY;
+
+        if ( other.left < left )
+        {
+            left = other.left;
+        }
+
+        if ( other.right > right )
+        {
+            right = other.right;
+        }
+
+        if ( other.top < top )
+        {
+            top = other.top;
+            firstColumn = other.firstColumn;
+        }
+        else if ( other.top == top && other.firstColumn < firstColumn )
+        {
+            firstColumn = other.firstColumn;
+        }
+
+        if ( other.bottom > bottom )
+        {
+            bottom = other.bottom;
+        }
+    }
+
+    void shift( int32_t dx, int32_t dy )
+    {
+        left += dx;
+        right += dx;
+        firstColumn += dx;
+        top += dy;
+        bottom += dy;
+        sumX += static_cast< int64_t >( dx ) * area;
+        sumY += static_cast< int64_t >( dy ) * area;
+    }
+
+    [[nodiscard]] core::Rectangle< int32_t > getBoundingRect( ) const
+    {
+        return { core::Point< int32_t, 2 >( left, top ),
+                 core::Size( right - left + 1, bottom - top + 1 ) };
+    }
+
+    [[nodiscard]] core::Point< double, 2 > getCenter( ) const
+    {
+        return {
+            core::Point< double, 2 >( static_cast< double >( sumX ) /
+                                          static_cast< double >( area ),
+                                      static_cast< double >( sumY ) /
+                                          static_cast< double >( area ) ) };
+    }
+
+    [[nodiscard]] int32_t getArea( ) const { return area; }
+};
+
+} // namespace cvl::processing
@@ -4,8 +4,12 @@
 #include <cvl/core/CallOnce.h>
 #include <cvl/core/CrtpBase.h>
 #include <cvl/core/Rectangle.h>
+#include <cvl/processing/Blob.h>
 
 // STD includes
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 
 namespace cvl::processing
 {
@@ -25,6 +29,14 @@ public:
 
     [[nodiscard]] core::Rectangle< float > getBoundingBox( );
 
+    /**
+     * Function that sets the bounding box from the statistics of the
+     * labeling pass, so the label image does not need to be scanned again.
+     *
+     * @param [in]  blob    The statistics of the region.
+     */
+    void setStatistics( const Blob& blob );
+
 private:
     void calculate( );
 
@@ -47,12 +59,54 @@ core::Rectangle< float > BoundingBox< Derived >::getBoundingBox( )
     return mBoundingBox;
 }
 
+template < typename Derived >
+void BoundingBox< Derived >::setStatistics( const Blob& blob )
+{
+    const auto rect = blob.getBoundingRect( );
+
+    mBoundingBox = core::Rectangle< float >(
+        core::Point< float, 2 >( static_cast< float >( rect.getLeft( ) ),
+                                 static_cast< float >( rect.getTop( ) ) ),
+        core::Size< float >( static_cast< float >( rect.getWidth( ) ),
+                             static_cast< float >( rect.getHeight( ) ) ) );
+    mCalculated = true;
+}
+
 template < typename Derived >
 void BoundingBox< Derived >::calculate( )
 {
-    auto& labelImage = this->underlying( ).getLabelImage( );
-    std::ignore = labelImage;
-    // mArea;
+    const auto& labelImage = this->underlying( ).getLabelImage( );
+    const auto labelNumber = this->underlying( ).getLabelNumber( );
+
+    auto left = std::numeric_limits< int32_t >::max( );
+    auto top = std::numeric_limits< int32_t >::max( );
+    auto right = std::numeric_limits< int32_t >::min( );
+    auto bottom = std::numeric_limits< int32_t >::min( );
+
+    for ( int32_t y = 0; y < labelImage.getHeight( ); y++ )
+    {
+        const auto rowPtr = labelImage.getRowPointer( y );
+
+        for ( int32_t x = 0; x < labelImage.getWidth( ); x++ )
+        {
+            if ( static_cast< int32_t >( rowPtr[ x ] ) == labelNumber )
+            {
+                left = std::min( left, x );
+                right = std::max( right, x );
+                top = std::min( top, y );
+                bottom = std::max( bottom, y );
+            }
+        }
+    }
+
+    if ( left <= right )
+    {
+        mBoundingBox = core::Rectangle< float >(
+            core::Point< float, 2 >( static_cast< float >( left ),
+                                     static_cast< float >( top ) ),
+            core::Size< float >( static_cast< float >( right - left + 1 ),
+                                 static_cast< float >( bottom - top + 1 ) ) );
+    }
 }
 
 } // namespace cvl::processing
\ No newline at end of file
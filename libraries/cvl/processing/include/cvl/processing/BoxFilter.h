@@ -0,0 +1,226 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/CpuFeatures.h>
+#include <cvl/core/Image.h>
+#include <cvl/core/ScratchArena.h>
+#include <cvl/core/Types.h>
+#include <cvl/core/macros.h>
+#include <cvl/processing/FilterKernels.h>
+
+// STD includes
+#include <algorithm>
+#include <cstdint>
+
+namespace cvl::processing
+{
+
+/**
+ * Function that maps an index outside of a range into the range. Indices far
+ * outside, e.g. of kernels larger than the image, are mapped repeatedly.
+ *
+ * @param [in]  index   The index
+ * @param [in]  size    The size of the range. Must be positive.
+ * @param [in]  border  The border type
+ *
+ * @return The index inside of the range
+ */
+constexpr int32_t getBorderIndex( int32_t index, int32_t size,
+                                  core::BorderType border )
+{
+    if ( index >= 0 && index < size )
+    {
+        return index;
+    }
+
+    const auto modulo = []( int32_t value, int32_t period )
+    { return ( value % period + period ) % period; };
+
+    switch ( border )
+    {
+    case core::BorderType::Replicate:
+        return std::clamp( index, 0, size - 1 );
+    case core::BorderType::Reflect:
+    {
+        const auto idx = modulo( index, 2 * size );
+
+        return idx < size ? idx : 2 * size - 1 - idx;
+    }
+    case core::BorderType::Wrap:
+        return modulo( index, size );
+    case core::BorderType::Reflect101:
+    {
+        if ( size == 1 )
+        {
+            return 0;
+        }
+
+        const auto idx = modulo( index, 2 * size - 2 );
+
+        return idx < size ? idx : 2 * size - 2 - idx;
+    }
+    }
+
+    return index;
+}
+
+/**
+ * Applies a box filter to an 8 bit image with running sums. The cost per
+ * pixel does not depend on the kernel size.
+ *
+ * The sums of the columns are moved down the image row by row, one row enters
+ * and one row leaves the box. The quotients of a row are filtered
+ * horizontally as the difference of its prefix sums. Both steps are SIMD
+ * across the columns. Like boxBlur, the vertical quotients are truncated to
+ * 8 bit before the horizontal pass, so with BorderType::Reflect101 the result
+ * is identical to boxBlur.
+ *
+ * @param [in]   imageIn     The input image
+ * @param [out]  imageOut    The output image. The image is reallocated if the
+ *                           size does not match.
+ * @param [in]   kernelSize  The size of the box. Only odd sizes are allowed.
+ * @param [in]   border      The border handling
+ */
+template < int32_t Channels, typename Allocator, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
+void boxFilter(
+    const core::Image< uint8_t, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< uint8_t, Channels, Allocator, Layout, Alignment >& imageOut,
+    const core::SizeI& kernelSize,
+    core::BorderType border = core::BorderType::Reflect101 )
+{
+    using ImageType =
+        core::Image< uint8_t, Channels, Allocator, Layout, Alignment >;
+
+    constexpr auto step = ImageType::pixel_step;
+
+    const auto kernelWidth = kernelSize.getWidth( );
+    const auto kernelHeight = kernelSize.getHeight( );
+
+    EXPECT_MSG( kernelWidth > 0 && kernelWidth % 2 != 0 &&
+                    kernelHeight > 0 && kernelHeight % 2 != 0,
+                "Invalid kernel size("
+                    << kernelSize << ")  Only odd kernel size is allowed." );
+
+    EXPECT_MSG( imageIn.getWidth( ) > 0 && imageIn.getHeight( ) > 0,
+                "Image size(" << imageIn.getSize( ) << "). Image is empty" );
+
+    EXPECT_MSG( static_cast< const void* >( imageIn.getData( ) ) !=
+                    static_cast< const void* >( imageOut.getData( ) ),
+                "Input image cannot be the output image" );
+
+    detail::FixedPointDivisor columnDivisor;
+    detail::FixedPointDivisor rowDivisor;
+
+    EXPECT_MSG(
+        detail::makeFixedPointDivisor(
+            kernelHeight, kernelHeight * 255, columnDivisor ) &&
+            detail::makeFixedPointDivisor(
+                kernelWidth, kernelWidth * 255, rowDivisor ),
+        "Invalid kernel size(" << kernelSize << "). Kernel is too large." );
+
+    if ( imageOut.getSize( ) != imageIn.getSize( ) )
+    {
+        imageOut = ImageType( imageIn.getSize( ), true );
+    }
+
+    const auto width = imageIn.getWidth( );
+    const auto height = imageIn.getHeight( );
+    const auto anchorX = kernelWidth / 2;
+    const auto anchorY = kernelHeight / 2;
+    const auto level = core::getSimdLevel( );
+
+    const auto count = width * step;
+    const auto paddedCount = ( width + kernelWidth - 1 ) * step;
+
+    auto& arena = core::ScratchArena::getThreadArena( );
+    core::ScratchArena::Scope scope( arena );
+
+    auto* sums = static_cast< int32_t* >( arena.allocate(
+        static_cast< size_t >( count ) * sizeof( int32_t ), 64 ) );
+    auto* prefix = static_cast< int32_t* >( arena.allocate(
+        static_cast< size_t >( paddedCount + step ) * sizeof( int32_t ),
+        64 ) );
+    auto* line = static_cast< uint8_t* >(
+        arena.allocate( static_cast< size_t >( paddedCount ), 64 ) );
+    auto* lineCenter = line + anchorX * step;
+
+    for ( int32_t plane = 0; plane < ImageType::number_planes; plane++ )
+    {
+        // The sums of the box above the first row, initialized with the top
+        // row of the box
+        const auto* firstRow = imageIn.getRowPointer(
+            getBorderIndex( -anchorY - 1, height, border ), plane );
+
+        for ( int32_t x = 0; x < count; x++ )
+        {
+            sums[ x ] = firstRow[ x ];
+        }
+
+        for ( int32_t y = -anchorY; y < anchorY; y++ )
+        {
+            const auto* row = imageIn.getRowPointer(
+                getBorderIndex( y, height, border ), plane );
+
+            for ( int32_t x = 0; x < count; x++ )
+            {
+                sums[ x ] += row[ x ];
+            }
+        }
+
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            detail::slideBoxColumn(
+                sums,
+                imageIn.getRowPointer(
+                    getBorderIndex( y + anchorY, height, border ), plane ),
+                imageIn.getRowPointer(
+                    getBorderIndex( y - anchorY - 1, height, border ), plane ),
+                lineCenter,
+                count,
+                columnDivisor,
+                level );
+
+            for ( int32_t x = -anchorX; x < width + anchorX; x++ )
+            {
+                if ( x == 0 )
+                {
+                    x = width - 1;
+                    continue;
+                }
+
+                const auto idx = getBorderIndex( x, width, border );
+
+                for ( int32_t c = 0; c < step; c++ )
+                {
+                    lineCenter[ x * step + c ] = lineCenter[ idx * step + c ];
+                }
+            }
+
+            // The prefix sums of each channel. The sum is kept in a register,
+            // the loop is bound by the latency of one addition per element.
+            for ( int32_t c = 0; c < step; c++ )
+            {
+                int32_t sum { };
+
+                for ( int32_t x = c; x < paddedCount; x += step )
+                {
+                    prefix[ x ] = sum;
+                    sum += line[ x ];
+                }
+
+                prefix[ paddedCount + c ] = sum;
+            }
+
+            detail::differenceBoxRow( prefix,
+                                      imageOut.getRowPointer( y, plane ),
+                                      count,
+                                      kernelWidth * step,
+                                      rowDivisor,
+                                      level );
+        }
+    }
+}
+
+} // namespace cvl::processing
@@ -4,8 +4,10 @@
 #include <cvl/core/CallOnce.h>
 #include <cvl/core/CrtpBase.h>
 #include <cvl/core/Point.h>
+#include <cvl/processing/Blob.h>
 
 // STD includes
+#include <cstdint>
 
 namespace cvl::processing
 {
@@ -25,6 +27,14 @@ public:
 
     [[nodiscard]] core::Point< float, 2 > getCenter( );
 
+    /**
+     * Function that sets the center from the statistics of the labeling
+     * pass, so the label image does not need to be scanned again.
+     *
+     * @param [in]  blob    The statistics of the region.
+     */
+    void setStatistics( const Blob& blob );
+
 private:
     void calculate( );
 
@@ -46,11 +56,49 @@ core::Point< float, 2 > Center< Derived >::getCenter( )
     return mCenter;
 }
 
+template < typename Derived >
+void Center< Derived >::setStatistics( const Blob& blob )
+{
+    const auto center = blob.getCenter( );
+
+    mCenter = core::Point< float, 2 >( static_cast< float >( center.getX( ) ),
+                                       static_cast< float >( center.getY( ) ) );
+    mCalculated = true;
+}
+
 template < typename Derived >
 void Center< Derived >::calculate( )
 {
-    auto& labelImage = this->underlying( ).getLabelImage( );
-    std::ignore = labelImage;
+    const auto& labelImage = this->underlying( ).getLabelImage( );
+    const auto labelNumber = this->underlying( ).getLabelNumber( );
+
+    int64_t area { };
+    int64_t sumX { };
+    int64_t sumY { };
+
+    for ( int32_t y = 0; y < labelImage.getHeight( ); y++ )
+    {
+        const auto rowPtr = labelImage.getRowPointer( y );
+
+        for ( int32_t x = 0; x < labelImage.getWidth( ); x++ )
+        {
+            if ( static_cast< int32_t >( rowPtr[ x ] ) == labelNumber )
+            {
+                area++;
+                sumX += x;
+                sumY += y;
+            }
+        }
+    }
+
+    if ( area > 0 )
+    {
+        mCenter = core::Point< float, 2 >(
+            static_cast< float >( static_cast< double >( sumX ) /
+                                  static_cast< double >( area ) ),
+            static_cast< float >( static_cast< double >( sumY ) /
+                                  static_cast< double >( area ) ) );
+    }
 }
 
 } // namespace cvl::processing
\ No newline at end of file
@@ -3,8 +3,14 @@
 // CVL includes
 #include <cvl/core/Image.h>
 #include <cvl/core/Types.h>
+#include <cvl/processing/FilterKernels.h>
 #include <cvl/processing/FilterOperation.h>
 
+// STD includes
+#include <algorithm>
+#include <array>
+#include <span>
+
 namespace cvl::processing
 {
 
@@ -12,24 +18,45 @@ namespace cvl::processing
 // FULL TEMPLATE VERSION
 //
 template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
-           Arithmetic PixelTypeOut, Arithmetic KernelType >
+           Arithmetic PixelTypeOut, Arithmetic KernelType,
+           core::ChannelLayout Layout, core::RowAlignmentPolicy Alignment >
 struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
-                        KernelType, core::FilterDirection::Column >
+                        KernelType, core::FilterDirection::Column, Layout,
+                        Alignment >
 
 {
-    static void applyFilter(
-        const core::Image< PixelTypeIn, Channels, Allocator >& imageIn,
+    using ImageIn =
+        core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >;
+    using ImageOut =
         core::Image< PixelTypeOut, Channels,
-                     typename std::allocator_traits< Allocator >::
-                         template rebind_alloc< PixelTypeIn > >& imageOut,
-        const std::vector< KernelType >& kernel )
+                     typename std::allocator_traits<
+                         Allocator >::template rebind_alloc< PixelTypeIn >,
+                     Layout, Alignment >;
+
+    template < size_t Extent >
+    static void applyFilter( const ImageIn& imageIn, ImageOut& imageOut,
+                             std::span< const KernelType, Extent > kernel )
+    {
+        dispatchKernelSize( kernel,
+                            [ & ]( auto sizedKernel )
+                            { apply( imageIn, imageOut, sizedKernel ); } );
+    }
+
+private:
+    /*
+     * Function that applies the filter. The kernel size is known at compile
+     * time for all extents but std::dynamic_extent.
+     */
+    template < size_t Extent >
+    static void apply( const ImageIn& imageIn, ImageOut& imageOut,
+                       std::span< const KernelType, Extent > kernel )
     {
         using sumType = decltype( std::declval< PixelTypeIn >( ) +
                                   std::declval< PixelTypeOut >( ) );
 
-        using allocator_traits = std::allocator_traits< Allocator >;
-        using OutAllocator =
-            typename allocator_traits::template rebind_alloc< PixelTypeOut >;
+        // The layout defines the distance of the pixels of a channel. The
+        // inner loops are specialized on it at compile time.
+        constexpr auto step = ImageIn::pixel_step;
 
         const auto width = imageIn.getWidth( );
         const auto height = imageIn.getHeight( );
@@ -39,8 +66,7 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
 
         if ( imageOut.getSize( ) != imageIn.getSize( ) )
         {
-            imageOut = core::Image< PixelTypeOut, 1, OutAllocator >(
-                width, height, true );
+            imageOut = ImageOut( width, height, true );
         }
 
         KernelType divisor = { };
@@ -55,6 +81,21 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
             scale = 1.0f / static_cast< float >( divisor );
         }
 
+        // Integer kernels on 8 bit images are applied in fixed-point. The
+        // result is the exact quotient, saturated to the range of uint8_t.
+        if constexpr ( detail::hasFixedPointKernel< PixelTypeIn,
+                                                    PixelTypeOut,
+                                                    KernelType > )
+        {
+            detail::FixedPointKernel fixedPoint;
+
+            if ( detail::makeFixedPointKernel( kernel, fixedPoint ) )
+            {
+                applyFixedPoint( imageIn, imageOut, fixedPoint );
+                return;
+            }
+        }
+
         // Top lines
         for ( int32_t c = 0; c < Channels; c++ )
         {
@@ -72,14 +113,14 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
                     {
                         const auto py = std::abs( y + ky ) - y;
 
-                        sum += *( srcPtr + py * stride + x ) *
+                        sum += srcPtr[ py * stride + x * step ] *
                                static_cast< sumType >( *kernelIt++ );
                     }
 
                     sum = static_cast< sumType >( static_cast< float >( sum ) *
                                                   scale );
 
-                    *( dstPtr + x ) = static_cast< uint8_t >( sum );
+                    dstPtr[ x * step ] = static_cast< uint8_t >( sum );
                 }
             }
         }
@@ -107,41 +148,103 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
                         }
                         const auto py = idx - y;
 
-                        sum += *( srcPtr + py * stride + x ) *
+                        sum += srcPtr[ py * stride + x * step ] *
                                static_cast< sumType >( *kernelIt++ );
                     }
 
                     sum = static_cast< sumType >( static_cast< float >( sum ) *
                                                   scale );
 
-                    *( dstPtr + x ) = static_cast< uint8_t >( sum );
+                    dstPtr[ x * step ] = static_cast< uint8_t >( sum );
                 }
             }
         }
 
-        // Lines between top and bottom
+        // Lines between top and bottom. The lines are processed in vertical
+        // strips, so the input rows of a strip are still cached when the next
+        // line reads them.
+        const auto stripWidth =
+            detail::getColumnStripWidth(
+                static_cast< int32_t >( kernel.size( ) ),
+                static_cast< int32_t >( sizeof( PixelTypeIn ) ) * step ) /
+            step;
+
         for ( int32_t c = 0; c < Channels; c++ )
         {
-            for ( int32_t y = anchorY; y < height - anchorY; y++ )
+            for ( int32_t x0 = 0; x0 < width; x0 += stripWidth )
             {
-                auto srcPtr = imageIn.getRowPointer( y, c );
-                auto dstPtr = imageOut.getRowPointer( y, c );
+                const auto x1 = std::min( x0 + stripWidth, width );
 
-                for ( int32_t x = 0; x < width; x++ )
+                for ( int32_t y = anchorY; y < height - anchorY; y++ )
                 {
-                    sumType sum { };
-                    auto kernelIt = kernelStart;
+                    auto srcPtr = imageIn.getRowPointer( y, c );
+                    auto dstPtr = imageOut.getRowPointer( y, c );
 
-                    for ( int32_t ky = -anchorY; ky <= anchorY; ++ky )
+                    for ( int32_t x = x0; x < x1; x++ )
                     {
-                        sum += *( srcPtr + ky * stride + x ) *
-                               static_cast< sumType >( *kernelIt++ );
+                        sumType sum { };
+                        auto kernelIt = kernelStart;
+
+                        for ( int32_t ky = -anchorY; ky <= anchorY; ++ky )
+                        {
+                            sum += srcPtr[ ky * stride + x * step ] *
+                                   static_cast< sumType >( *kernelIt++ );
+                        }
+
+                        sum = static_cast< sumType >(
+                            static_cast< float >( sum ) * scale );
+
+                        dstPtr[ x * step ] = static_cast< uint8_t >( sum );
                     }
+                }
+            }
+        }
+    }
 
-                    sum = static_cast< sumType >( static_cast< float >( sum ) *
-                                                  scale );
+    /*
+     * Function that filters all lines with a fixed-point kernel. The rows
+     * above and below the image are mirrored like in the scalar version.
+     */
+    static void applyFixedPoint( const ImageIn& imageIn, ImageOut& imageOut,
+                                 const detail::FixedPointKernel& kernel )
+    {
+        constexpr auto step = ImageIn::pixel_step;
+
+        const auto height = imageIn.getHeight( );
+        const auto anchorY = kernel.size / 2;
+        const auto level = core::getSimdLevel( );
+
+        const auto count = imageIn.getWidth( ) * step;
+        const auto stripWidth = detail::getColumnStripWidth( kernel.size, 1 );
+
+        std::array< const uint8_t*, detail::FixedPointKernel::max_size > rows;
+
+        for ( int32_t plane = 0; plane < ImageIn::number_planes; plane++ )
+        {
+            for ( int32_t x = 0; x < count; x += stripWidth )
+            {
+                const auto stripCount = std::min( stripWidth, count - x );
+
+                for ( int32_t y = 0; y < height; y++ )
+                {
+                    for ( int32_t k = 0; k < kernel.size; k++ )
+                    {
+                        auto idx = std::abs( y + k - anchorY );
+                        if ( idx > height - 1 )
+                        {
+                            idx = 2 * ( height - 1 ) - idx;
+                        }
+
+                        rows[ static_cast< size_t >( k ) ] =
+                            imageIn.getRowPointer( idx, plane ) + x;
+                    }
 
-                    *( dstPtr + x ) = static_cast< uint8_t >( sum );
+                    detail::filterColumnFixedPoint(
+                        rows.data( ),
+                        imageOut.getRowPointer( y, plane ) + x,
+                        stripCount,
+                        kernel,
+                        level );
                 }
             }
         }
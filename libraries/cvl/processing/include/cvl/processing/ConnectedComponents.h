@@ -2,268 +2,889 @@
 
 // CVL includes
 #include <cvl/core/Image.h>
+#include <cvl/core/Parallel.h>
 #include <cvl/core/Region.h>
+#include <cvl/core/RegionRLE.h>
 #include <cvl/processing/Area.h>
+#include <cvl/processing/Blob.h>
 #include <cvl/processing/BoundingBox.h>
 #include <cvl/processing/Center.h>
+#include <cvl/processing/EquivalenceTable.h>
+#include <cvl/processing/RegionSet.h>
+#include <cvl/processing/Threshold.h>
 
 // STD includes
-
-template < typename Derived >
-constexpr bool hasGetArea = requires( Derived derived ) { derived.getArea( ); };
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cvl::processing
 {
 template < typename Allocator >
 using allocator_traits = std::allocator_traits< Allocator >;
 
+/**
+ * @brief The neighbourhood that connects two foreground pixels
+ */
+enum class Connectivity
+{
+    /**
+     * Horizontal and vertical neighbours
+     */
+    Four = 4,
+
+    /**
+     * Horizontal, vertical and diagonal neighbours
+     */
+    Eight = 8
+};
+
 namespace detail
 {
 
-struct Blob
+/*
+ * The first pixel of a provisional label in raster scan order. It replaces
+ * the blob statistics during the labeling if no region feature needs them,
+ * because the final labels are still ordered by the first pixel.
+ */
+struct FirstPixel
 {
     int32_t top { };
-    int32_t bottom { };
-    int32_t left { };
-    int32_t right { };
-    int32_t area { };
+    int32_t firstColumn { };
     int32_t label { };
-    int32_t sumX { };
-    int32_t sumY { };
 
-    Blob( int32_t x, int32_t y, int32_t objectId )
+    FirstPixel( ) = default;
+
+    FirstPixel( int32_t x, int32_t y, int32_t objectId )
         : top( y )
-        , bottom( y )
-        , left( x )
-        , right( x )
-        , area( 1 )
+        , firstColumn( x )
         , label( objectId )
-        , sumX( x )
-        , sumY( y )
     {
     }
 
     void add( int32_t x, int32_t y )
     {
-        area += 1;
-        sumX += x;
-        sumY += y;
-
-        if ( x < left )
+        if ( y < top || ( y == top && x < firstColumn ) )
         {
-            left = x;
+            top = y;
+            firstColumn = x;
         }
+    }
 
-        if ( x > right )
+    void merge( const FirstPixel& other )
+    {
+        add( other.firstColumn, other.top );
+    }
+
+    void shift( int32_t dx, int32_t dy )
+    {
+        firstColumn += dx;
+        top += dy;
+    }
+};
+
+/*
+ * Function that performs the first labeling pass for the 4 connected
+ * neighbourhood. Every foreground pixel gets a provisional label which is
+ * written to the label image. Background pixels are set to 0. Equivalences
+ * between provisional labels are recorded in the equivalence table and the
+ * blob statistics are accumulated per provisional label.
+ *
+ * | |c| |
+ * |a|x|0|
+ * |0|0|0|
+ *
+ * @param [in]       imageIn        The binary input image.
+ * @param [in out]   labelImage     The label image receiving the provisional
+ *                                  labels.
+ * @param [in out]   equivalences   The equivalence table.
+ * @param [in out]   blobs          The blob statistics for each provisional
+ *                                  label.
+ */
+template < typename Statistics, typename PixelType, typename Allocator,
+           typename LabelAllocator >
+void labelProvisionalPixels(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    const core::Image< PixelType, 1, LabelAllocator >& labelImage,
+    EquivalenceTable& equivalences, std::vector< Statistics >& blobs )
+{
+    const auto width = imageIn.getWidth( );
+    const auto height = imageIn.getHeight( );
+
+    constexpr auto maxLabel =
+        static_cast< int64_t >( std::numeric_limits< PixelType >::max( ) );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        const auto rowPtrSrc = imageIn.getRowPointer( y );
+        const auto rowPtrLbl = labelImage.getRowPointer( y );
+        const auto rowPtrTop =
+            y > 0 ? labelImage.getRowPointer( y - 1 ) : nullptr;
+
+        for ( int32_t x = 0; x < width; x++ )
         {
-            right = x;
+            // NOTE: For connected component labeling we do not expect all
+            // pixels to be a foreground pixel. Casting the row pointer to a
+            // 64 bit pointer and checking for 0 can improve performance for
+            // images with less information.
+
+            // Check 8 pixels at the same time
+            if ( x + 7 < width &&
+                 ! *reinterpret_cast< const uint64_t* >( rowPtrSrc + x ) )
+            {
+                std::fill_n( rowPtrLbl + x, 8, PixelType { 0 } );
+                x += 7;
+                continue;
+            }
+
+            if ( rowPtrSrc[ x ] == 0 )
+            {
+                rowPtrLbl[ x ] = PixelType { 0 };
+                continue;
+            }
+
+            const int32_t a =
+                x > 0 ? static_cast< int32_t >( rowPtrLbl[ x - 1 ] ) : 0;
+            const int32_t c =
+                rowPtrTop != nullptr ? static_cast< int32_t >( rowPtrTop[ x ] )
+                                     : 0;
+
+            int32_t label { };
+
+            if ( c != 0 )
+            {
+                // a and c are only connected through x
+                label = a != 0 && a != c ? equivalences.unite( c, a ) : c;
+            }
+            else if ( a != 0 )
+            {
+                label = a;
+            }
+            else
+            {
+                label = equivalences.newLabel( );
+
+                EXPECT_MSG( label <= maxLabel,
+                            "Number of labels exceeds the range of the label "
+                            "image pixel type ("
+                                << maxLabel << ")" );
+
+                blobs.emplace_back( x, y, label );
+                rowPtrLbl[ x ] = static_cast< PixelType >( label );
+                continue;
+            }
+
+            rowPtrLbl[ x ] = static_cast< PixelType >( label );
+            blobs[ static_cast< size_t >( label - 1 ) ].add( x, y );
         }
+    }
+}
+
+/*
+ * Function that performs the first labeling pass for the 8 connected
+ * neighbourhood. The image is scanned in blocks of 2x2 pixels. All foreground
+ * pixels of a block are 8 connected, so they share one provisional label,
+ * which is written to the label image. Background pixels are set to 0.
+ *
+ * The block X is connected to the blocks P, Q, R and S if one of the pixels
+ * b to h is a foreground pixel adjacent to a foreground pixel of X. The
+ * decision tree reads the labels of the neighbour blocks only for the
+ * connections that are not implied by the previous blocks, e.g. S is already
+ * connected to Q if g and c are foreground pixels.
+ *
+ * |P|P|Q|Q|R|R|
+ * |P|b|c|d|e|R|
+ * |S|g|o|p|
+ * |S|h|s|t|
+ *
+ * @param [in]       imageIn        The binary input image.
+ * @param [in out]   labelImage     The label image receiving the provisional
+ *                                  labels.
+ * @param [in out]   equivalences   The equivalence table.
+ * @param [in out]   blobs          The blob statistics for each provisional
+ *                                  label.
+ */
+template < typename Statistics, typename PixelType, typename Allocator,
+           typename LabelAllocator >
+void labelProvisionalBlocks(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    const core::Image< PixelType, 1, LabelAllocator >& labelImage,
+    EquivalenceTable& equivalences, std::vector< Statistics >& blobs )
+{
+    const auto width = imageIn.getWidth( );
+    const auto height = imageIn.getHeight( );
 
-        if ( y < top )
+    constexpr auto maxLabel =
+        static_cast< int64_t >( std::numeric_limits< PixelType >::max( ) );
+
+    for ( int32_t y = 0; y < height; y += 2 )
+    {
+        const auto hasBottom = y + 1 < height;
+
+        const auto rowPtrSrc = imageIn.getRowPointer( y );
+        const auto rowPtrLbl = labelImage.getRowPointer( y );
+        const auto rowPtrSrcTop =
+            y > 0 ? imageIn.getRowPointer( y - 1 ) : nullptr;
+        const auto rowPtrLblTop =
+            y > 0 ? labelImage.getRowPointer( y - 1 ) : nullptr;
+        const auto rowPtrSrcBottom =
+            hasBottom ? imageIn.getRowPointer( y + 1 ) : nullptr;
+        const auto rowPtrLblBottom =
+            hasBottom ? labelImage.getRowPointer( y + 1 ) : nullptr;
+
+        for ( int32_t x = 0; x < width; x += 2 )
         {
-            top = y;
+            // Check 8 pixels of both rows at the same time
+            if ( x + 7 < width &&
+                 ! *reinterpret_cast< const uint64_t* >( rowPtrSrc + x ) &&
+                 ( ! hasBottom || ! *reinterpret_cast< const uint64_t* >(
+                                      rowPtrSrcBottom + x ) ) )
+            {
+                std::fill_n( rowPtrLbl + x, 8, PixelType { 0 } );
+
+                if ( hasBottom )
+                {
+                    std::fill_n( rowPtrLblBottom + x, 8, PixelType { 0 } );
+                }
+
+                x += 6;
+                continue;
+            }
+
+            const auto hasRight = x + 1 < width;
+
+            const auto o = rowPtrSrc[ x ] != 0;
+            const auto p = hasRight && rowPtrSrc[ x + 1 ] != 0;
+            const auto s = hasBottom && rowPtrSrcBottom[ x ] != 0;
+            const auto t =
+                hasBottom && hasRight && rowPtrSrcBottom[ x + 1 ] != 0;
+
+            if ( ! ( o || p || s || t ) )
+            {
+                rowPtrLbl[ x ] = PixelType { 0 };
+
+                if ( hasRight )
+                {
+                    rowPtrLbl[ x + 1 ] = PixelType { 0 };
+                }
+
+                if ( hasBottom )
+                {
+                    rowPtrLblBottom[ x ] = PixelType { 0 };
+
+                    if ( hasRight )
+                    {
+                        rowPtrLblBottom[ x + 1 ] = PixelType { 0 };
+                    }
+                }
+
+                continue;
+            }
+
+            int32_t label { };
+
+            const auto connect = [ &label, &equivalences ]( PixelType other )
+            {
+                const auto otherLabel = static_cast< int32_t >( other );
+
+                label = label == 0 ? otherLabel
+                                   : equivalences.unite( label, otherLabel );
+            };
+
+            // Connections to the blocks above. Only o and p touch them.
+            auto connectedB = false;
+            auto connectedC = false;
+
+            if ( rowPtrSrcTop != nullptr && ( o || p ) )
+            {
+                const auto b = x > 0 && rowPtrSrcTop[ x - 1 ] != 0;
+                const auto c = rowPtrSrcTop[ x ] != 0;
+                const auto d = hasRight && rowPtrSrcTop[ x + 1 ] != 0;
+                const auto e = x + 2 < width && rowPtrSrcTop[ x + 2 ] != 0;
+
+                if ( c )
+                {
+                    // b and d are neighbours of c and therefore already
+                    // connected to c
+                    connect( rowPtrLblTop[ x ] );
+                    connectedC = true;
+                    connectedB = o && b;
+                }
+                else
+                {
+                    if ( d )
+                    {
+                        connect( rowPtrLblTop[ x + 1 ] );
+                    }
+
+                    if ( o && b )
+                    {
+                        connect( rowPtrLblTop[ x - 1 ] );
+                        connectedB = true;
+                    }
+                }
+
+                // e is a neighbour of d and therefore already connected to d
+                if ( p && e && ! d )
+                {
+                    connect( rowPtrLblTop[ x + 2 ] );
+                }
+            }
+
+            // Connection to the left block. Only o and s touch it.
+            if ( x > 0 && ( o || s ) )
+            {
+                const auto g = rowPtrSrc[ x - 1 ] != 0;
+
+                if ( g )
+                {
+                    // g is a neighbour of b and c
+                    if ( ! connectedB && ! connectedC )
+                    {
+                        connect( rowPtrLbl[ x - 1 ] );
+                    }
+                }
+                else if ( hasBottom && rowPtrSrcBottom[ x - 1 ] != 0 )
+                {
+                    connect( rowPtrLblBottom[ x - 1 ] );
+                }
+            }
+
+            const auto isNew = label == 0;
+
+            if ( isNew )
+            {
+                label = equivalences.newLabel( );
+
+                EXPECT_MSG( label <= maxLabel,
+                            "Number of labels exceeds the range of the label "
+                            "image pixel type ("
+                                << maxLabel << ")" );
+            }
+
+            const auto value = static_cast< PixelType >( label );
+            constexpr auto zero = PixelType { 0 };
+
+            rowPtrLbl[ x ] = o ? value : zero;
+
+            if ( hasRight )
+            {
+                rowPtrLbl[ x + 1 ] = p ? value : zero;
+            }
+
+            if ( hasBottom )
+            {
+                rowPtrLblBottom[ x ] = s ? value : zero;
+
+                if ( hasRight )
+                {
+                    rowPtrLblBottom[ x + 1 ] = t ? value : zero;
+                }
+            }
+
+            // The statistics of the block are accumulated at once
+            const auto top = o || p ? y : y + 1;
+            const auto first = ( o || p ? o : s ) ? 0 : 1;
+            [[maybe_unused]] const auto left = o || s ? 0 : 1;
+            [[maybe_unused]] const auto right = p || t ? 1 : 0;
+
+            Statistics block( x + first, top, label );
+
+            if constexpr ( std::is_same_v< Statistics, Blob > )
+            {
+                block.bottom = s || t ? y + 1 : y;
+                block.left = x + left;
+                block.right = x + right;
+                block.area = o + p + s + t;
+                block.sumX = static_cast< int64_t >( o + s ) * x +
+                             static_cast< int64_t >( p + t ) * ( x + 1 );
+                block.sumY = static_cast< int64_t >( o + p ) * y +
+                             static_cast< int64_t >( s + t ) * ( y + 1 );
+            }
+
+            if ( isNew )
+            {
+                blobs.push_back( block );
+            }
+            else
+            {
+                blobs[ static_cast< size_t >( label - 1 ) ].merge( block );
+            }
         }
+    }
+}
 
-        if ( y > bottom )
+/*
+ * Function that performs the first labeling pass. Every foreground pixel gets
+ * a provisional label which is written to the label image. Background pixels
+ * are set to 0. Equivalences between provisional labels are recorded in the
+ * equivalence table and the blob statistics are accumulated per provisional
+ * label.
+ *
+ * The 4 connected neighbourhood is scanned pixel by pixel, the 8 connected
+ * neighbourhood in blocks of 2x2 pixels. The statistics are either the full
+ * Blob or only the FirstPixel of each label.
+ *
+ * @param [in]       imageIn        The binary input image.
+ * @param [in out]   labelImage     The label image receiving the provisional
+ *                                  labels.
+ * @param [in out]   equivalences   The equivalence table.
+ * @param [in out]   blobs          The blob statistics for each provisional
+ *                                  label.
+ */
+template < Connectivity connectivity, typename Statistics, typename PixelType,
+           typename Allocator, typename LabelAllocator >
+void labelProvisional(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    const core::Image< PixelType, 1, LabelAllocator >& labelImage,
+    EquivalenceTable& equivalences, std::vector< Statistics >& blobs )
+{
+    if constexpr ( connectivity == Connectivity::Eight )
+    {
+        labelProvisionalBlocks< Statistics >(
+            imageIn, labelImage, equivalences, blobs );
+    }
+    else
+    {
+        labelProvisionalPixels< Statistics >(
+            imageIn, labelImage, equivalences, blobs );
+    }
+}
+
+/*
+ * Function that performs the labeling pass without a label image. The
+ * provisional labels of the current and the previous row are kept in a two
+ * row buffer. Equivalences between provisional labels are recorded in the
+ * equivalence table and the blob statistics are accumulated per provisional
+ * label. The pixels are scanned one by one with a decision tree, so that in
+ * most cases only one neighbour needs to be read.
+ *
+ * |b|c|d|
+ * |a|x|0|
+ * |0|0|0|
+ *
+ * For the 4 connected neighbourhood only a and c are checked.
+ *
+ * @param [in]       imageIn        The binary input image.
+ * @param [in out]   equivalences   The equivalence table.
+ * @param [in out]   blobs          The blob statistics for each provisional
+ *                                  label.
+ */
+template < Connectivity connectivity, typename Allocator >
+void labelStatistics( const core::Image< uint8_t, 1, Allocator >& imageIn,
+                      EquivalenceTable& equivalences,
+                      std::vector< Blob >& blobs )
+{
+    const auto width = imageIn.getWidth( );
+    const auto height = imageIn.getHeight( );
+
+    // One pixel padding on both sides, so the neighbours of the border pixels
+    // are background
+    std::vector< int32_t > previousRow( static_cast< size_t >( width ) + 2 );
+    std::vector< int32_t > currentRow( static_cast< size_t >( width ) + 2 );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        const auto rowPtrSrc = imageIn.getRowPointer( y );
+        const auto rowPtrLbl = currentRow.data( ) + 1;
+        const auto rowPtrTop = previousRow.data( ) + 1;
+
+        for ( int32_t x = 0; x < width; x++ )
         {
-            bottom = y;
+            // Check 8 pixels at the same time
+            if ( x + 7 < width &&
+                 ! *reinterpret_cast< const uint64_t* >( rowPtrSrc + x ) )
+            {
+                std::fill_n( rowPtrLbl + x, 8, 0 );
+                x += 7;
+                continue;
+            }
+
+            if ( rowPtrSrc[ x ] == 0 )
+            {
+                rowPtrLbl[ x ] = 0;
+                continue;
+            }
+
+            const auto a = rowPtrLbl[ x - 1 ];
+            const auto c = rowPtrTop[ x ];
+
+            int32_t label { };
+
+            if constexpr ( connectivity == Connectivity::Four )
+            {
+                if ( c != 0 )
+                {
+                    label = a != 0 && a != c ? equivalences.unite( c, a ) : c;
+                }
+                else if ( a != 0 )
+                {
+                    label = a;
+                }
+            }
+            else if ( c != 0 )
+            {
+                label = c;
+            }
+            else if ( const auto d = rowPtrTop[ x + 1 ]; d != 0 )
+            {
+                label = d;
+
+                if ( a != 0 )
+                {
+                    equivalences.unite( d, a );
+                }
+                else if ( rowPtrTop[ x - 1 ] != 0 )
+                {
+                    equivalences.unite( d, rowPtrTop[ x - 1 ] );
+                }
+            }
+            else if ( rowPtrTop[ x - 1 ] != 0 )
+            {
+                label = rowPtrTop[ x - 1 ];
+            }
+            else if ( a != 0 )
+            {
+                label = a;
+            }
+
+            if ( label == 0 )
+            {
+                label = equivalences.newLabel( );
+
+                blobs.emplace_back( x, y, label );
+                rowPtrLbl[ x ] = label;
+                continue;
+            }
+
+            rowPtrLbl[ x ] = label;
+            blobs[ static_cast< size_t >( label - 1 ) ].add( x, y );
         }
+
+        std::swap( previousRow, currentRow );
     }
+}
 
-    void merge( const Blob& other )
+/*
+ * Function that resolves the provisional labels. The blob statistics of all
+ * equivalent labels are merged. The resulting blobs are ordered by their
+ * final label, which is the order of their first pixel in raster scan order.
+ * If the labels have not been created in raster scan order, e.g. by the block
+ * scan, the final labels of the equivalence table are renumbered.
+ *
+ * @param [in out]   equivalences   The equivalence table.
+ * @param [in]       blobs          The blob statistics for each provisional
+ *                                  label.
+ *
+ * @return The blob statistics for each final label.
+ */
+template < typename Statistics >
+std::vector< Statistics >
+resolveLabels( EquivalenceTable& equivalences,
+               const std::vector< Statistics >& blobs )
+{
+    const auto numberLabels = equivalences.flatten( );
+
+    // The position of the first pixel of each final label in raster scan
+    // order
+    std::vector< int64_t > firstPixels(
+        static_cast< size_t >( numberLabels ) + 1,
+        std::numeric_limits< int64_t >::max( ) );
+
+    for ( int32_t label = 1; label <= equivalences.size( ); label++ )
+    {
+        const auto finalLabel =
+            static_cast< size_t >( equivalences.getFinalLabel( label ) );
+        const auto& blob = blobs[ static_cast< size_t >( label - 1 ) ];
+
+        firstPixels[ finalLabel ] =
+            std::min( firstPixels[ finalLabel ],
+                      ( static_cast< int64_t >( blob.top ) << 32 ) |
+                          blob.firstColumn );
+    }
+
+    if ( ! std::is_sorted( firstPixels.begin( ) + 1, firstPixels.end( ) ) )
     {
-        area += other.area;
-        sumX += other.sumX;
-        sumY += other.sumY;
+        // The labels are almost in raster scan order, e.g. the block scan
+        // only swaps labels within a pair of rows. Sorting the labels by
+        // their first row with a counting sort and then sorting the few
+        // labels of each row is much faster than sorting all labels at once.
+        const auto getRow = [ &firstPixels ]( int32_t finalLabel )
+        {
+            return static_cast< size_t >(
+                firstPixels[ static_cast< size_t >( finalLabel ) ] >> 32 );
+        };
+
+        size_t numberRows { };
 
-        if ( other.left < left )
+        for ( int32_t finalLabel = 1; finalLabel <= numberLabels;
+              finalLabel++ )
         {
-            left = other.left;
+            numberRows = std::max( numberRows, getRow( finalLabel ) + 1 );
         }
 
-        if ( other.right > right )
+        std::vector< int32_t > rowBegin( numberRows + 1 );
+
+        for ( int32_t finalLabel = 1; finalLabel <= numberLabels;
+              finalLabel++ )
         {
-            right = other.right;
+            rowBegin[ getRow( finalLabel ) + 1 ]++;
         }
 
-        if ( other.top < top )
+        for ( size_t row = 1; row <= numberRows; row++ )
         {
-            top = other.top;
+            rowBegin[ row ] += rowBegin[ row - 1 ];
         }
 
-        if ( other.bottom > bottom )
+        std::vector< int32_t > order( static_cast< size_t >( numberLabels ) );
+        auto rowEnd = rowBegin;
+
+        for ( int32_t finalLabel = 1; finalLabel <= numberLabels;
+              finalLabel++ )
         {
-            bottom = other.bottom;
+            order[ static_cast< size_t >( rowEnd[ getRow( finalLabel ) ]++ ) ] =
+                finalLabel;
         }
-    }
 
-    [[nodiscard]] core::Rectangle< int32_t > getBoundingRect( ) const
-    {
-        return { core::Point< int32_t, 2 >( left, top ),
-                 core::Size( right - left + 1, bottom - top + 1 ) };
+        const auto isBefore = [ &firstPixels ]( int32_t lhs, int32_t rhs )
+        {
+            return firstPixels[ static_cast< size_t >( lhs ) ] <
+                   firstPixels[ static_cast< size_t >( rhs ) ];
+        };
+
+        for ( size_t row = 0; row < numberRows; row++ )
+        {
+            const auto begin = order.begin( ) + rowBegin[ row ];
+            const auto end = order.begin( ) + rowBegin[ row + 1 ];
+
+            if ( ! std::is_sorted( begin, end, isBefore ) )
+            {
+                std::sort( begin, end, isBefore );
+            }
+        }
+
+        std::vector< int32_t > finalLabels( order.size( ) + 1 );
+
+        for ( size_t i = 0; i < order.size( ); i++ )
+        {
+            finalLabels[ static_cast< size_t >( order[ i ] ) ] =
+                static_cast< int32_t >( i ) + 1;
+        }
+
+        equivalences.renumber( finalLabels );
     }
 
-    [[nodiscard]] core::Point< double, 2 > getCenter( ) const
+    std::vector< Statistics > blobsOut(
+        static_cast< size_t >( numberLabels ) );
+
+    for ( int32_t label = 1; label <= equivalences.size( ); label++ )
     {
-        return {
-            core::Point< double, 2 >( sumX / static_cast< double >( area ),
-                                      sumY / static_cast< double >( area ) ) };
+        const auto finalLabel = equivalences.getFinalLabel( label );
+        const auto index = static_cast< size_t >( finalLabel - 1 );
+        const auto& blob = blobs[ static_cast< size_t >( label - 1 ) ];
+
+        // The blob of a final label has no label until its first provisional
+        // label is visited
+        if ( blobsOut[ index ].label == 0 )
+        {
+            blobsOut[ index ] = blob;
+            blobsOut[ index ].label = finalLabel;
+        }
+        else
+        {
+            blobsOut[ index ].merge( blob );
+        }
     }
 
-    [[nodiscard]] int32_t getArea( ) const { return area; }
-};
+    return blobsOut;
+}
 
 /*
- * Function that check the 8 connected neighbourhood for labeling
+ * Function that creates the lookup table from provisional to final labels.
  *
- * |x|x|x|
- * |x|c|0|
- * |0|0|0|
+ * @param [in]   equivalences   The flattened equivalence table.
+ * @param [in]   offset         The offset of the provisional labels in the
+ *                              table.
+ * @param [in]   numberLabels   The number of provisional labels.
  *
- * @param [in]       x               The x position of the current pixel
- * @param [in]       y               The y position of the current pixel
- * @param [in]       refTable        The reference table containing already
- * applied label numbers.
- * @param [in out]   neighbourhood   The vector receiving the neighbours.
+ * @return The lookup table, indexed by provisional label.
  */
-template < typename PixelType, typename Allocator >
-void checkNeighbourhood( const int32_t x, const int32_t y,
-                         const core::Image< PixelType, 1, Allocator >& refTable,
-                         std::vector< PixelType >& neighbourhood )
+template < typename PixelType >
+std::vector< PixelType >
+createLookupTable( const EquivalenceTable& equivalences, int32_t offset,
+                   int32_t numberLabels )
 {
-    // TODO: Make template for 4 or 8 connectivity. Make neighborhood as an enum
-    // class
-    const auto top = y - 1 >= 0 ? y - 1 : y;
-    const auto left = x - 1 >= 0 ? x - 1 : x;
-    const auto right = x + 1 < refTable.getWidth( ) ? x + 1 : x;
-
-    const auto yPtr = refTable.getRowPointer( y );
-    const auto topPtr = refTable.getRowPointer( top );
-
-    neighbourhood[ 0 ] = yPtr[ left ];
-    neighbourhood[ 1 ] = topPtr[ left ];
-    neighbourhood[ 2 ] = topPtr[ x ];
-    neighbourhood[ 3 ] = topPtr[ right ];
+    std::vector< PixelType > lookupTable(
+        static_cast< size_t >( numberLabels ) + 1 );
+
+    for ( int32_t label = 1; label <= numberLabels; label++ )
+    {
+        lookupTable[ static_cast< size_t >( label ) ] =
+            static_cast< PixelType >(
+                equivalences.getFinalLabel( offset + label ) );
+    }
+
+    return lookupTable;
 }
 
 /*
- * Function that returns the smallest element that is non-zero
+ * Function that performs the second labeling pass. All provisional labels in
+ * the label image are replaced by the final labels.
  *
- * |x|x|x|
- * |x|c|0|
- * |0|0|0|
- *
- * @param [in]   neighbourhood   The vector receiving the neighbours.
- *
- * @return Returns the smallest non-zero element if exists, else zero.
+ * @param [in out]   labelImage     The label image.
+ * @param [in]       lookupTable    The final label for each provisional label.
  */
-template < typename PixelType >
-PixelType smallestNeighbour( const std::vector< PixelType >& neighbourhood,
-                             const std::vector< PixelType >& activeLabels )
+template < typename PixelType, typename LabelAllocator >
+void relabel( const core::Image< PixelType, 1, LabelAllocator >& labelImage,
+              const std::vector< PixelType >& lookupTable )
 {
-    PixelType smallest = std::numeric_limits< PixelType >::max( );
+    const auto width = labelImage.getWidth( );
+    const auto height = labelImage.getHeight( );
+    const auto lookupPtr = lookupTable.data( );
 
-    for ( const auto& elem : neighbourhood )
+    for ( int32_t y = 0; y < height; y++ )
     {
-        if ( elem > 0 )
-        {
-            const auto label =
-                activeLabels[ static_cast< size_t >( elem - 1 ) ];
+        const auto rowPtrLbl = labelImage.getRowPointer( y );
 
-            if ( label < smallest )
-            {
-                smallest = label;
-            }
+        for ( int32_t x = 0; x < width; x++ )
+        {
+            rowPtrLbl[ x ] =
+                lookupPtr[ static_cast< size_t >( rowPtrLbl[ x ] ) ];
         }
     }
-
-    return smallest == std::numeric_limits< PixelType >::max( )
-               ? PixelType { 0 }
-               : smallest;
 }
 
 /*
- * Function that creates a new object list and updates the reference table
+ * Function that performs the second labeling pass. All provisional labels in
+ * the label image are replaced by the final labels.
  *
+ * @param [in out]   labelImage     The label image.
+ * @param [in]       equivalences   The flattened equivalence table.
+ */
+template < typename PixelType, typename LabelAllocator >
+void relabel( const core::Image< PixelType, 1, LabelAllocator >& labelImage,
+              const EquivalenceTable& equivalences )
+{
+    relabel( labelImage,
+             createLookupTable< PixelType >(
+                 equivalences, 0, equivalences.size( ) ) );
+}
+
+/*
+ * Function that merges the provisional labels of two adjacent strips. The
+ * first row of the lower strip is checked against the last row of the upper
+ * strip.
  *
- * @param [in]       x              The x position of the current pixel
- * @param [in]       y              The y position of the current pixel
- * @param [in]       objects        The table of already created objects
- * @param [in out]   referenceTable The reference table.
+ * @param [in]       upperRow       The last label row of the upper strip.
+ * @param [in]       upperOffset    The label offset of the upper strip.
+ * @param [in]       lowerRow       The first label row of the lower strip.
+ * @param [in]       lowerOffset    The label offset of the lower strip.
+ * @param [in]       width          The width of the rows.
+ * @param [in out]   equivalences   The global equivalence table.
  */
-template < typename PixelType >
-void createElement( const int32_t x, const int32_t y,
-                    std::vector< std::shared_ptr< Blob > >& objects,
-                    std::vector< PixelType >& activeLabels,
-                    const PixelType labelNumber )
+template < Connectivity connectivity, typename PixelType >
+void mergeStripBorder( const PixelType* upperRow, int32_t upperOffset,
+                       const PixelType* lowerRow, int32_t lowerOffset,
+                       int32_t width, EquivalenceTable& equivalences )
 {
-    objects.push_back( std::make_shared< Blob >( x, y, labelNumber ) );
+    for ( int32_t x = 0; x < width; x++ )
+    {
+        const auto label = static_cast< int32_t >( lowerRow[ x ] );
 
-    activeLabels.push_back( labelNumber );
+        if ( label == 0 )
+        {
+            continue;
+        }
+
+        constexpr auto reach = connectivity == Connectivity::Eight ? 1 : 0;
+
+        const auto xBegin = std::max( x - reach, 0 );
+        const auto xEnd = std::min( x + reach, width - 1 );
+
+        for ( auto xu = xBegin; xu <= xEnd; xu++ )
+        {
+            const auto upperLabel = static_cast< int32_t >( upperRow[ xu ] );
+
+            if ( upperLabel != 0 )
+            {
+                equivalences.unite( upperOffset + upperLabel,
+                                    lowerOffset + label );
+            }
+        }
+    }
 }
 
-/*
- * Function that adds a point to an existing object. NOTE that 0 is not a valid
- * label number. 0 means background.
- * The object is added to object at index labelNumber - 1
- *
- *
- * @param [in]       x              The x position of the current pixel
- * @param [in]       y              The y position of the current pixel
- * @param [in]       objects        The table of already created objects
+/**
+ * Function that assigns provisional labels to the runs of a region. Two runs
+ * of adjacent rows are connected if they overlap. For the 8 connected
+ * neighbourhood, runs that touch diagonally are connected as well.
  *
+ * @param [in]  runs            The sorted runs.
+ * @param [in]  equivalences    The equivalence table of the labels.
+ * @param [out] runLabels       The provisional label of each run.
  */
-template < typename PixelType >
-void addElement( const int32_t x, const int32_t y, const PixelType labelNumber,
-                 const std::vector< std::shared_ptr< Blob > >& objects )
+template < Connectivity connectivity >
+void labelRuns( const std::vector< core::Run >& runs,
+                EquivalenceTable& equivalences,
+                std::vector< int32_t >& runLabels )
 {
-    objects[ static_cast< size_t >( labelNumber - 1 ) ]->add( x, y );
-}
+    constexpr auto reach = connectivity == Connectivity::Eight ? 1 : 0;
 
-/*
- * Function that merges elements together, if elements in the neighborhood
- have a different label number.
- *
- * @param [in]    neighbourhood  The vector receiving the neighbours.
- * @param [in]    newLabelNumber The label number to merge to.
- * @param [in]    objects        The table of already created objects.
- * @param [in]    referenceTable The reference table.
- *
- */
-template < typename PixelType >
-void mergeElement( const std::vector< PixelType >& neighbourhood,
-                   const PixelType newLabelNumber,
-                   std::vector< std::shared_ptr< Blob > >& objects,
-                   std::vector< PixelType >& activeLabels )
-{
-    for ( const auto& elem : neighbourhood )
+    runLabels.resize( runs.size( ) );
+
+    // Range of the runs of the previous row
+    size_t previousBegin { };
+    size_t previousEnd { };
+
+    size_t i = 0;
+    while ( i < runs.size( ) )
     {
-        if ( elem > 0 )
+        const auto row = runs[ i ].row;
+        const auto rowBegin = i;
+
+        if ( previousEnd == 0 || runs[ previousBegin ].row != row - 1 )
         {
-            const auto old_l = static_cast< size_t >( elem - 1 );
-            const auto new_l = static_cast< size_t >( newLabelNumber - 1 );
-            // Get the real label number of the current object, it could already
-            // be merged
-            const auto realElemNum = activeLabels[ old_l ];
+            previousBegin = previousEnd = rowBegin;
+        }
+
+        // The runs of both rows are sorted, so the first candidate of the
+        // previous row only moves forward
+        auto candidate = previousBegin;
+
+        for ( ; i < runs.size( ) && runs[ i ].row == row; i++ )
+        {
+            const auto& run = runs[ i ];
+            int32_t label { };
 
-            if ( realElemNum != newLabelNumber )
+            while ( candidate < previousEnd &&
+                    runs[ candidate ].colEnd < run.colStart - reach )
             {
-                if ( objects[ old_l ] == objects[ new_l ] )
-                    continue;
+                candidate++;
+            }
 
-                objects[ new_l ]->merge( *objects[ old_l ] );
+            for ( auto j = candidate;
+                  j < previousEnd && runs[ j ].colStart <= run.colEnd + reach;
+                  j++ )
+            {
+                label = label == 0
+                            ? runLabels[ j ]
+                            : equivalences.unite( label, runLabels[ j ] );
+            }
 
-                // All active labels needs to be changed to the merged one
-                for ( size_t i = 0; i < activeLabels.size( ); i++ )
-                {
-                    if ( activeLabels[ i ] == realElemNum )
-                    {
-                        activeLabels[ i ] = newLabelNumber;
-                        objects[ i ] = objects[ new_l ];
-                    }
-                }
+            if ( label == 0 )
+            {
+                label = equivalences.newLabel( );
             }
+
+            runLabels[ i ] = label;
         }
+
+        previousBegin = rowBegin;
+        previousEnd = i;
     }
 }
 
@@ -271,6 +892,19 @@ template < typename PixelType, typename Allocator,
            template < typename > typename... RegionFeature >
 struct ConnectedComponentsDetector
 {
+    using RegionType =
+        core::Region< PixelType,
+                      typename std::allocator_traits<
+                          Allocator >::template rebind_alloc< PixelType >,
+                      RegionFeature... >;
+
+    // The blob statistics are only accumulated if a region feature is set
+    // from them. Otherwise, only the first pixel of each label is tracked.
+    static constexpr bool hasBlobFeature =
+        ( BlobFeature< RegionFeature< RegionType > > || ... );
+
+    using Statistics = std::conditional_t< hasBlobFeature, Blob, FirstPixel >;
+
     static std::vector< std::unique_ptr<
         core::Region< PixelType,
                       typename std::allocator_traits<
@@ -282,6 +916,7 @@ struct ConnectedComponentsDetector
         THROW_MSG( "Unsupported PixelType" );
     }
 
+    template < Connectivity connectivity = Connectivity::Eight >
     static std::vector< std::unique_ptr<
         core::Region< PixelType,
                       typename std::allocator_traits<
@@ -292,6 +927,77 @@ struct ConnectedComponentsDetector
         core::Image< PixelType, 1,
                      typename std::allocator_traits< Allocator >::
                          template rebind_alloc< PixelType > >& labelImageOut )
+    {
+        return createRegions(
+            labelImageOut,
+            labelBlobs< connectivity, Statistics >( imageIn, labelImageOut ) );
+    }
+
+    template < Connectivity connectivity = Connectivity::Eight >
+    static std::vector< std::unique_ptr<
+        core::Region< PixelType,
+                      typename std::allocator_traits<
+                          Allocator >::template rebind_alloc< PixelType >,
+                      RegionFeature... > > >
+    connectionParallel(
+        const core::Image< uint8_t, 1, Allocator >& imageIn,
+        core::Image< PixelType, 1,
+                     typename std::allocator_traits< Allocator >::
+                         template rebind_alloc< PixelType > >& labelImageOut,
+        int32_t numberThreads )
+    {
+        return createRegions( labelImageOut,
+                              labelBlobsParallel< connectivity, Statistics >(
+                                  imageIn, labelImageOut, numberThreads ) );
+    }
+
+    /*
+     * Function that labels the image and returns the statistics of the final
+     * labels. The label image is reallocated if the size does not match.
+     */
+    template < Connectivity connectivity, typename BlobType >
+    static std::vector< BlobType > labelBlobs(
+        const core::Image< uint8_t, 1, Allocator >& imageIn,
+        core::Image< PixelType, 1,
+                     typename std::allocator_traits< Allocator >::
+                         template rebind_alloc< PixelType > >& labelImageOut )
+    {
+        using allocator_traits = std::allocator_traits< Allocator >;
+        using OutAllocator =
+            typename allocator_traits::template rebind_alloc< PixelType >;
+
+        // Check if the label image is already big enough. The first pass
+        // writes every pixel, so the buffer does not need to be initialized.
+        if ( imageIn.getSize( ) != labelImageOut.getSize( ) )
+        {
+            labelImageOut = core::Image< PixelType, 1, OutAllocator >(
+                imageIn.getSize( ), false );
+        }
+
+        EquivalenceTable equivalences;
+        std::vector< BlobType > provisionalBlobs;
+
+        labelProvisional< connectivity, BlobType >(
+            imageIn, labelImageOut, equivalences, provisionalBlobs );
+
+        auto blobs = resolveLabels( equivalences, provisionalBlobs );
+
+        relabel( labelImageOut, equivalences );
+
+        return blobs;
+    }
+
+    /*
+     * Function that labels the image in strips using multiple threads and
+     * returns the statistics of the final labels
+     */
+    template < Connectivity connectivity, typename BlobType >
+    static std::vector< BlobType > labelBlobsParallel(
+        const core::Image< uint8_t, 1, Allocator >& imageIn,
+        core::Image< PixelType, 1,
+                     typename std::allocator_traits< Allocator >::
+                         template rebind_alloc< PixelType > >& labelImageOut,
+        int32_t numberThreads )
     {
         using allocator_traits = std::allocator_traits< Allocator >;
         using OutAllocator =
@@ -299,124 +1005,159 @@ struct ConnectedComponentsDetector
 
         const auto width = imageIn.getWidth( );
         const auto height = imageIn.getHeight( );
+        const auto numberStrips =
+            std::min( core::getNumberThreads( numberThreads ), height );
 
-        // Use same allocator for vectors as well
-        std::vector< std::shared_ptr< Blob > > objects;
-        std::vector< PixelType > activeLabels;
-
-        PixelType labelNumber = 0;
-        std::vector< PixelType > neighbourhood( 4 );
+        if ( numberStrips <= 1 || width == 0 )
+        {
+            return labelBlobs< connectivity, BlobType >( imageIn,
+                                                         labelImageOut );
+        }
 
-        // Check if the label image is already big enough
         if ( imageIn.getSize( ) != labelImageOut.getSize( ) )
         {
             labelImageOut = core::Image< PixelType, 1, OutAllocator >(
-                width, height, true );
+                imageIn.getSize( ), false );
         }
 
-        for ( int32_t y = 0; y < height; y++ )
+        struct Strip
         {
-            const auto rowPtrSrc = imageIn.getRowPointer( y );
-            const auto rowPtrLbl = labelImageOut.getRowPointer( y );
+            core::Rectangle< int32_t > roi;
+            EquivalenceTable equivalences;
+            std::vector< BlobType > blobs;
+            int32_t offset { };
+        };
 
-            for ( int32_t x = 0; x < width; x++ )
-            {
-                // NOTE: For connected component labeling we do not expect all
-                // pixels to be a foreground pixel. Casting the row pointer to a
-                // 64 bit pointer and checking for 0 can improve performance for
-                // images with less information.
+        std::vector< Strip > strips( static_cast< size_t >( numberStrips ) );
 
-                // Check 8 pixels at the same time
-                if ( x + 7 < width &&
-                     ! *reinterpret_cast< const uint64_t* >( rowPtrSrc + x ) )
-                {
-                    x += 7;
-                    continue;
-                }
+        for ( int32_t i = 0; i < numberStrips; i++ )
+        {
+            const auto top = static_cast< int32_t >(
+                static_cast< int64_t >( height ) * i / numberStrips );
+            const auto bottom = static_cast< int32_t >(
+                static_cast< int64_t >( height ) * ( i + 1 ) / numberStrips );
 
-                if ( rowPtrSrc[ x ] != 0 )
-                {
-                    PixelType currentLabelNumber { };
-                    checkNeighbourhood( x, y, labelImageOut, neighbourhood );
+            strips[ static_cast< size_t >( i ) ].roi = core::Rectangle(
+                core::Point2i( 0, top ), core::SizeI( width, bottom - top ) );
+        }
 
-                    const auto minLabel =
-                        smallestNeighbour( neighbourhood, activeLabels );
+        // First pass. Every strip is labeled independently with local
+        // provisional labels.
+        core::parallelFor(
+            0,
+            numberStrips,
+            [ & ]( int32_t i )
+            {
+                auto& strip = strips[ static_cast< size_t >( i ) ];
 
-                    if ( minLabel == 0 )
-                    {
-                        currentLabelNumber = ++labelNumber;
-                        rowPtrLbl[ x ] = currentLabelNumber;
-                        createElement(
-                            x, y, objects, activeLabels, currentLabelNumber );
-                    }
-                    else
-                    {
-                        currentLabelNumber = minLabel;
-                        rowPtrLbl[ x ] = currentLabelNumber;
-                        addElement( x, y, minLabel, objects );
+                labelProvisional< connectivity, BlobType >(
+                    imageIn( strip.roi ),
+                    labelImageOut( strip.roi ),
+                    strip.equivalences,
+                    strip.blobs );
+            },
+            numberThreads );
 
-                        mergeElement(
-                            neighbourhood, minLabel, objects, activeLabels );
-                    }
-                }
-            }
-        }
+        // The local labels are concatenated in strip order. This keeps the
+        // creation order of the sequential labeling, so the final labels are
+        // identical.
+        EquivalenceTable equivalences;
+        std::vector< BlobType > provisionalBlobs;
 
-        // Reassign label numbers in label image
-        for ( int32_t y = 0; y < height; y++ )
+        for ( auto& strip : strips )
         {
-            const auto rowPtrSrc = imageIn.getRowPointer( y );
-            const auto rowPtrLbl = labelImageOut.getRowPointer( y );
+            strip.offset = equivalences.size( );
 
-            for ( int32_t x = 0; x < width; x++ )
+            for ( int32_t label = 1; label <= strip.equivalences.size( );
+                  label++ )
             {
-                // NOTE: For connected component labeling we do not expect all
-                // pixels to be a foreground pixel. Casting the row pointer to a
-                // 64 bit pointer and checking for 0 can improve performance for
-                // images with less information.
+                const auto globalLabel = equivalences.newLabel( );
+                const auto root = strip.equivalences.find( label );
 
-                // Check 8 pixels at the same time
-                if ( x + 7 < width &&
-                     ! *reinterpret_cast< const uint64_t* >( rowPtrSrc + x ) )
+                if ( root != label )
                 {
-                    x += 7;
-                    continue;
+                    equivalences.unite( strip.offset + root, globalLabel );
                 }
+            }
 
-                if ( rowPtrSrc[ x ] != 0 )
-                {
-                    rowPtrLbl[ x ] = activeLabels[ static_cast< size_t >(
-                        rowPtrLbl[ x ] - 1 ) ];
-                }
+            for ( auto blob : strip.blobs )
+            {
+                blob.shift( 0, strip.roi.getTop( ) );
+                blob.label += strip.offset;
+
+                provisionalBlobs.push_back( blob );
             }
         }
 
-        std::vector< std::unique_ptr<
-            core::Region< PixelType, OutAllocator, RegionFeature... > > >
-            regionsOut;
-
-        // Create objects
-        for ( size_t i = 0; i < activeLabels.size( ); i++ )
+        for ( size_t i = 1; i < strips.size( ); i++ )
         {
-            if ( activeLabels[ i ] != static_cast< int32_t >( i ) + 1 )
-                continue;
+            const auto& upper = strips[ i - 1 ];
+            const auto& lower = strips[ i ];
+
+            mergeStripBorder< connectivity >(
+                labelImageOut.getRowPointer( lower.roi.getTop( ) - 1 ),
+                upper.offset,
+                labelImageOut.getRowPointer( lower.roi.getTop( ) ),
+                lower.offset,
+                width,
+                equivalences );
+        }
+
+        auto blobs = resolveLabels( equivalences, provisionalBlobs );
+
+        constexpr auto maxLabel =
+            static_cast< size_t >( std::numeric_limits< PixelType >::max( ) );
+
+        EXPECT_MSG( blobs.size( ) <= maxLabel,
+                    "Number of labels exceeds the range of the label image "
+                    "pixel type ("
+                        << maxLabel << ")" );
+
+        // Second pass. Every strip maps its local labels to the final labels.
+        core::parallelFor(
+            0,
+            numberStrips,
+            [ & ]( int32_t i )
+            {
+                const auto& strip = strips[ static_cast< size_t >( i ) ];
 
-            // TODO: Maybe store Blob Object in region as reference for the
-            // bounding rect. Otherwise, some basic features needs to be
-            // calculated twice.
+                relabel( labelImageOut( strip.roi ),
+                         createLookupTable< PixelType >(
+                             equivalences,
+                             strip.offset,
+                             strip.equivalences.size( ) ) );
+            },
+            numberThreads );
 
-            if constexpr ( hasGetArea< core::Region< PixelType,
-                                                     OutAllocator,
-                                                     RegionFeature... > > )
+        return blobs;
+    }
+
+private:
+    static std::vector< std::unique_ptr< RegionType > >
+    createRegions(
+        const core::Image< PixelType, 1,
+                           typename std::allocator_traits< Allocator >::
+                               template rebind_alloc< PixelType > >&
+            labelImage,
+        const std::vector< Statistics >& blobs )
+    {
+        std::vector< std::unique_ptr< RegionType > > regionsOut;
+
+        regionsOut.reserve( blobs.size( ) );
+
+        // Create objects. The features that can be set from the blob
+        // statistics do not need to scan the label image again.
+        for ( const auto& blob : blobs )
+        {
+            auto region =
+                std::make_unique< RegionType >( labelImage, blob.label );
+
+            if constexpr ( hasBlobFeature )
             {
-                int test = 1;
-                std::ignore = test;
+                setBlobFeatures( *region, blob );
             }
 
-            regionsOut.push_back(
-                std::make_unique<
-                    core::Region< PixelType, OutAllocator, RegionFeature... > >(
-                    labelImageOut, activeLabels[ i ] ) );
+            regionsOut.push_back( std::move( region ) );
         }
 
         return regionsOut;
@@ -435,6 +1176,14 @@ struct ConnectedComponentsDetector
  * pre-allocated with the same size as the input image, the function do not
  * allocate image buffer.
  *
+ * The labeling uses two passes over the image and a flat union-find table for
+ * the label equivalences. The final labels are consecutive, starting at 1, and
+ * ordered by the first pixel of each region in raster scan order. The number
+ * of provisional labels must fit into the PixelType of the label image.
+ *
+ * The regions are 8 connected. The image is scanned in blocks of 2x2 pixels,
+ * which share one provisional label.
+ *
  * @return Returns the resulting output regions
  */
 template < typename PixelType, typename Allocator,
@@ -456,4 +1205,292 @@ connectedComponents(
         RegionFeature... >::connection( imageIn, labelImageOut );
 }
 
+/**
+ * Function that performs connected component labeling on binary images with
+ * the given connectivity
+ *
+ * @param [in]   imageIn        The input image
+ * @param [in]   labelImageOut  The labeled output image
+ *
+ * E.g.:
+ *
+ * connectedComponents< Connectivity::Four, uint16_t >( image, labelImage );
+ *
+ * The 4 connected neighbourhood is scanned pixel by pixel, the 8 connected
+ * neighbourhood in blocks of 2x2 pixels. The labels are identical to the
+ * overload without connectivity otherwise.
+ *
+ * @return Returns the resulting output regions
+ */
+template < Connectivity connectivity, typename PixelType, typename Allocator,
+           template < typename > typename... RegionFeature >
+std::vector<
+    std::unique_ptr< core::Region< PixelType,
+                                   typename std::allocator_traits< Allocator >::
+                                       template rebind_alloc< PixelType >,
+                                   RegionFeature... > > >
+connectedComponents(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    core::Image< PixelType, 1,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelType > >& labelImageOut )
+{
+    return detail::ConnectedComponentsDetector< PixelType,
+                                                Allocator,
+                                                RegionFeature... >::
+        template connection< connectivity >( imageIn, labelImageOut );
+}
+
+/**
+ * Function that calculates the statistics of the connected components of a
+ * binary image
+ *
+ * @param [in]   imageIn        The input image
+ *
+ * No label image is allocated. The image is labeled in a single pass using a
+ * buffer of two label rows. The blobs are ordered like the regions of the
+ * label image based overload, the label of a blob is its label number there.
+ *
+ * The connectivity template parameter selects the neighbourhood, the default
+ * is 8 connected.
+ *
+ * @return Returns the statistics of the connected components
+ */
+template < Connectivity connectivity = Connectivity::Eight,
+           typename Allocator >
+std::vector< Blob >
+connectedComponents( const core::Image< uint8_t, 1, Allocator >& imageIn )
+{
+    detail::EquivalenceTable equivalences;
+    std::vector< Blob > provisionalBlobs;
+
+    detail::labelStatistics< connectivity >(
+        imageIn, equivalences, provisionalBlobs );
+
+    return detail::resolveLabels( equivalences, provisionalBlobs );
+}
+
+/**
+ * Function that performs connected component labeling on binary images using
+ * multiple threads
+ *
+ * @param [in]   imageIn        The input image
+ * @param [in]   labelImageOut  The labeled output image
+ * @param [in]   numberThreads  The number of threads. 0 selects the number of
+ *                              hardware threads.
+ *
+ * The image is split into one horizontal strip per thread. The strips are
+ * labeled concurrently, the equivalences across the strip borders are merged
+ * and the strips are relabeled concurrently. The label image and the regions
+ * are identical to the sequential connectedComponents. The number of
+ * provisional labels of each strip must fit into the PixelType of the label
+ * image.
+ *
+ * @return Returns the resulting output regions
+ */
+template < typename PixelType, typename Allocator,
+           template < typename > typename... RegionFeature >
+std::vector<
+    std::unique_ptr< core::Region< PixelType,
+                                   typename std::allocator_traits< Allocator >::
+                                       template rebind_alloc< PixelType >,
+                                   RegionFeature... > > >
+connectedComponentsParallel(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    core::Image< PixelType, 1,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelType > >& labelImageOut,
+    int32_t numberThreads = 0 )
+{
+    return detail::ConnectedComponentsDetector<
+        PixelType,
+        Allocator,
+        RegionFeature... >::connectionParallel( imageIn,
+                                                labelImageOut,
+                                                numberThreads );
+}
+
+/**
+ * Function that performs connected component labeling on binary images with
+ * the given connectivity using multiple threads
+ *
+ * @param [in]   imageIn        The input image
+ * @param [in]   labelImageOut  The labeled output image
+ * @param [in]   numberThreads  The number of threads. 0 selects the number of
+ *                              hardware threads.
+ *
+ * @return Returns the resulting output regions
+ */
+template < Connectivity connectivity, typename PixelType, typename Allocator,
+           template < typename > typename... RegionFeature >
+std::vector<
+    std::unique_ptr< core::Region< PixelType,
+                                   typename std::allocator_traits< Allocator >::
+                                       template rebind_alloc< PixelType >,
+                                   RegionFeature... > > >
+connectedComponentsParallel(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    core::Image< PixelType, 1,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelType > >& labelImageOut,
+    int32_t numberThreads = 0 )
+{
+    return detail::ConnectedComponentsDetector< PixelType,
+                                                Allocator,
+                                                RegionFeature... >::
+        template connectionParallel< connectivity >(
+            imageIn, labelImageOut, numberThreads );
+}
+
+namespace detail
+{
+/*
+ * Function that returns the label image of a region set for relabeling.
+ * Relabeling in place would change the regions created by toRegions and the
+ * copies of the label image, so a shared label image is not reused.
+ */
+template < typename PixelType, typename Allocator >
+core::Image< PixelType, 1, Allocator >
+getReusableLabelImage( const RegionSet< PixelType, Allocator >& regions )
+{
+    if ( regions.getLabelImage( ).isShared( ) )
+    {
+        return { };
+    }
+
+    return regions.getLabelImage( );
+}
+} // namespace detail
+
+/**
+ * Function that performs connected component labeling on binary images into a
+ * flat region set
+ *
+ * @param [in]   imageIn        The input image
+ * @param [out]  regionsOut     The labeled output regions
+ *
+ * The labels are identical to the label image based overload. The statistics
+ * of all regions are stored column wise in the set, so no object is allocated
+ * per region. The label image of the set is reused as buffer if it has the
+ * size of the input image and is not referenced elsewhere, e.g. by regions
+ * created with toRegions. Views of the previous content of the set are
+ * invalidated.
+ *
+ * E.g.:
+ *
+ * RegionSet< uint16_t > regions;
+ * connectedComponents( image, regions );
+ *
+ * The connectivity template parameter selects the neighbourhood, the default
+ * is 8 connected.
+ */
+template < Connectivity connectivity = Connectivity::Eight,
+           typename PixelType, typename Allocator >
+void connectedComponents(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    RegionSet< PixelType,
+               typename std::allocator_traits<
+                   Allocator >::template rebind_alloc< PixelType > >&
+        regionsOut )
+{
+    auto labelImage = detail::getReusableLabelImage( regionsOut );
+
+    const auto blobs = detail::ConnectedComponentsDetector< PixelType,
+                                                            Allocator >::
+        template labelBlobs< connectivity, Blob >( imageIn, labelImage );
+
+    regionsOut.assign( std::move( labelImage ), blobs );
+}
+
+/**
+ * Function that performs connected component labeling on binary images into a
+ * flat region set using multiple threads
+ *
+ * @param [in]   imageIn        The input image
+ * @param [out]  regionsOut     The labeled output regions
+ * @param [in]   numberThreads  The number of threads. 0 selects the number of
+ *                              hardware threads.
+ *
+ * The region set is identical to the sequential connectedComponents.
+ */
+template < Connectivity connectivity = Connectivity::Eight,
+           typename PixelType, typename Allocator >
+void connectedComponentsParallel(
+    const core::Image< uint8_t, 1, Allocator >& imageIn,
+    RegionSet< PixelType,
+               typename std::allocator_traits<
+                   Allocator >::template rebind_alloc< PixelType > >&
+        regionsOut,
+    int32_t numberThreads = 0 )
+{
+    auto labelImage = detail::getReusableLabelImage( regionsOut );
+
+    const auto blobs = detail::ConnectedComponentsDetector< PixelType,
+                                                            Allocator >::
+        template labelBlobsParallel< connectivity, Blob >(
+            imageIn, labelImage, numberThreads );
+
+    regionsOut.assign( std::move( labelImage ), blobs );
+}
+
+/**
+ * Function that performs connected component labeling on run length encoded
+ * regions
+ *
+ * @param [in]   regionIn       The input region
+ * @param [out]  regionsOut     The connected components of the input region
+ *
+ * The labeling works on the runs only, so the runtime is proportional to the
+ * number of runs instead of the number of pixels. The output regions are
+ * ordered like the label numbers of the label image based overload.
+ *
+ * The connectivity template parameter selects the neighbourhood, the default
+ * is 8 connected.
+ */
+template < Connectivity connectivity = Connectivity::Eight >
+void connectedComponents( const core::RegionRLE& regionIn,
+                          std::vector< core::RegionRLE >& regionsOut )
+{
+    const auto& runs = regionIn.getRuns( );
+
+    detail::EquivalenceTable equivalences;
+    std::vector< int32_t > runLabels;
+
+    detail::labelRuns< connectivity >( runs, equivalences, runLabels );
+
+    const auto numberLabels = equivalences.flatten( );
+
+    regionsOut.assign( static_cast< size_t >( numberLabels ),
+                       core::RegionRLE( regionIn.getImageSize( ) ) );
+
+    for ( size_t i = 0; i < runs.size( ); i++ )
+    {
+        const auto& run = runs[ i ];
+        const auto label = equivalences.getFinalLabel( runLabels[ i ] );
+
+        regionsOut[ static_cast< size_t >( label - 1 ) ].addRun(
+            run.row, run.colStart, run.colEnd );
+    }
+}
+
+/**
+ * Function that performs connected component labeling on binary images
+ *
+ * @param [in]   imageIn        The input image
+ * @param [out]  regionsOut     The run length encoded output regions
+ *
+ * All non-zero pixels are foreground. No label image is allocated.
+ */
+template < Connectivity connectivity = Connectivity::Eight,
+           typename Allocator >
+void connectedComponents( const core::Image< uint8_t, 1, Allocator >& imageIn,
+                          std::vector< core::RegionRLE >& regionsOut )
+{
+    core::RegionRLE foreground;
+
+    threshold( imageIn, foreground, uint8_t { 0 } );
+
+    connectedComponents< connectivity >( foreground, regionsOut );
+}
+
 } // namespace cvl::processing
\ No newline at end of file
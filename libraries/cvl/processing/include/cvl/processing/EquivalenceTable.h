@@ -0,0 +1,209 @@
+#pragma once
+
+// STD includes
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cvl::processing::detail
+{
+
+/**
+ * @brief Flat union-find table for provisional label equivalences
+ *
+ * Labels are 1-based, 0 is reserved for the background. Two sets are always
+ * united under the smaller label, so the parent of a label is never greater
+ * than the label itself. This allows resolving the table in one linear pass
+ * (flatten) that assigns consecutive final labels in the order the sets have
+ * been created.
+ */
+class EquivalenceTable
+{
+public:
+    /**
+     * Default constructor
+     */
+    EquivalenceTable( );
+
+    /**
+     * Function that reserves memory for the expected number of labels.
+     *
+     * @param [in]  numberLabels    The expected number of labels.
+     */
+    void reserve( size_t numberLabels );
+
+    /**
+     * Function that removes all labels from the table.
+     */
+    void clear( );
+
+    /**
+     * Function that creates a new provisional label.
+     *
+     * @return The new label.
+     */
+    int32_t newLabel( );
+
+    /**
+     * Function that returns the root label of the set a label belongs to.
+     * Path halving is applied while searching.
+     *
+     * @param [in]  label   The label to look up.
+     *
+     * @return The smallest label of the set.
+     */
+    int32_t find( int32_t label );
+
+    /**
+     * Function that merges the sets of two labels.
+     *
+     * @param [in]  lhs     The first label.
+     * @param [in]  rhs     The second label.
+     *
+     * @return The root label of the merged set.
+     */
+    int32_t unite( int32_t lhs, int32_t rhs );
+
+    /**
+     * Function that resolves all equivalences. Afterwards, every provisional
+     * label maps to a consecutive final label starting at 1. No further labels
+     * can be created or united until the table is cleared.
+     *
+     * @return The number of final labels.
+     */
+    int32_t flatten( );
+
+    /**
+     * Accessor for the final label of a provisional label. Only valid after
+     * flatten has been called.
+     *
+     * @param [in]  label   The provisional label.
+     *
+     * @return The final label.
+     */
+    [[nodiscard]] int32_t getFinalLabel( int32_t label ) const;
+
+    /**
+     * Function that renumbers the final labels. Only valid after flatten has
+     * been called.
+     *
+     * @param [in]  finalLabels     The new final label for each final label,
+     *                              indexed by the current final label.
+     */
+    void renumber( const std::vector< int32_t >& finalLabels );
+
+    /**
+     * Accessor for the number of provisional labels.
+     *
+     * @return The number of provisional labels.
+     */
+    [[nodiscard]] int32_t size( ) const;
+
+private:
+    std::vector< int32_t > mParent;
+};
+
+//
+// Implementation
+//
+
+inline EquivalenceTable::EquivalenceTable( )
+    : mParent( 1, 0 )
+{
+}
+
+inline void EquivalenceTable::reserve( size_t numberLabels )
+{
+    mParent.reserve( numberLabels + 1 );
+}
+
+inline void EquivalenceTable::clear( )
+{
+    mParent.resize( 1 );
+}
+
+inline int32_t EquivalenceTable::newLabel( )
+{
+    const auto label = static_cast< int32_t >( mParent.size( ) );
+    mParent.push_back( label );
+
+    return label;
+}
+
+inline int32_t EquivalenceTable::find( int32_t label )
+{
+    auto* parent = mParent.data( );
+
+    while ( parent[ label ] != label )
+    {
+        parent[ label ] = parent[ parent[ label ] ];
+        label = parent[ label ];
+    }
+
+    return label;
+}
+
+inline int32_t EquivalenceTable::unite( int32_t lhs, int32_t rhs )
+{
+    auto lhsRoot = find( lhs );
+    auto rhsRoot = find( rhs );
+
+    if ( lhsRoot == rhsRoot )
+    {
+        return lhsRoot;
+    }
+
+    if ( rhsRoot < lhsRoot )
+    {
+        std::swap( lhsRoot, rhsRoot );
+    }
+
+    mParent[ static_cast< size_t >( rhsRoot ) ] = lhsRoot;
+
+    return lhsRoot;
+}
+
+inline int32_t EquivalenceTable::flatten( )
+{
+    int32_t numberLabels { };
+
+    // The parent of a label is always smaller than the label. Walking in
+    // increasing order guarantees that the parent is already resolved.
+    for ( size_t i = 1; i < mParent.size( ); i++ )
+    {
+        const auto parent = static_cast< size_t >( mParent[ i ] );
+
+        if ( parent < i )
+        {
+            mParent[ i ] = mParent[ parent ];
+        }
+        else
+        {
+            mParent[ i ] = ++numberLabels;
+        }
+    }
+
+    return numberLabels;
+}
+
+inline int32_t EquivalenceTable::getFinalLabel( int32_t label ) const
+{
+    return mParent[ static_cast< size_t >( label ) ];
+}
+
+inline void
+EquivalenceTable::renumber( const std::vector< int32_t >& finalLabels )
+{
+    for ( size_t i = 1; i < mParent.size( ); i++ )
+    {
+        mParent[ i ] = finalLabels[ static_cast< size_t >( mParent[ i ] ) ];
+    }
+}
+
+inline int32_t EquivalenceTable::size( ) const
+{
+    return static_cast< int32_t >( mParent.size( ) ) - 1;
+}
+
+} // namespace cvl::processing::detail
@@ -2,6 +2,9 @@
 
 // CVL includes
 #include <cvl/core/Image.h>
+#include <cvl/core/Parallel.h>
+#include <cvl/core/ScratchArena.h>
+#include <cvl/core/TiledImage.h>
 #include <cvl/core/Types.h>
 #include <cvl/core/macros.h>
 #include <cvl/processing/ColumnFilter.h>
@@ -9,18 +12,35 @@
 #include <cvl/processing/FilterOperation.h>
 #include <cvl/processing/RowFilter.h>
 
+// STD includes
+#include <array>
+#include <span>
+#include <vector>
+
 namespace cvl::processing
 {
 
+/**
+ * Applies a one dimensional filter to an image.
+ *
+ * @param [in]   imageIn    The input image
+ * @param [out]  imageOut   The output image. The image is reallocated if the
+ *                          size does not match.
+ * @param [in]   kernel     The filter kernel. A kernel with a size known at
+ *                          compile time is applied with unrolled loops.
+ */
 template < core::FilterDirection Direction, Arithmetic PixelTypeIn,
            int32_t Channels, typename Allocator, Arithmetic PixelTypeOut,
-           Arithmetic KernelType >
+           Arithmetic KernelType, size_t Extent, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
 void filter1D(
-    const core::Image< PixelTypeIn, Channels, Allocator >& imageIn,
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
     core::Image< PixelTypeOut, Channels,
                  typename std::allocator_traits< Allocator >::
-                     template rebind_alloc< PixelTypeOut > >& imageOut,
-    const std::vector< KernelType >& kernel )
+                     template rebind_alloc< PixelTypeOut >,
+                 Layout, Alignment >& imageOut,
+    std::span< const KernelType, Extent > kernel )
 {
     EXPECT_MSG( ! kernel.empty( ),
                 "Kernel size(" << kernel.size( ) << "). Kernel cannot be 0" );
@@ -35,7 +55,147 @@ void filter1D(
                      Allocator,
                      PixelTypeOut,
                      KernelType,
-                     Direction >::applyFilter( imageIn, imageOut, kernel );
+                     Direction,
+                     Layout,
+                     Alignment >::applyFilter( imageIn, imageOut, kernel );
+}
+
+template < core::FilterDirection Direction, Arithmetic PixelTypeIn,
+           int32_t Channels, typename Allocator, Arithmetic PixelTypeOut,
+           Arithmetic KernelType, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
+void filter1D(
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelTypeOut, Channels,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelTypeOut >,
+                 Layout, Alignment >& imageOut,
+    const std::vector< KernelType >& kernel )
+{
+    filter1D< Direction >(
+        imageIn, imageOut, std::span< const KernelType >( kernel ) );
+}
+
+template < core::FilterDirection Direction, Arithmetic PixelTypeIn,
+           int32_t Channels, typename Allocator, Arithmetic PixelTypeOut,
+           Arithmetic KernelType, size_t Size, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
+void filter1D(
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelTypeOut, Channels,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelTypeOut >,
+                 Layout, Alignment >& imageOut,
+    const std::array< KernelType, Size >& kernel )
+{
+    static_assert( Size % 2 != 0, "Only odd kernel size is allowed" );
+
+    filter1D< Direction >(
+        imageIn, imageOut, std::span< const KernelType, Size >( kernel ) );
+}
+
+/**
+ * Applies a one dimensional filter to a tiled image tile by tile. The tiles
+ * are processed in parallel.
+ *
+ * @param [in]   imageIn    The tiled input image
+ * @param [out]  imageOut   The tiled output image. The image is reallocated
+ *                          if the size does not match.
+ * @param [in]   kernel     The filter kernel
+ *
+ * Each tile is copied with the border the kernel needs from the adjacent
+ * tiles into a small linear image and filtered there. The result is
+ * identical to filtering the linear image.
+ */
+template < core::FilterDirection Direction, Arithmetic PixelType,
+           int32_t Channels, typename Allocator, core::ChannelLayout Layout,
+           int32_t TileSize, Arithmetic KernelType >
+void filter1D(
+    const core::TiledImage< PixelType, Channels, Allocator, Layout, TileSize >&
+        imageIn,
+    core::TiledImage< PixelType, Channels, Allocator, Layout, TileSize >&
+        imageOut,
+    const std::vector< KernelType >& kernel )
+{
+    using TiledImageType =
+        core::TiledImage< PixelType, Channels, Allocator, Layout, TileSize >;
+    using ImageType = typename TiledImageType::image_type;
+
+    EXPECT_MSG( ! kernel.empty( ),
+                "Kernel size(" << kernel.size( ) << "). Kernel cannot be 0" );
+
+    EXPECT_MSG( kernel.size( ) % 2 != 0,
+                "Invalid kernel size("
+                    << kernel.size( )
+                    << ")  Only odd kernel size is allowed for boxBlur" );
+
+    EXPECT_MSG( &imageIn != &imageOut,
+                "Input image cannot be the output image" );
+
+    if ( imageOut.getSize( ) != imageIn.getSize( ) )
+    {
+        imageOut = TiledImageType(
+            imageIn.getSize( ), false, imageIn.getAllocator( ) );
+    }
+
+    const auto anchor = static_cast< int32_t >( kernel.size( ) / 2 );
+    const auto width = imageIn.getWidth( );
+    const auto height = imageIn.getHeight( );
+
+    core::parallelFor(
+        0,
+        imageIn.getNumberTiles( ),
+        [ & ]( int32_t index )
+        {
+            const auto rect =
+                imageIn.getTileRect( index % imageIn.getNumberTilesX( ),
+                                     index / imageIn.getNumberTilesX( ) );
+
+            // The tile and the border in filter direction, cut at the image
+            auto left = rect.getLeft( );
+            auto top = rect.getTop( );
+            auto right = rect.getRight( );
+            auto bottom = rect.getBottom( );
+
+            if constexpr ( Direction == core::FilterDirection::Row )
+            {
+                left = std::max( left - anchor, 0 );
+                right = std::min( right + anchor, width );
+            }
+            else
+            {
+                top = std::max( top - anchor, 0 );
+                bottom = std::min( bottom + anchor, height );
+            }
+
+            const core::Rectangle< int32_t > region(
+                core::Point2i( left, top ),
+                core::SizeI( right - left, bottom - top ) );
+
+            // The regions live on the arena of the worker thread. The workers
+            // of parallelFor are persistent, so their arenas keep the blocks
+            // and repeated calls do not allocate.
+            auto& arena = core::ScratchArena::getThreadArena( );
+            core::ScratchArena::Scope scope( arena );
+
+            auto imageRegion =
+                arena.createImage< ImageType >( region.getSize( ) );
+            imageIn.readRegion( region, imageRegion );
+
+            auto imageRegionOut =
+                arena.createImage< ImageType >( region.getSize( ) );
+            filter1D< Direction >( imageRegion, imageRegionOut, kernel );
+
+            imageOut.writeRegion(
+                imageRegionOut,
+                core::Rectangle< int32_t >(
+                    core::Point2i( rect.getLeft( ) - left,
+                                   rect.getTop( ) - top ),
+                    rect.getSize( ) ),
+                rect.getTopLeft( ) );
+        } );
 }
 
-} // namespace cvl::processing
\ No newline at end of file
+} // namespace cvl::processing
@@ -2,22 +2,116 @@
 
 // CVL includes
 #include <cvl/core/Image.h>
+#include <cvl/core/ScratchArena.h>
 #include <cvl/core/macros.h>
 #include <cvl/processing/Filter1D.h>
 #include <cvl/processing/FilterCoefficients.h>
+#include <cvl/processing/FilterKernels.h>
+
+// STD includes
+#include <array>
+#include <span>
+#include <vector>
 
 namespace cvl::processing
 {
 
+namespace detail
+{
+/**
+ * Function that applies a separable filter to an 8 bit image in one pass.
+ * Each output row is filtered vertically into a line buffer and the line is
+ * filtered horizontally into the output row, no intermediate image is
+ * written. The mirrored border is stored around the line, so the horizontal
+ * filter runs over the whole row.
+ *
+ * The result is identical to the column filter followed by the row filter.
+ * The image must be larger than the anchors of the kernels.
+ *
+ * @param [in]   imageIn       The input image
+ * @param [out]  imageOut      The output image of the same size
+ * @param [in]   columnKernel  The kernel of the vertical pass
+ * @param [in]   rowKernel     The kernel of the horizontal pass
+ */
+template < typename ImageIn, typename ImageOut >
+void separableFilter2DFixedPoint( const ImageIn& imageIn, ImageOut& imageOut,
+                                  const FixedPointKernel& columnKernel,
+                                  const FixedPointKernel& rowKernel )
+{
+    constexpr auto step = ImageIn::pixel_step;
+
+    const auto width = imageIn.getWidth( );
+    const auto height = imageIn.getHeight( );
+    const auto anchorX = rowKernel.size / 2;
+    const auto anchorY = columnKernel.size / 2;
+    const auto level = core::getSimdLevel( );
+
+    const auto count = width * step;
+    const auto border = anchorX * step;
+
+    auto& arena = core::ScratchArena::getThreadArena( );
+    core::ScratchArena::Scope scope( arena );
+
+    auto* line = static_cast< uint8_t* >( arena.allocate(
+                     static_cast< size_t >( count + 2 * border ), 64 ) ) +
+                 border;
+
+    std::array< const uint8_t*, FixedPointKernel::max_size > rows;
+
+    for ( int32_t plane = 0; plane < ImageIn::number_planes; plane++ )
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t k = 0; k < columnKernel.size; k++ )
+            {
+                auto idx = std::abs( y + k - anchorY );
+                if ( idx > height - 1 )
+                {
+                    idx = 2 * ( height - 1 ) - idx;
+                }
+
+                rows[ static_cast< size_t >( k ) ] =
+                    imageIn.getRowPointer( idx, plane );
+            }
+
+            filterColumnFixedPoint(
+                rows.data( ), line, count, columnKernel, level );
+
+            // The border pixels are mirrored without repeating the edge
+            for ( int32_t x = 1; x <= anchorX; x++ )
+            {
+                for ( int32_t c = 0; c < step; c++ )
+                {
+                    line[ -x * step + c ] = line[ x * step + c ];
+                    line[ ( width - 1 + x ) * step + c ] =
+                        line[ ( width - 1 - x ) * step + c ];
+                }
+            }
+
+            filterRowFixedPoint( line,
+                                 imageOut.getRowPointer( y, plane ),
+                                 count,
+                                 step,
+                                 rowKernel,
+                                 level );
+        }
+    }
+}
+} // namespace detail
+
 template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
-           Arithmetic PixelTypeOut, Arithmetic KernelType >
+           Arithmetic PixelTypeOut, Arithmetic KernelType, size_t RowExtent,
+           size_t ColumnExtent, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
 void separableFilter2D(
-    const core::Image< PixelTypeIn, Channels, Allocator >& imageIn,
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
     core::Image< PixelTypeOut, Channels,
                  typename std::allocator_traits< Allocator >::
-                     template rebind_alloc< PixelTypeIn > >& imageOut,
-    const std::vector< KernelType >& rowKernel,
-    const std::vector< KernelType >& columnKernel )
+                     template rebind_alloc< PixelTypeIn >,
+                 Layout, Alignment >& imageOut,
+    std::span< const KernelType, RowExtent > rowKernel,
+    std::span< const KernelType, ColumnExtent > columnKernel )
 {
     using allocator_traits = std::allocator_traits< Allocator >;
     using OutAllocator =
@@ -33,12 +127,39 @@ void separableFilter2D(
 
     if ( imageOut.getSize( ) != imageIn.getSize( ) )
     {
-        imageOut = core::Image< PixelTypeOut, 1, OutAllocator >(
-            imageIn.getSize( ), true );
+        imageOut = core::Image< PixelTypeOut, Channels, OutAllocator, Layout,
+                                Alignment >( imageIn.getSize( ), true );
     }
 
-    auto imageIntermediate = core::Image< PixelTypeOut, 1, OutAllocator >(
-        imageIn.getSize( ), true );
+    // Integer kernels on 8 bit images are fused into one pass
+    if constexpr ( detail::hasFixedPointKernel< PixelTypeIn,
+                                                PixelTypeOut,
+                                                KernelType > )
+    {
+        detail::FixedPointKernel columnPassKernel;
+        detail::FixedPointKernel rowPassKernel;
+
+        if ( detail::makeFixedPointKernel( rowKernel, columnPassKernel ) &&
+             detail::makeFixedPointKernel( columnKernel, rowPassKernel ) &&
+             imageIn.getWidth( ) > rowPassKernel.size / 2 &&
+             imageIn.getHeight( ) > columnPassKernel.size / 2 )
+        {
+            detail::separableFilter2DFixedPoint(
+                imageIn, imageOut, columnPassKernel, rowPassKernel );
+
+            return;
+        }
+    }
+
+    // The intermediate image lives on the arena of the thread, the steady
+    // state of a loop does not allocate. Every pixel is written by the first
+    // pass.
+    auto& arena = core::ScratchArena::getThreadArena( );
+    core::ScratchArena::Scope scope( arena );
+
+    auto imageIntermediate = arena.createImage< core::Image<
+        PixelTypeOut, Channels, OutAllocator, Layout, Alignment > >(
+        imageIn.getSize( ) );
 
     // x
     // x vertical column filter
@@ -58,12 +179,58 @@ void separableFilter2D(
 }
 
 template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
-           Arithmetic PixelTypeOut, Arithmetic KernelType >
+           Arithmetic PixelTypeOut, Arithmetic KernelType,
+           core::ChannelLayout Layout, core::RowAlignmentPolicy Alignment >
+void separableFilter2D(
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelTypeOut, Channels,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelTypeIn >,
+                 Layout, Alignment >& imageOut,
+    const std::vector< KernelType >& rowKernel,
+    const std::vector< KernelType >& columnKernel )
+{
+    separableFilter2D( imageIn,
+                       imageOut,
+                       std::span< const KernelType >( rowKernel ),
+                       std::span< const KernelType >( columnKernel ) );
+}
+
+template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
+           Arithmetic PixelTypeOut, Arithmetic KernelType, size_t RowSize,
+           size_t ColumnSize, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
+void separableFilter2D(
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelTypeOut, Channels,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelTypeIn >,
+                 Layout, Alignment >& imageOut,
+    const std::array< KernelType, RowSize >& rowKernel,
+    const std::array< KernelType, ColumnSize >& columnKernel )
+{
+    static_assert( RowSize % 2 != 0 && ColumnSize % 2 != 0,
+                   "Only odd kernel size is allowed" );
+
+    separableFilter2D(
+        imageIn,
+        imageOut,
+        std::span< const KernelType, RowSize >( rowKernel ),
+        std::span< const KernelType, ColumnSize >( columnKernel ) );
+}
+
+template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
+           Arithmetic PixelTypeOut, Arithmetic KernelType,
+           core::ChannelLayout Layout, core::RowAlignmentPolicy Alignment >
 void filter2D(
-    const core::Image< PixelTypeIn, Channels, Allocator >& imageIn,
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
     core::Image< PixelTypeOut, Channels,
                  typename std::allocator_traits< Allocator >::
-                     template rebind_alloc< PixelTypeOut > >& imageOut,
+                     template rebind_alloc< PixelTypeOut >,
+                 Layout, Alignment >& imageOut,
     const std::vector< std::vector< KernelType > >& filterKernel )
 {
     using allocator_traits = std::allocator_traits< Allocator >;
@@ -84,23 +251,24 @@ void filter2D(
 
     if ( isSeparableFilter( filterKernel ) )
     {
-        std::vector< KernelType > rowKernel;
-        std::vector< KernelType > colKernel;
-
-        rowKernel.reserve( filterKernel.size( ) );
-        colKernel.reserve( filterKernel[ 0 ].size( ) );
+        // The first row is the column kernel, the row kernel is gathered
+        // from the first column on the arena of the thread
+        auto& arena = core::ScratchArena::getThreadArena( );
+        core::ScratchArena::Scope scope( arena );
 
-        for ( const auto& row : filterKernel )
-        {
-            rowKernel.emplace_back( row[ 0 ] );
-        }
+        const auto size = filterKernel.size( );
+        auto* rowKernel = static_cast< KernelType* >( arena.allocate(
+            size * sizeof( KernelType ), alignof( KernelType ) ) );
 
-        for ( const auto& col : filterKernel[ 0 ] )
+        for ( size_t y = 0; y < size; y++ )
         {
-            colKernel.emplace_back( col );
+            rowKernel[ y ] = filterKernel[ y ][ 0 ];
         }
 
-        separableFilter2D( imageIn, imageOut, rowKernel, colKernel );
+        separableFilter2D( imageIn,
+                           imageOut,
+                           std::span< const KernelType >( rowKernel, size ),
+                           std::span< const KernelType >( filterKernel[ 0 ] ) );
 
         return;
     }
@@ -111,8 +279,8 @@ void filter2D(
 
     if ( imageOut.getSize( ) != imageIn.getSize( ) )
     {
-        imageOut = core::Image< PixelTypeOut, 1, OutAllocator >(
-            imageIn.getSize( ), true );
+        imageOut = core::Image< PixelTypeOut, Channels, OutAllocator, Layout,
+                                Alignment >( imageIn.getSize( ), true );
     }
 
     using sumType = decltype( std::declval< PixelTypeIn >( ) +
@@ -229,4 +397,61 @@ void filter2D(
     }
 }
 
-} // namespace cvl::processing
\ No newline at end of file
+/**
+ * Applies a two dimensional filter with a size known at compile time.
+ * Separable kernels are applied as a row and a column kernel of that size,
+ * all others like the kernel with a size known at run time.
+ *
+ * @param [in]   imageIn        The input image
+ * @param [out]  imageOut       The output image. The image is reallocated if
+ *                              the size does not match.
+ * @param [in]   filterKernel   The filter kernel of Height rows of Width
+ *                              coefficients
+ */
+template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
+           Arithmetic PixelTypeOut, Arithmetic KernelType, size_t Width,
+           size_t Height, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
+void filter2D(
+    const core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelTypeOut, Channels,
+                 typename std::allocator_traits< Allocator >::
+                     template rebind_alloc< PixelTypeOut >,
+                 Layout, Alignment >& imageOut,
+    const std::array< std::array< KernelType, Width >, Height >& filterKernel )
+{
+    static_assert( Width % 2 != 0 && Height % 2 != 0,
+                   "Only odd kernel size is allowed" );
+
+    EXPECT_MSG( static_cast< void* >( imageIn.getData( ) ) !=
+                    static_cast< void* >( imageOut.getData( ) ),
+                "Input image cannot be the output image" );
+
+    if ( isSeparableFilter( filterKernel ) )
+    {
+        // The first row is the column kernel, the first column the row
+        // kernel, like in the version with a size known at run time
+        std::array< KernelType, Height > rowKernel;
+
+        for ( size_t y = 0; y < Height; y++ )
+        {
+            rowKernel[ y ] = filterKernel[ y ][ 0 ];
+        }
+
+        separableFilter2D( imageIn, imageOut, rowKernel, filterKernel[ 0 ] );
+
+        return;
+    }
+
+    std::vector< std::vector< KernelType > > kernel;
+
+    for ( const auto& row : filterKernel )
+    {
+        kernel.emplace_back( row.begin( ), row.end( ) );
+    }
+
+    filter2D( imageIn, imageOut, kernel );
+}
+
+} // namespace cvl::processing
@@ -6,7 +6,9 @@
 #include <cvl/processing/export.h>
 
 // STD includes
+#include <array>
 #include <cstdint>
+#include <type_traits>
 #include <vector>
 
 namespace cvl::processing
@@ -83,6 +85,98 @@ getBinomialKernel( const core::SizeI& kernelSize );
 CVL_PROCESSING_EXPORT std::vector< std::vector< int32_t > >
 getBoxKernel( const core::SizeI& kernelSize );
 
+/*
+ * Function that calculates the 1-dimensional binomial filter kernel of a size
+ * known at compile time, e.g. 1 4 6 4 1 for a size of 5
+ *
+ * @return The 1-dimensional filter kernel
+ */
+template < size_t Size >
+constexpr std::array< int32_t, Size > getBinomialKernel1D( )
+{
+    static_assert( Size % 2 != 0, "Only odd kernel size is allowed" );
+
+    // The rows of Pascal's triangle, each row is computed in place
+    std::array< int32_t, Size > kernel { };
+    kernel[ 0 ] = 1;
+
+    for ( size_t n = 1; n < Size; n++ )
+    {
+        for ( size_t k = n; k > 0; k-- )
+        {
+            kernel[ k ] += kernel[ k - 1 ];
+        }
+    }
+
+    return kernel;
+}
+
+/*
+ * Function that calculates the 1-dimensional box filter kernel of a size known
+ * at compile time
+ *
+ * @return The 1-dimensional filter kernel
+ */
+template < size_t Size >
+constexpr std::array< int32_t, Size > getBoxKernel1D( )
+{
+    static_assert( Size % 2 != 0, "Only odd kernel size is allowed" );
+
+    std::array< int32_t, Size > kernel { };
+    kernel.fill( 1 );
+
+    return kernel;
+}
+
+/*
+ * Function that calculates the binomial filter kernel of a size known at
+ * compile time
+ *
+ * @return The 2-dimensional filter kernel of Height rows of Width
+ *         coefficients
+ */
+template < size_t Width, size_t Height >
+constexpr std::array< std::array< int32_t, Width >, Height >
+getBinomialKernel( )
+{
+    constexpr auto kernelX = getBinomialKernel1D< Width >( );
+    constexpr auto kernelY = getBinomialKernel1D< Height >( );
+
+    std::array< std::array< int32_t, Width >, Height > kernel { };
+
+    for ( size_t y = 0; y < Height; y++ )
+    {
+        for ( size_t x = 0; x < Width; x++ )
+        {
+            kernel[ y ][ x ] = kernelX[ x ] * kernelY[ y ];
+        }
+    }
+
+    return kernel;
+}
+
+/*
+ * Function that calculates the box filter kernel of a size known at compile
+ * time
+ *
+ * @return The 2-dimensional filter kernel of Height rows of Width
+ *         coefficients
+ */
+template < size_t Width, size_t Height >
+constexpr std::array< std::array< int32_t, Width >, Height > getBoxKernel( )
+{
+    static_assert( Height % 2 != 0, "Only odd kernel size is allowed" );
+
+    std::array< std::array< int32_t, Width >, Height > kernel { };
+
+    for ( auto& row : kernel )
+    {
+        row = getBoxKernel1D< Width >( );
+    }
+
+    return kernel;
+}
+
 /*
  * Function that calculates the sobel filter kernel defined by a given size
  *
@@ -133,6 +227,18 @@ getFirstDerivativeKernel( int32_t kernelSize );
 template < typename T >
 bool isSeparableFilter( const std::vector< std::vector< T > >& kernel );
 
+/*
+ * Function that check if a 2D filter kernel of a size known at compile time
+ * is separable.
+ *
+ * @param [in]  kernel  The 2D input kernel to check
+ *
+ * @return Returns true if separable, else false
+ */
+template < typename T, size_t Width, size_t Height >
+constexpr bool
+isSeparableFilter( const std::array< std::array< T, Width >, Height >& kernel );
+
 // Template implementations
 template < typename T >
 bool isSeparableFilter( const std::vector< std::vector< T > >& kernel )
@@ -175,4 +281,33 @@ bool isSeparableFilter( const std::vector< std::vector< T > >& kernel )
     return separable;
 }
 
-} // namespace cvl::processing
\ No newline at end of file
+template < typename T, size_t Width, size_t Height >
+constexpr bool
+isSeparableFilter( const std::array< std::array< T, Width >, Height >& kernel )
+{
+    for ( size_t ky = 0; ky < Height; ky++ )
+    {
+        for ( size_t kx = 0; kx < Width; kx++ )
+        {
+            const auto coefficient =
+                static_cast< T >( kernel[ 0 ][ kx ] * kernel[ ky ][ 0 ] );
+
+            // Integer kernels are compared in constant expressions
+            if constexpr ( std::is_integral_v< T > )
+            {
+                if ( coefficient != kernel[ ky ][ kx ] )
+                {
+                    return false;
+                }
+            }
+            else if ( ! core::isEqual( coefficient, kernel[ ky ][ kx ] ) )
+            {
+                return false;
+            }
+        }
+    }
+
+    return Width > 0 && Height > 0;
+}
+
+} // namespace cvl::processing
@@ -0,0 +1,374 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/CpuFeatures.h>
+#include <cvl/core/Types.h>
+#include <cvl/processing/export.h>
+
+// STD includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace cvl::processing::detail
+{
+
+/**
+ * @brief The FixedPointKernel struct
+ *
+ * An integer kernel of an 8 bit row or column filter. The division by the
+ * sum of the coefficients is a multiplication with a fixed-point reciprocal
+ * and a shift, which is exact for every sum the kernel can produce. The
+ * result is the truncated quotient, saturated to 0 and 255.
+ *
+ * Sums up to 65535 of non-negative kernels, e.g. box and binomial kernels,
+ * are accumulated in 16 bit, all others in 32 bit.
+ *
+ * The 8 bit kernels of this file run on the elements of a row, not on pixels.
+ * The channels of interleaved images are filtered in one run of width *
+ * pixel_step elements, the taps of a row filter are pixel_step elements
+ * apart.
+ */
+struct FixedPointKernel
+{
+    static constexpr int32_t max_size = 63;
+
+    std::array< int16_t, max_size > coefficients { };
+    int32_t size { };
+    int32_t divisor { 1 }; ///< The sum of the coefficients, 1 if 0
+
+    bool narrow { }; ///< Accumulate in 16 bit
+
+    // The quotient of the 32 bit path is ( sum * multiplier ) >> shift
+    uint32_t multiplier { };
+    int32_t shift { };
+
+    // The quotient of the 16 bit path is ( ( sum * multiplier16 ) >> 16 ) >>
+    // shift16. A multiplier of 0 skips the multiplication.
+    uint16_t multiplier16 { };
+    int32_t shift16 { };
+};
+
+/**
+ * @brief The FixedPointDivisor struct
+ *
+ * A divisor of non-negative dividends up to a maximum. The quotient is
+ * ( dividend * multiplier ) >> shift, which is the truncated quotient for
+ * every dividend up to the maximum.
+ */
+struct FixedPointDivisor
+{
+    int32_t divisor { 1 };
+    uint32_t multiplier { 1 };
+    int32_t shift { };
+};
+
+/**
+ * Function that computes the fixed-point reciprocal of a divisor.
+ *
+ * @param [in]   divisor      The divisor. Must be positive.
+ * @param [in]   maxDividend  The largest dividend
+ * @param [out]  fixedPoint   The fixed-point divisor
+ *
+ * @returns True if a reciprocal exists
+ */
+CVL_PROCESSING_EXPORT bool
+makeFixedPointDivisor( int32_t divisor, int32_t maxDividend,
+                       FixedPointDivisor& fixedPoint );
+
+/**
+ * Function that computes the fixed-point reciprocal of a kernel. The
+ * coefficients and the size must be set.
+ *
+ * @param [in,out]  kernel  The kernel.
+ *
+ * @returns True if the kernel can be applied in fixed-point
+ */
+CVL_PROCESSING_EXPORT bool prepareFixedPointKernel( FixedPointKernel& kernel );
+
+/**
+ * Function that converts a kernel to a fixed-point kernel.
+ *
+ * @param [in]   kernel      The filter kernel
+ * @param [out]  fixedPoint  The fixed-point kernel
+ *
+ * @returns True if the kernel can be applied in fixed-point
+ */
+template < Arithmetic KernelType, size_t Extent >
+bool makeFixedPointKernel( std::span< const KernelType, Extent > kernel,
+                           FixedPointKernel& fixedPoint )
+{
+    if constexpr ( ! std::is_integral_v< KernelType > )
+    {
+        return false;
+    }
+    else
+    {
+        const auto size = static_cast< int32_t >( kernel.size( ) );
+
+        if ( size > FixedPointKernel::max_size || size % 2 == 0 )
+        {
+            return false;
+        }
+
+        for ( size_t i = 0; i < kernel.size( ); i++ )
+        {
+            const auto coefficient = static_cast< int64_t >( kernel[ i ] );
+
+            if ( coefficient < std::numeric_limits< int16_t >::min( ) ||
+                 coefficient > std::numeric_limits< int16_t >::max( ) )
+            {
+                return false;
+            }
+
+            fixedPoint.coefficients[ i ] =
+                static_cast< int16_t >( coefficient );
+        }
+
+        fixedPoint.size = size;
+
+        return prepareFixedPointKernel( fixedPoint );
+    }
+}
+
+/**
+ * Function that converts a kernel to a fixed-point kernel.
+ *
+ * @param [in]   kernel      The filter kernel
+ * @param [out]  fixedPoint  The fixed-point kernel
+ *
+ * @returns True if the kernel can be applied in fixed-point
+ */
+template < Arithmetic KernelType >
+bool makeFixedPointKernel( const std::vector< KernelType >& kernel,
+                           FixedPointKernel& fixedPoint )
+{
+    return makeFixedPointKernel( std::span< const KernelType >( kernel ),
+                                 fixedPoint );
+}
+
+/**
+ * Function that filters a part of a row with a fixed-point kernel. This is
+ * the scalar reference implementation.
+ *
+ * @param [in]   srcPtr   The input element under the center of the kernel
+ *                        for the first output element
+ * @param [out]  dstPtr   The first output element
+ * @param [in]   count    The number of output elements
+ * @param [in]   tapStep  The distance of the kernel taps in elements
+ * @param [in]   kernel   The fixed-point kernel
+ */
+inline void filterRowFixedPointScalar( const uint8_t* srcPtr, uint8_t* dstPtr,
+                                       int32_t count, int32_t tapStep,
+                                       const FixedPointKernel& kernel )
+{
+    const auto anchor = kernel.size / 2;
+
+    for ( int32_t x = 0; x < count; x++ )
+    {
+        int32_t sum { };
+
+        for ( int32_t k = 0; k < kernel.size; k++ )
+        {
+            sum += srcPtr[ x + ( k - anchor ) * tapStep ] *
+                   kernel.coefficients[ static_cast< size_t >( k ) ];
+        }
+
+        dstPtr[ x ] = static_cast< uint8_t >(
+            std::clamp( sum / kernel.divisor, 0, 255 ) );
+    }
+}
+
+/**
+ * Function that filters a part of a row with a fixed-point kernel using a
+ * SIMD instruction set. The result is bit-identical to
+ * filterRowFixedPointScalar for every level. Kernels of size 3, 5 and 7 are
+ * unrolled.
+ *
+ * @param [in]   srcPtr   The input element under the center of the kernel
+ *                        for the first output element
+ * @param [out]  dstPtr   The first output element
+ * @param [in]   count    The number of output elements
+ * @param [in]   tapStep  The distance of the kernel taps in elements
+ * @param [in]   kernel   The fixed-point kernel
+ * @param [in]   level    The SIMD level to use. Must be supported by the
+ *                        CPU.
+ */
+CVL_PROCESSING_EXPORT
+void filterRowFixedPoint( const uint8_t* srcPtr, uint8_t* dstPtr,
+                          int32_t count, int32_t tapStep,
+                          const FixedPointKernel& kernel,
+                          core::SimdLevel level );
+
+/**
+ * Function that filters a part of a row from the rows above and below with a
+ * fixed-point kernel. This is the scalar reference implementation.
+ *
+ * @param [in]   rows     The input rows, one per coefficient, pointing to
+ *                        the element of the first output element
+ * @param [out]  dstPtr   The first output element
+ * @param [in]   count    The number of output elements
+ * @param [in]   kernel   The fixed-point kernel
+ */
+inline void filterColumnFixedPointScalar( const uint8_t* const* rows,
+                                          uint8_t* dstPtr, int32_t count,
+                                          const FixedPointKernel& kernel )
+{
+    for ( int32_t x = 0; x < count; x++ )
+    {
+        int32_t sum { };
+
+        for ( size_t k = 0; k < static_cast< size_t >( kernel.size ); k++ )
+        {
+            sum += rows[ k ][ x ] * kernel.coefficients[ k ];
+        }
+
+        dstPtr[ x ] = static_cast< uint8_t >(
+            std::clamp( sum / kernel.divisor, 0, 255 ) );
+    }
+}
+
+/**
+ * Function that filters a part of a row from the rows above and below with a
+ * fixed-point kernel using a SIMD instruction set. The result is
+ * bit-identical to filterColumnFixedPointScalar for every level. Kernels of
+ * size 3, 5 and 7 are unrolled.
+ *
+ * @param [in]   rows     The input rows, one per coefficient, pointing to
+ *                        the element of the first output element
+ * @param [out]  dstPtr   The first output element
+ * @param [in]   count    The number of output elements
+ * @param [in]   kernel   The fixed-point kernel
+ * @param [in]   level    The SIMD level to use. Must be supported by the
+ *                        CPU.
+ */
+CVL_PROCESSING_EXPORT
+void filterColumnFixedPoint( const uint8_t* const* rows, uint8_t* dstPtr,
+                             int32_t count, const FixedPointKernel& kernel,
+                             core::SimdLevel level );
+
+/**
+ * The size of the data cache the strips of the column filter are sized for
+ */
+constexpr int32_t column_filter_cache_size = 32 * 1024;
+
+/**
+ * Function that returns the width of the vertical strips of the column filter
+ * in elements. The input rows of a kernel and the output row of a strip fit
+ * into the data cache, so the rows are still cached when the next output row
+ * reads them again.
+ *
+ * @param [in]  kernelSize   The size of the kernel
+ * @param [in]  elementSize  The size of an element in bytes
+ */
+constexpr int32_t getColumnStripWidth( int32_t kernelSize,
+                                       int32_t elementSize )
+{
+    const auto width =
+        column_filter_cache_size / ( ( kernelSize + 1 ) * elementSize );
+
+    // Whole cache lines of at least 64 elements
+    return std::max( 64, width / 64 * 64 );
+}
+
+/**
+ * Function that moves the running column sums of a box filter down by one
+ * row and stores the quotients. This is the scalar reference implementation.
+ *
+ * @param [in,out]  sums     The running sums of the columns
+ * @param [in]      addRow   The row entering the box
+ * @param [in]      subRow   The row leaving the box
+ * @param [out]     dstPtr   The quotients of the new sums
+ * @param [in]      count    The number of elements
+ * @param [in]      divisor  The number of rows of the box
+ */
+inline void slideBoxColumnScalar( int32_t* sums, const uint8_t* addRow,
+                                  const uint8_t* subRow, uint8_t* dstPtr,
+                                  int32_t count,
+                                  const FixedPointDivisor& divisor )
+{
+    for ( int32_t x = 0; x < count; x++ )
+    {
+        sums[ x ] += addRow[ x ] - subRow[ x ];
+
+        dstPtr[ x ] = static_cast< uint8_t >(
+            std::clamp( sums[ x ] / divisor.divisor, 0, 255 ) );
+    }
+}
+
+/**
+ * Function that moves the running column sums of a box filter down by one
+ * row and stores the quotients using a SIMD instruction set. The result is
+ * bit-identical to slideBoxColumnScalar for every level.
+ *
+ * @param [in,out]  sums     The running sums of the columns
+ * @param [in]      addRow   The row entering the box
+ * @param [in]      subRow   The row leaving the box
+ * @param [out]     dstPtr   The quotients of the new sums
+ * @param [in]      count    The number of elements
+ * @param [in]      divisor  The number of rows of the box
+ * @param [in]      level    The SIMD level to use. Must be supported by the
+ *                           CPU.
+ */
+CVL_PROCESSING_EXPORT
+void slideBoxColumn( int32_t* sums, const uint8_t* addRow,
+                     const uint8_t* subRow, uint8_t* dstPtr, int32_t count,
+                     const FixedPointDivisor& divisor, core::SimdLevel level );
+
+/**
+ * Function that computes the box sums of a row from its prefix sums and
+ * stores the quotients. This is the scalar reference implementation.
+ *
+ * @param [in]   prefix    The prefix sums. The sum of the box of an element
+ *                         is prefix[ x + distance ] - prefix[ x ].
+ * @param [out]  dstPtr    The quotients
+ * @param [in]   count     The number of elements
+ * @param [in]   distance  The distance of the prefix sums in elements
+ * @param [in]   divisor   The number of columns of the box
+ */
+inline void differenceBoxRowScalar( const int32_t* prefix, uint8_t* dstPtr,
+                                    int32_t count, int32_t distance,
+                                    const FixedPointDivisor& divisor )
+{
+    for ( int32_t x = 0; x < count; x++ )
+    {
+        const auto sum = prefix[ x + distance ] - prefix[ x ];
+
+        dstPtr[ x ] = static_cast< uint8_t >(
+            std::clamp( sum / divisor.divisor, 0, 255 ) );
+    }
+}
+
+/**
+ * Function that computes the box sums of a row from its prefix sums and
+ * stores the quotients using a SIMD instruction set. The result is
+ * bit-identical to differenceBoxRowScalar for every level.
+ *
+ * @param [in]   prefix    The prefix sums. The sum of the box of an element
+ *                         is prefix[ x + distance ] - prefix[ x ].
+ * @param [out]  dstPtr    The quotients
+ * @param [in]   count     The number of elements
+ * @param [in]   distance  The distance of the prefix sums in elements
+ * @param [in]   divisor   The number of columns of the box
+ * @param [in]   level     The SIMD level to use. Must be supported by the
+ *                         CPU.
+ */
+CVL_PROCESSING_EXPORT
+void differenceBoxRow( const int32_t* prefix, uint8_t* dstPtr, int32_t count,
+                       int32_t distance, const FixedPointDivisor& divisor,
+                       core::SimdLevel level );
+
+/**
+ * @brief Trait for filters with a fixed-point kernel
+ */
+template < typename PixelTypeIn, typename PixelTypeOut, typename KernelType >
+constexpr bool hasFixedPointKernel =
+    std::is_same_v< PixelTypeIn, uint8_t > &&
+    std::is_same_v< PixelTypeOut, uint8_t > &&
+    std::is_integral_v< KernelType >;
+
+} // namespace cvl::processing::detail
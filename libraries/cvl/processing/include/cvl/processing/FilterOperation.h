@@ -5,22 +5,62 @@
 #include <cvl/core/Types.h>
 #include <cvl/core/macros.h>
 
+// STD includes
+#include <span>
+
 namespace cvl::processing
 {
+/**
+ * Function that calls a function with the kernel. Kernels of size 3, 5 and 7
+ * with a size known at run time are passed with the size known at compile
+ * time, so the loops over the kernel can be unrolled.
+ *
+ * @param [in]  kernel      The filter kernel
+ * @param [in]  function    The function called with the kernel
+ */
+template < Arithmetic KernelType, size_t Extent, typename Function >
+void dispatchKernelSize( std::span< const KernelType, Extent > kernel,
+                         Function&& function )
+{
+    if constexpr ( Extent == std::dynamic_extent )
+    {
+        switch ( kernel.size( ) )
+        {
+        case 3:
+            function( kernel.template first< 3 >( ) );
+            return;
+        case 5:
+            function( kernel.template first< 5 >( ) );
+            return;
+        case 7:
+            function( kernel.template first< 7 >( ) );
+            return;
+        default:
+            break;
+        }
+    }
+
+    function( kernel );
+}
+
 template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
            Arithmetic PixelTypeOut, Arithmetic KernelType,
-           core::FilterDirection Direction >
+           core::FilterDirection Direction,
+           core::ChannelLayout Layout = core::PlanarLayout,
+           core::RowAlignmentPolicy Alignment = core::PackedRows >
 struct FilterOperation
 {
     // member declaration
+    template < size_t Extent >
     static void applyFilter(
-        [[maybe_unused]] const core::Image< PixelTypeIn, Channels, Allocator >&
-            imageIn,
+        [[maybe_unused]] const core::Image< PixelTypeIn, Channels, Allocator,
+                                            Layout, Alignment >& imageIn,
         [[maybe_unused]] core::Image<
             PixelTypeOut, Channels,
             typename std::allocator_traits< Allocator >::template rebind_alloc<
-                PixelTypeIn > >& imageOut,
-        [[maybe_unused]] const std::vector< KernelType >& kernel )
+                PixelTypeIn >,
+            Layout, Alignment >& imageOut,
+        [[maybe_unused]] std::span< const KernelType, Extent > kernel )
     {
         THROW_MSG( "NOT IMPLEMENTED IMAGE TYPE" );
     }
@@ -0,0 +1,442 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/Image.h>
+#include <cvl/core/Point.h>
+#include <cvl/core/Rectangle.h>
+#include <cvl/core/Region.h>
+#include <cvl/core/macros.h>
+#include <cvl/processing/Blob.h>
+
+// STD includes
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cvl::processing
+{
+
+namespace detail
+{
+
+/*
+ * A region feature that can be set from the blob statistics of the labeling
+ */
+template < typename Feature >
+concept BlobFeature = requires( Feature feature, const Blob& blob ) {
+    feature.setStatistics( blob );
+};
+
+template < typename Feature, typename RegionType >
+void setBlobFeature( RegionType& region, const Blob& blob )
+{
+    if constexpr ( BlobFeature< Feature > )
+    {
+        static_cast< Feature& >( region ).setStatistics( blob );
+    }
+}
+
+/*
+ * Function that sets all features of a region that can be set from the blob
+ * statistics. The other features are calculated from the label image on
+ * demand.
+ */
+template < typename PixelType, typename Allocator,
+           template < typename > typename... RegionFeature >
+void setBlobFeatures(
+    core::Region< PixelType, Allocator, RegionFeature... >& region,
+    const Blob& blob )
+{
+    using RegionType = core::Region< PixelType, Allocator, RegionFeature... >;
+
+    ( setBlobFeature< RegionFeature< RegionType > >( region, blob ), ... );
+}
+
+} // namespace detail
+
+template < typename PixelType, typename Allocator >
+class RegionSet;
+
+/**
+ * @brief A non-owning view of one region of a RegionSet
+ *
+ * The view holds a pointer to the set and the index of the region. It is
+ * only valid as long as the set is alive and not relabeled.
+ */
+template < typename PixelType, typename Allocator >
+class RegionView
+{
+public:
+    using RegionSetType = RegionSet< PixelType, Allocator >;
+
+    /**
+     * Value constructor
+     *
+     * @param [in]  regionSet   The set the region belongs to.
+     * @param [in]  index       The index of the region in the set.
+     */
+    RegionView( const RegionSetType& regionSet, size_t index ) noexcept
+        : mRegionSet( &regionSet )
+        , mIndex( index )
+    {
+    }
+
+    /**
+     * Accessor label number
+     *
+     * @returns The label number of the region in the label image
+     */
+    [[nodiscard]] int32_t getLabelNumber( ) const
+    {
+        return mRegionSet->getLabelNumber( mIndex );
+    }
+
+    /**
+     * Accessor label image
+     *
+     * @returns The label image shared by all regions of the set
+     */
+    [[nodiscard]] const core::Image< PixelType, 1, Allocator >&
+    getLabelImage( ) const
+    {
+        return mRegionSet->getLabelImage( );
+    }
+
+    /**
+     * Accessor area
+     *
+     * @returns The number of pixels of the region
+     */
+    [[nodiscard]] int32_t getArea( ) const
+    {
+        return mRegionSet->getArea( mIndex );
+    }
+
+    /**
+     * Accessor center
+     *
+     * @returns The center of gravity of the region
+     */
+    [[nodiscard]] core::Point< double, 2 > getCenter( ) const
+    {
+        return mRegionSet->getCenter( mIndex );
+    }
+
+    /**
+     * Accessor bounding box
+     *
+     * @returns The bounding box of the region in pixels
+     */
+    [[nodiscard]] core::Rectangle< int32_t > getBoundingBox( ) const
+    {
+        return mRegionSet->getBoundingBox( mIndex );
+    }
+
+private:
+    const RegionSetType* mRegionSet { };
+    size_t mIndex { };
+};
+
+/**
+ * @brief The RegionSet class
+ *
+ * A flat container for the result of a connected component labeling. All
+ * regions share one label image. The features are stored as one column per
+ * value, e.g. all areas are contiguous, instead of one object per region.
+ * Filling the set does not allocate per region, and the columns are reused
+ * if the same set is labeled again.
+ *
+ * The regions are ordered by their label number, i.e. region i has the label
+ * number i + 1. Views on single regions are created on demand and do not
+ * copy the label image.
+ */
+template < typename PixelType,
+           typename Allocator = core::AlignedAllocator< PixelType > >
+class RegionSet
+{
+public:
+    using RegionViewType = RegionView< PixelType, Allocator >;
+
+    RegionSet( ) = default;
+
+    /**
+     * Function that replaces the content of the set
+     *
+     * @param [in]  labelImage  The label image of the regions.
+     * @param [in]  blobs       The statistics of the regions, ordered by the
+     *                          label number.
+     */
+    void assign( core::Image< PixelType, 1, Allocator > labelImage,
+                 const std::vector< Blob >& blobs )
+    {
+        mLabelImage = std::move( labelImage );
+
+        const auto numberRegions = blobs.size( );
+
+        mAreas.resize( numberRegions );
+        mLefts.resize( numberRegions );
+        mTops.resize( numberRegions );
+        mRights.resize( numberRegions );
+        mBottoms.resize( numberRegions );
+        mSumsX.resize( numberRegions );
+        mSumsY.resize( numberRegions );
+
+        for ( size_t i = 0; i < numberRegions; i++ )
+        {
+            const auto& blob = blobs[ i ];
+
+            EXPECT_MSG( blob.label == static_cast< int32_t >( i + 1 ),
+                        "Blob label(" << blob.label
+                                      << ") does not match its index(" << i
+                                      << ")" );
+
+            mAreas[ i ] = blob.area;
+            mLefts[ i ] = blob.left;
+            mTops[ i ] = blob.top;
+            mRights[ i ] = blob.right;
+            mBottoms[ i ] = blob.bottom;
+            mSumsX[ i ] = blob.sumX;
+            mSumsY[ i ] = blob.sumY;
+        }
+    }
+
+    /**
+     * Accessor size
+     *
+     * @returns The number of regions
+     */
+    [[nodiscard]] size_t size( ) const noexcept
+    {
+        return mAreas.size( );
+    }
+
+    /**
+     * Function that checks if the set has no regions
+     *
+     * @returns True if the set is empty
+     */
+    [[nodiscard]] bool empty( ) const noexcept
+    {
+        return mAreas.empty( );
+    }
+
+    /**
+     * Function that creates a view of a region
+     *
+     * @param [in]  index   The index of the region.
+     *
+     * @returns The view of the region
+     */
+    [[nodiscard]] RegionViewType operator[]( size_t index ) const noexcept
+    {
+        return RegionViewType( *this, index );
+    }
+
+    /**
+     * Accessor label image
+     *
+     * @returns The label image shared by all regions
+     */
+    [[nodiscard]] const core::Image< PixelType, 1, Allocator >&
+    getLabelImage( ) const noexcept
+    {
+        return mLabelImage;
+    }
+
+    /**
+     * Accessor label number
+     *
+     * @param [in]  index   The index of the region.
+     *
+     * @returns The label number of the region in the label image
+     */
+    [[nodiscard]] int32_t getLabelNumber( size_t index ) const noexcept
+    {
+        return static_cast< int32_t >( index + 1 );
+    }
+
+    /**
+     * Accessor area
+     *
+     * @param [in]  index   The index of the region.
+     *
+     * @returns The number of pixels of the region
+     */
+    [[nodiscard]] int32_t getArea( size_t index ) const
+    {
+        return mAreas[ index ];
+    }
+
+    /**
+     * Accessor center
+     *
+     * @param [in]  index   The index of the region.
+     *
+     * @returns The center of gravity of the region
+     */
+    [[nodiscard]] core::Point< double, 2 > getCenter( size_t index ) const
+    {
+        const auto area = static_cast< double >( mAreas[ index ] );
+
+        return core::Point< double, 2 >(
+            static_cast< double >( mSumsX[ index ] ) / area,
+            static_cast< double >( mSumsY[ index ] ) / area );
+    }
+
+    /**
+     * Accessor bounding box
+     *
+     * @param [in]  index   The index of the region.
+     *
+     * @returns The bounding box of the region in pixels
+     */
+    [[nodiscard]] core::Rectangle< int32_t >
+    getBoundingBox( size_t index ) const
+    {
+        return core::Rectangle< int32_t >(
+            core::Point2i( mLefts[ index ], mTops[ index ] ),
+            core::SizeI( mRights[ index ] - mLefts[ index ] + 1,
+                         mBottoms[ index ] - mTops[ index ] + 1 ) );
+    }
+
+    /**
+     * Accessor area column
+     *
+     * @returns The areas of all regions
+     */
+    [[nodiscard]] const std::vector< int32_t >& getAreas( ) const noexcept
+    {
+        return mAreas;
+    }
+
+    /**
+     * Accessor left column
+     *
+     * @returns The left columns of the bounding boxes of all regions
+     */
+    [[nodiscard]] const std::vector< int32_t >& getLefts( ) const noexcept
+    {
+        return mLefts;
+    }
+
+    /**
+     * Accessor top column
+     *
+     * @returns The top rows of the bounding boxes of all regions
+     */
+    [[nodiscard]] const std::vector< int32_t >& getTops( ) const noexcept
+    {
+        return mTops;
+    }
+
+    /**
+     * Accessor right column
+     *
+     * @returns The right columns of the bounding boxes of all regions
+     */
+    [[nodiscard]] const std::vector< int32_t >& getRights( ) const noexcept
+    {
+        return mRights;
+    }
+
+    /**
+     * Accessor bottom column
+     *
+     * @returns The bottom rows of the bounding boxes of all regions
+     */
+    [[nodiscard]] const std::vector< int32_t >& getBottoms( ) const noexcept
+    {
+        return mBottoms;
+    }
+
+    /**
+     * Accessor column sum column
+     *
+     * @returns The sums of the column coordinates of all regions
+     */
+    [[nodiscard]] const std::vector< int64_t >& getSumsX( ) const noexcept
+    {
+        return mSumsX;
+    }
+
+    /**
+     * Accessor row sum column
+     *
+     * @returns The sums of the row coordinates of all regions
+     */
+    [[nodiscard]] const std::vector< int64_t >& getSumsY( ) const noexcept
+    {
+        return mSumsY;
+    }
+
+    /**
+     * Function that creates one owning region per entry of the set. The
+     * regions share the label image of the set. Labeling the set again does
+     * not relabel a shared label image, so the regions stay valid. Features
+     * that can be set from the statistics of the set are set, the others are
+     * calculated on demand.
+     *
+     * E.g.:
+     *
+     * auto regions = regionSet.template toRegions< Area, Center >( );
+     *
+     * @returns The regions ordered by the label number
+     */
+    template < template < typename > typename... RegionFeature >
+    [[nodiscard]] std::vector< std::unique_ptr<
+        core::Region< PixelType, Allocator, RegionFeature... > > >
+    toRegions( ) const
+    {
+        using RegionType =
+            core::Region< PixelType, Allocator, RegionFeature... >;
+
+        std::vector< std::unique_ptr< RegionType > > regionsOut;
+
+        regionsOut.reserve( size( ) );
+
+        for ( size_t i = 0; i < size( ); i++ )
+        {
+            auto region = std::make_unique< RegionType >( mLabelImage,
+                                                          getLabelNumber( i ) );
+
+            detail::setBlobFeatures( *region, getBlob( i ) );
+
+            regionsOut.push_back( std::move( region ) );
+        }
+
+        return regionsOut;
+    }
+
+private:
+    Blob getBlob( size_t index ) const
+    {
+        Blob blob;
+
+        blob.top = mTops[ index ];
+        blob.bottom = mBottoms[ index ];
+        blob.left = mLefts[ index ];
+        blob.right = mRights[ index ];
+        blob.area = mAreas[ index ];
+        blob.label = getLabelNumber( index );
+        // The first column is not stored, no feature depends on it
+        blob.firstColumn = blob.left;
+        blob.sumX = mSumsX[ index ];
+        blob.sumY = mSumsY[ index ];
+
+        return blob;
+    }
+
+private:
+    core::Image< PixelType, 1, Allocator > mLabelImage;
+
+    std::vector< int32_t > mAreas;
+    std::vector< int32_t > mLefts;
+    std::vector< int32_t > mTops;
+    std::vector< int32_t > mRights;
+    std::vector< int32_t > mBottoms;
+    std::vector< int64_t > mSumsX;
+    std::vector< int64_t > mSumsY;
+};
+
+} // namespace cvl::processing
@@ -3,8 +3,13 @@
 // CVL includes
 #include <cvl/core/Image.h>
 #include <cvl/core/Types.h>
+#include <cvl/processing/FilterKernels.h>
 #include <cvl/processing/FilterOperation.h>
 
+// STD includes
+#include <algorithm>
+#include <span>
+
 namespace cvl::processing
 {
 
@@ -12,23 +17,44 @@ namespace cvl::processing
 // FULL TEMPLATE VERSION
 //
 template < Arithmetic PixelTypeIn, int32_t Channels, typename Allocator,
-           Arithmetic PixelTypeOut, Arithmetic KernelType >
+           Arithmetic PixelTypeOut, Arithmetic KernelType,
+           core::ChannelLayout Layout, core::RowAlignmentPolicy Alignment >
 struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
-                        KernelType, core::FilterDirection::Row >
+                        KernelType, core::FilterDirection::Row, Layout,
+                        Alignment >
 {
-    static void applyFilter(
-        const core::Image< PixelTypeIn, Channels, Allocator >& imageIn,
+    using ImageIn =
+        core::Image< PixelTypeIn, Channels, Allocator, Layout, Alignment >;
+    using ImageOut =
         core::Image< PixelTypeOut, Channels,
-                     typename std::allocator_traits< Allocator >::
-                         template rebind_alloc< PixelTypeIn > >& imageOut,
-        const std::vector< KernelType >& kernel )
+                     typename std::allocator_traits<
+                         Allocator >::template rebind_alloc< PixelTypeIn >,
+                     Layout, Alignment >;
+
+    template < size_t Extent >
+    static void applyFilter( const ImageIn& imageIn, ImageOut& imageOut,
+                             std::span< const KernelType, Extent > kernel )
+    {
+        dispatchKernelSize( kernel,
+                            [ & ]( auto sizedKernel )
+                            { apply( imageIn, imageOut, sizedKernel ); } );
+    }
+
+private:
+    /*
+     * Function that applies the filter. The kernel size is known at compile
+     * time for all extents but std::dynamic_extent.
+     */
+    template < size_t Extent >
+    static void apply( const ImageIn& imageIn, ImageOut& imageOut,
+                       std::span< const KernelType, Extent > kernel )
     {
         using sumType = decltype( std::declval< PixelTypeIn >( ) +
                                   std::declval< PixelTypeOut >( ) );
 
-        using allocator_traits = std::allocator_traits< Allocator >;
-        using OutAllocator =
-            typename allocator_traits::template rebind_alloc< PixelTypeOut >;
+        // The layout defines the distance of the pixels of a channel. The
+        // inner loops are specialized on it at compile time.
+        constexpr auto step = ImageIn::pixel_step;
 
         const auto width = imageIn.getWidth( );
         const auto height = imageIn.getHeight( );
@@ -37,8 +63,7 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
 
         if ( imageOut.getSize( ) != imageIn.getSize( ) )
         {
-            imageOut = core::Image< PixelTypeOut, 1, OutAllocator >(
-                width, height, true );
+            imageOut = ImageOut( width, height, true );
         }
 
         KernelType divisor = { };
@@ -53,6 +78,36 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
             scale = 1.0f / static_cast< float >( divisor );
         }
 
+        // Integer kernels on 8 bit images are applied in fixed-point. The
+        // result is the exact quotient, saturated to the range of uint8_t.
+        detail::FixedPointKernel fixedPoint;
+        bool useFixedPoint { false };
+
+        if constexpr ( detail::hasFixedPointKernel< PixelTypeIn,
+                                                    PixelTypeOut,
+                                                    KernelType > )
+        {
+            useFixedPoint = detail::makeFixedPointKernel( kernel, fixedPoint );
+        }
+
+        const auto normalize = [ & ]( sumType sum ) -> PixelTypeOut
+        {
+            if constexpr ( detail::hasFixedPointKernel< PixelTypeIn,
+                                                        PixelTypeOut,
+                                                        KernelType > )
+            {
+                if ( useFixedPoint )
+                {
+                    return static_cast< PixelTypeOut >(
+                        std::clamp( sum / fixedPoint.divisor, 0, 255 ) );
+                }
+            }
+
+            sum = static_cast< sumType >( static_cast< float >( sum ) * scale );
+
+            return static_cast< PixelTypeOut >( static_cast< uint8_t >( sum ) );
+        };
+
         // Left columns
         for ( int32_t c = 0; c < Channels; c++ )
         {
@@ -70,14 +125,11 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
                     {
                         const auto px = std::abs( x + kx ) - x;
 
-                        sum += *( srcPtr + x + px ) *
+                        sum += srcPtr[ ( x + px ) * step ] *
                                static_cast< sumType >( *kernelIt++ );
                     }
 
-                    sum = static_cast< sumType >( static_cast< float >( sum ) *
-                                                  scale );
-
-                    *( dstPtr + x ) = static_cast< uint8_t >( sum );
+                    dstPtr[ x * step ] = normalize( sum );
                 }
             }
         }
@@ -105,19 +157,44 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
                         }
                         const auto px = idx - x;
 
-                        sum += *( srcPtr + x + px ) *
+                        sum += srcPtr[ ( x + px ) * step ] *
                                static_cast< sumType >( *kernelIt++ );
                     }
 
-                    sum = static_cast< sumType >( static_cast< float >( sum ) *
-                                                  scale );
-
-                    *( dstPtr + x ) = static_cast< uint8_t >( sum );
+                    dstPtr[ x * step ] = normalize( sum );
                 }
             }
         }
 
         // Columns between left and right
+        if ( useFixedPoint )
+        {
+            if constexpr ( detail::hasFixedPointKernel< PixelTypeIn,
+                                                        PixelTypeOut,
+                                                        KernelType > )
+            {
+                const auto level = core::getSimdLevel( );
+
+                for ( int32_t plane = 0; plane < ImageIn::number_planes;
+                      plane++ )
+                {
+                    for ( int32_t y = 0; y < height && width > 2 * anchorX;
+                          y++ )
+                    {
+                        detail::filterRowFixedPoint(
+                            imageIn.getRowPointer( y, plane ) + anchorX * step,
+                            imageOut.getRowPointer( y, plane ) + anchorX * step,
+                            ( width - 2 * anchorX ) * step,
+                            step,
+                            fixedPoint,
+                            level );
+                    }
+                }
+            }
+
+            return;
+        }
+
         for ( int32_t c = 0; c < Channels; c++ )
         {
             for ( int32_t y = 0; y < height; y++ )
@@ -132,14 +209,11 @@ struct FilterOperation< PixelTypeIn, Channels, Allocator, PixelTypeOut,
 
                     for ( int32_t kx = -anchorX; kx <= anchorX; ++kx )
                     {
-                        sum += *( srcPtr + x + kx ) *
+                        sum += srcPtr[ ( x + kx ) * step ] *
                                static_cast< sumType >( *kernelIt++ );
                     }
 
-                    sum = static_cast< sumType >( static_cast< float >( sum ) *
-                                                  scale );
-
-                    *( dstPtr + x ) = static_cast< uint8_t >( sum );
+                    dstPtr[ x * step ] = normalize( sum );
                 }
             }
         }
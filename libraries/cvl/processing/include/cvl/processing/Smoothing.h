@@ -3,16 +3,43 @@
 // CVL includes
 #include <cvl/core/Image.h>
 #include <cvl/core/macros.h>
+#include <cvl/processing/BoxFilter.h>
 #include <cvl/processing/Filter2D.h>
 #include <cvl/processing/FilterCoefficients.h>
 
+// STD includes
+#include <cstdint>
+#include <type_traits>
+
 namespace cvl::processing
 {
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-void boxBlur( const core::Image< PixelType, Channels, Allocator >& imageIn,
-              core::Image< PixelType, Channels, Allocator >& imageOut,
-              const core::SizeI& kernelSize )
+namespace detail
+{
+// The running sums of boxFilter are faster than the separable filter from
+// this kernel size on
+constexpr int32_t box_filter_kernel_size = 11;
+
+/*
+ * Function that checks if an 8 bit box blur runs on boxFilter. Empty images
+ * take the separable filter like small kernels.
+ */
+inline bool useBoxFilter( const core::SizeI& imageSize,
+                          const core::SizeI& kernelSize )
+{
+    return imageSize.getWidth( ) > 0 && imageSize.getHeight( ) > 0 &&
+           ( kernelSize.getWidth( ) >= box_filter_kernel_size ||
+             kernelSize.getHeight( ) >= box_filter_kernel_size );
+}
+} // namespace detail
+
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           core::ChannelLayout Layout, core::RowAlignmentPolicy Alignment >
+void boxBlur(
+    const core::Image< PixelType, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelType, Channels, Allocator, Layout, Alignment >& imageOut,
+    const core::SizeI& kernelSize )
 {
     EXPECT_MSG( kernelSize.getWidth( ) % 2 != 0,
                 "Invalid kernel size("
@@ -24,15 +51,27 @@ void boxBlur( const core::Image< PixelType, Channels, Allocator >& imageIn,
                     << kernelSize
                     << ")  Only odd kernel size is allowed for boxBlur" );
 
+    if constexpr ( std::is_same_v< PixelType, uint8_t > )
+    {
+        if ( detail::useBoxFilter( imageIn.getSize( ), kernelSize ) )
+        {
+            boxFilter( imageIn, imageOut, kernelSize );
+            return;
+        }
+    }
+
     const auto kernel = getBoxKernel( kernelSize );
 
     filter2D( imageIn, imageOut, kernel );
 }
 
-template < Arithmetic PixelType, int32_t Channels, typename Allocator >
-void binomialBlur( const core::Image< PixelType, Channels, Allocator >& imageIn,
-                   core::Image< PixelType, Channels, Allocator >& imageOut,
-                   const core::SizeI& kernelSize )
+template < Arithmetic PixelType, int32_t Channels, typename Allocator,
+           core::ChannelLayout Layout, core::RowAlignmentPolicy Alignment >
+void binomialBlur(
+    const core::Image< PixelType, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelType, Channels, Allocator, Layout, Alignment >& imageOut,
+    const core::SizeI& kernelSize )
 {
     EXPECT_MSG( kernelSize.getWidth( ) % 2 != 0,
                 "Invalid kernel size("
@@ -49,4 +88,57 @@ void binomialBlur( const core::Image< PixelType, Channels, Allocator >& imageIn,
     filter2D( imageIn, imageOut, kernel );
 }
 
-} // namespace cvl::processing
\ No newline at end of file
+/**
+ * Applies a box filter with a kernel size known at compile time, e.g.
+ * boxBlur< 5, 5 >( imageIn, imageOut ). Large kernels on 8 bit images run on
+ * boxFilter like the runtime boxBlur.
+ *
+ * @param [in]   imageIn    The input image
+ * @param [out]  imageOut   The output image
+ */
+template < size_t Width, size_t Height, Arithmetic PixelType, int32_t Channels,
+           typename Allocator, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
+void boxBlur(
+    const core::Image< PixelType, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelType, Channels, Allocator, Layout, Alignment >& imageOut )
+{
+    constexpr auto kernel = getBoxKernel< Width, Height >( );
+
+    if constexpr ( std::is_same_v< PixelType, uint8_t > )
+    {
+        const core::SizeI kernelSize( static_cast< int32_t >( Width ),
+                                      static_cast< int32_t >( Height ) );
+
+        if ( detail::useBoxFilter( imageIn.getSize( ), kernelSize ) )
+        {
+            boxFilter( imageIn, imageOut, kernelSize );
+            return;
+        }
+    }
+
+    filter2D( imageIn, imageOut, kernel );
+}
+
+/**
+ * Applies a binomial filter with a kernel size known at compile time, e.g.
+ * binomialBlur< 3, 3 >( imageIn, imageOut ).
+ *
+ * @param [in]   imageIn    The input image
+ * @param [out]  imageOut   The output image
+ */
+template < size_t Width, size_t Height, Arithmetic PixelType, int32_t Channels,
+           typename Allocator, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment >
+void binomialBlur(
+    const core::Image< PixelType, Channels, Allocator, Layout, Alignment >&
+        imageIn,
+    core::Image< PixelType, Channels, Allocator, Layout, Alignment >& imageOut )
+{
+    constexpr auto kernel = getBinomialKernel< Width, Height >( );
+
+    filter2D( imageIn, imageOut, kernel );
+}
+
+} // namespace cvl::processing
@@ -0,0 +1,184 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/Image.h>
+#include <cvl/core/RegionRLE.h>
+#include <cvl/core/macros.h>
+#include <cvl/processing/Blob.h>
+#include <cvl/processing/export.h>
+
+// STD includes
+#include <cstdint>
+#include <vector>
+
+namespace cvl::processing
+{
+
+/**
+ * @brief A connected component emitted by the streaming labeling
+ *
+ * The coordinates of the blob and the mask are relative to the origin row,
+ * which is the first row of the component in the stream. This keeps the
+ * coordinates in range regardless of how long the stream runs.
+ */
+struct StreamBlob
+{
+    /**
+     * The row of the stream the component starts in
+     */
+    int64_t originRow { };
+
+    /**
+     * The sequence number of the blob in the stream, starting at 1
+     */
+    int64_t id { };
+
+    /**
+     * The statistics of the component. The top row is always 0.
+     */
+    Blob blob;
+
+    /**
+     * The run length encoded mask of the component. The mask is empty if
+     * masks are disabled. The image size of the mask is the stream width times
+     * the height of the component.
+     */
+    core::RegionRLE mask;
+};
+
+/**
+ * @brief The StreamingConnectedComponents class
+ *
+ * Incremental connected component labeling for line scan images without
+ * frame boundaries. Rows can be pushed one by one or in blocks of any height.
+ * Only the runs of the previous row and the components touching it are kept.
+ * A component is emitted as soon as a row does not continue it, so the
+ * latency is one row.
+ *
+ * The memory for the statistics is bounded by the row width. If masks are
+ * enabled, the mask of a component grows with the component until it is
+ * emitted.
+ *
+ * The components are 8 connected.
+ */
+class CVL_PROCESSING_EXPORT StreamingConnectedComponents
+{
+public:
+    /**
+     * Value constructor
+     *
+     * @param [in]  width         The width of the rows.
+     * @param [in]  createMasks   Create a run length encoded mask for each
+     *                            component.
+     */
+    explicit StreamingConnectedComponents( int32_t width,
+                                           bool createMasks = false );
+
+    /**
+     * Function that labels a block of rows. All non-zero pixels are
+     * foreground.
+     *
+     * @param [in]   rows       The block of rows.
+     * @param [out]  blobsOut   The components that have been completed are
+     *                          appended.
+     */
+    template < typename Allocator >
+    void pushRows( const core::Image< uint8_t, 1, Allocator >& rows,
+                   std::vector< StreamBlob >& blobsOut );
+
+    /**
+     * Function that labels a single row. All non-zero pixels are foreground.
+     *
+     * @param [in]   rowPtr     The row with width pixels.
+     * @param [out]  blobsOut   The components that have been completed are
+     *                          appended.
+     */
+    void pushRow( const uint8_t* rowPtr, std::vector< StreamBlob >& blobsOut );
+
+    /**
+     * Function that completes all components, e.g. at the end of the stream.
+     * The next row is handled as if a background row was in between.
+     *
+     * @param [out]  blobsOut   The remaining components are appended.
+     */
+    void finish( std::vector< StreamBlob >& blobsOut );
+
+    /**
+     * Accessor width
+     *
+     * @returns The width of the rows
+     */
+    [[nodiscard]] int32_t getWidth( ) const;
+
+    /**
+     * Accessor row count
+     *
+     * @returns The number of rows pushed so far
+     */
+    [[nodiscard]] int64_t getRowCount( ) const;
+
+    /**
+     * Accessor number of active components
+     *
+     * @returns The number of components that can still grow
+     */
+    [[nodiscard]] size_t getNumberActiveComponents( ) const;
+
+private:
+    struct Component
+    {
+        int64_t originRow { };
+        Blob blob;
+        std::vector< core::Run > runs;
+    };
+
+    struct LabeledRun
+    {
+        int32_t colStart { };
+        int32_t colEnd { };
+        int32_t component { };
+    };
+
+    int32_t find( int32_t component );
+
+    void mergeComponents( Component& target, Component& source ) const;
+
+    void emit( Component& component, std::vector< StreamBlob >& blobsOut );
+
+private:
+    int32_t mWidth { };
+    bool mCreateMasks { };
+    int64_t mRowCount { };
+    int64_t mNumberBlobs { };
+
+    std::vector< Component > mComponents;
+    std::vector< LabeledRun > mPreviousRuns;
+
+    // Buffers reused for every row
+    std::vector< LabeledRun > mCurrentRuns;
+    std::vector< int32_t > mParent;
+    std::vector< int32_t > mCompactIds;
+    std::vector< Component > mNextComponents;
+};
+
+//
+// Template implementations
+//
+
+template < typename Allocator >
+void StreamingConnectedComponents::pushRows(
+    const core::Image< uint8_t, 1, Allocator >& rows,
+    std::vector< StreamBlob >& blobsOut )
+{
+    EXPECT_MSG( rows.getWidth( ) == mWidth,
+                "Row width(" << rows.getWidth( )
+                             << ") does not match stream width(" << mWidth
+                             << ")" );
+
+    for ( int32_t y = 0; y < rows.getHeight( ); y++ )
+    {
+        pushRow( rows.getRowPointer( y ), blobsOut );
+    }
+}
+
+} // namespace cvl::processing
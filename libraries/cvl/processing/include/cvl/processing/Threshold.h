@@ -2,7 +2,11 @@
 
 // CVL includes
 #include <cvl/core/Image.h>
+#include <cvl/core/Parallel.h>
 #include <cvl/core/Region.h>
+#include <cvl/core/RegionRLE.h>
+#include <cvl/core/TiledImage.h>
+#include <cvl/processing/ThresholdKernels.h>
 
 // STD includes
 
@@ -21,15 +25,22 @@ using allocator_traits = std::allocator_traits< Allocator >;
  * pixels.
  *
  * go > threshValue ? maxValue : 0x00
+ *
+ * For uint8_t, uint16_t and float input images, SIMD kernels are selected at
+ * runtime from the CPU features. The result is bit-identical to the scalar
+ * implementation. The rows of a single channel image are contiguous for
+ * every channel layout, so the same row kernels apply.
  */
-template < Arithmetic PixelType, typename Allocator,
+template < Arithmetic PixelType, typename Allocator, core::ChannelLayout Layout,
+           core::RowAlignmentPolicy Alignment,
            template < typename > typename... RegionFeature >
-void threshold( const core::Image< PixelType, 1, Allocator >& imageIn,
-                core::Region< uint8_t,
-                              typename allocator_traits<
-                                  Allocator >::template rebind_alloc< uint8_t >,
-                              RegionFeature... >& regionOut,
-                PixelType threshold, uint8_t maxValue = uint8_t { 1 } )
+void threshold(
+    const core::Image< PixelType, 1, Allocator, Layout, Alignment >& imageIn,
+    core::Region< uint8_t,
+                  typename allocator_traits<
+                      Allocator >::template rebind_alloc< uint8_t >,
+                  RegionFeature... >& regionOut,
+    PixelType threshold, uint8_t maxValue = uint8_t { 1 } )
 {
     using OutAllocator = typename allocator_traits<
         Allocator >::template rebind_alloc< uint8_t >;
@@ -52,23 +63,141 @@ void threshold( const core::Image< PixelType, 1, Allocator >& imageIn,
     const auto imageWidth = imageIn.getWidth( );
     const auto imageHeight = imageIn.getHeight( );
 
+    [[maybe_unused]] const auto simdLevel = core::getSimdLevel( );
+
     for ( int32_t y = 0; y < imageHeight; y++ )
     {
         const auto srcPtr = imageIn.getRowPointer( y );
         const auto dstPtr = regionOut.getLabelImage( ).getRowPointer( y );
 
-        for ( int32_t x = 0; x < imageWidth; x++ )
+        if constexpr ( detail::hasThresholdKernel< PixelType > )
+        {
+            detail::thresholdRow(
+                srcPtr, dstPtr, imageWidth, threshold, maxValue, simdLevel );
+        }
+        else
+        {
+            detail::thresholdRowScalar(
+                srcPtr, dstPtr, imageWidth, threshold, maxValue );
+        }
+    }
+}
+
+/**
+ * Segments the input image using global threshold
+ *
+ * @param [in]   imageIn      The input image
+ * @param [in]   regionOut    The segmented run length encoded output region
+ * @param [in]   threshold    The threshold value to use
+ *
+ * All pixels with go > threshValue are part of the output region. Only the
+ * foreground runs are stored, no label image of the full size is allocated.
+ */
+template < Arithmetic PixelType, typename Allocator,
+           core::ChannelLayout Layout, core::RowAlignmentPolicy Alignment >
+void threshold(
+    const core::Image< PixelType, 1, Allocator, Layout, Alignment >& imageIn,
+    core::RegionRLE& regionOut, PixelType threshold )
+{
+    regionOut.clear( );
+    regionOut.setImageSize( imageIn.getSize( ) );
+
+    const auto imageWidth = imageIn.getWidth( );
+    const auto imageHeight = imageIn.getHeight( );
+
+    for ( int32_t y = 0; y < imageHeight; y++ )
+    {
+        const auto srcPtr = imageIn.getRowPointer( y );
+
+        int32_t x = 0;
+        while ( x < imageWidth )
         {
-            if ( srcPtr[ x ] > threshold )
+            if ( ! ( srcPtr[ x ] > threshold ) )
             {
-                dstPtr[ x ] = maxValue;
+                x++;
+                continue;
             }
-            else
+
+            const auto colStart = x;
+
+            while ( x < imageWidth && srcPtr[ x ] > threshold )
             {
-                dstPtr[ x ] = uint8_t { 0 };
+                x++;
             }
+
+            regionOut.addRun( y, colStart, x - 1 );
         }
     }
 }
 
-} // namespace cvl::processing
\ No newline at end of file
+/**
+ * Segments the tiled input image using global threshold. The tiles are
+ * processed in parallel.
+ *
+ * @param [in]   imageIn      The tiled input image
+ * @param [out]  imageOut     The tiled binary output image. The image is
+ *                            reallocated if the size does not match.
+ * @param [in]   threshold    The threshold value to use
+ * @param [in]   maxValue     The value to be used for the foreground
+ *                            pixels.
+ *
+ * go > threshValue ? maxValue : 0x00
+ */
+template < Arithmetic PixelType, typename Allocator, core::ChannelLayout Layout,
+           int32_t TileSize >
+void threshold(
+    const core::TiledImage< PixelType, 1, Allocator, Layout, TileSize >&
+        imageIn,
+    core::TiledImage< uint8_t, 1,
+                      typename allocator_traits<
+                          Allocator >::template rebind_alloc< uint8_t >,
+                      Layout, TileSize >& imageOut,
+    PixelType threshold, uint8_t maxValue = uint8_t { 1 } )
+{
+    using OutAllocator = typename allocator_traits<
+        Allocator >::template rebind_alloc< uint8_t >;
+    using TiledImageOut =
+        core::TiledImage< uint8_t, 1, OutAllocator, Layout, TileSize >;
+
+    if ( imageOut.getSize( ) != imageIn.getSize( ) )
+    {
+        imageOut = TiledImageOut( imageIn.getSize( ),
+                                  false,
+                                  OutAllocator( imageIn.getAllocator( ) ) );
+    }
+
+    [[maybe_unused]] const auto simdLevel = core::getSimdLevel( );
+
+    core::parallelFor(
+        0,
+        imageIn.getNumberTiles( ),
+        [ & ]( int32_t index )
+        {
+            const auto tileIn = imageIn.getTile( index );
+            const auto tileOut = imageOut.getTile( index );
+            const auto tileWidth = tileIn.rect.getWidth( );
+
+            for ( int32_t y = 0; y < tileIn.rect.getHeight( ); y++ )
+            {
+                const auto srcPtr = tileIn.image.getRowPointer( y );
+                const auto dstPtr = tileOut.image.getRowPointer( y );
+
+                if constexpr ( detail::hasThresholdKernel< PixelType > )
+                {
+                    detail::thresholdRow( srcPtr,
+                                          dstPtr,
+                                          tileWidth,
+                                          threshold,
+                                          maxValue,
+                                          simdLevel );
+                }
+                else
+                {
+                    detail::thresholdRowScalar(
+                        srcPtr, dstPtr, tileWidth, threshold, maxValue );
+                }
+            }
+        } );
+}
+
+} // namespace cvl::processing
@@ -0,0 +1,78 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/CpuFeatures.h>
+#include <cvl/core/Types.h>
+#include <cvl/processing/export.h>
+
+// STD includes
+#include <cstdint>
+#include <type_traits>
+
+namespace cvl::processing::detail
+{
+
+/**
+ * Function that thresholds a single row. This is the scalar reference
+ * implementation for all pixel types.
+ *
+ * @param [in]   srcPtr       The input row
+ * @param [out]  dstPtr       The output row
+ * @param [in]   width        The number of pixels of the row
+ * @param [in]   threshold    The threshold value to use
+ * @param [in]   maxValue     The value to be used for the foreground pixels.
+ *
+ * go > threshValue ? maxValue : 0x00
+ */
+template < Arithmetic PixelType >
+void thresholdRowScalar( const PixelType* srcPtr, uint8_t* dstPtr,
+                         int32_t width, PixelType threshold, uint8_t maxValue )
+{
+    for ( int32_t x = 0; x < width; x++ )
+    {
+        if ( srcPtr[ x ] > threshold )
+        {
+            dstPtr[ x ] = maxValue;
+        }
+        else
+        {
+            dstPtr[ x ] = uint8_t { 0 };
+        }
+    }
+}
+
+/**
+ * Functions that threshold a single row using a SIMD instruction set. The
+ * result is bit-identical to thresholdRowScalar for every level.
+ *
+ * @param [in]   srcPtr       The input row
+ * @param [out]  dstPtr       The output row
+ * @param [in]   width        The number of pixels of the row
+ * @param [in]   threshold    The threshold value to use
+ * @param [in]   maxValue     The value to be used for the foreground pixels.
+ * @param [in]   level        The SIMD level to use. Must be supported by the
+ *                            CPU.
+ */
+CVL_PROCESSING_EXPORT
+void thresholdRow( const uint8_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                   uint8_t threshold, uint8_t maxValue,
+                   core::SimdLevel level );
+
+CVL_PROCESSING_EXPORT
+void thresholdRow( const uint16_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                   uint16_t threshold, uint8_t maxValue,
+                   core::SimdLevel level );
+
+CVL_PROCESSING_EXPORT
+void thresholdRow( const float* srcPtr, uint8_t* dstPtr, int32_t width,
+                   float threshold, uint8_t maxValue, core::SimdLevel level );
+
+/**
+ * @brief Trait for pixel types with SIMD threshold kernels
+ */
+template < typename PixelType >
+constexpr bool hasThresholdKernel = std::is_same_v< PixelType, uint8_t > ||
+                                    std::is_same_v< PixelType, uint16_t > ||
+                                    std::is_same_v< PixelType, float >;
+
+} // namespace cvl::processing::detail
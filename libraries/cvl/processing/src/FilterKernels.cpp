@@ -0,0 +1,744 @@
+// Own includes
+#include <cvl/processing/FilterKernels.h>
+
+// CVL includes
+#include <cvl/core/macros.h>
+
+#if CVL_ARCH_X86
+#include <immintrin.h>
+#endif
+
+// STD includes
+#include <bit>
+#include <cstdlib>
+
+namespace cvl::processing::detail
+{
+namespace
+{
+/*
+ * Function that searches the smallest shift with a reciprocal of the divisor
+ * below the limit. The reciprocal is rounded up, the error of the product must
+ * stay below one for every dividend up to the maximum.
+ */
+bool findReciprocal( uint64_t divisor, uint64_t maxDividend, int32_t minShift,
+                     int32_t maxShift, uint64_t limit, uint64_t& multiplier,
+                     int32_t& shift )
+{
+    for ( shift = minShift; shift <= maxShift; shift++ )
+    {
+        const auto power = uint64_t { 1 } << shift;
+
+        multiplier = ( power - 1 ) / divisor + 1;
+
+        if ( multiplier > limit )
+        {
+            return false;
+        }
+
+        const auto error = multiplier * divisor - power;
+
+        if ( error * ( maxDividend + 1 ) < power )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+} // namespace
+
+bool makeFixedPointDivisor( int32_t divisor, int32_t maxDividend,
+                            FixedPointDivisor& fixedPoint )
+{
+    if ( divisor <= 0 || maxDividend < 0 )
+    {
+        return false;
+    }
+
+    uint64_t multiplier { };
+    int32_t shift { };
+
+    if ( ! findReciprocal( static_cast< uint64_t >( divisor ),
+                           static_cast< uint64_t >( maxDividend ),
+                           0,
+                           63,
+                           std::numeric_limits< uint32_t >::max( ),
+                           multiplier,
+                           shift ) )
+    {
+        return false;
+    }
+
+    fixedPoint.divisor = divisor;
+    fixedPoint.multiplier = static_cast< uint32_t >( multiplier );
+    fixedPoint.shift = shift;
+
+    return true;
+}
+
+bool prepareFixedPointKernel( FixedPointKernel& kernel )
+{
+    if ( kernel.size <= 0 || kernel.size > FixedPointKernel::max_size )
+    {
+        return false;
+    }
+
+    int64_t sum { };
+    int64_t positiveSum { };
+    int64_t absoluteSum { };
+
+    for ( int32_t k = 0; k < kernel.size; k++ )
+    {
+        const auto coefficient =
+            static_cast< int64_t >( kernel.coefficients[ static_cast< size_t >(
+                k ) ] );
+
+        sum += coefficient;
+        positiveSum += std::max< int64_t >( coefficient, 0 );
+        absoluteSum += std::abs( coefficient );
+    }
+
+    // The sums of 8 bit pixels must fit into 32 bit
+    if ( sum < 0 || absoluteSum * 255 > std::numeric_limits< int32_t >::max( ) )
+    {
+        return false;
+    }
+
+    // The sum is clamped to 0 before the division, only positive sums are
+    // divided
+    const auto divisor = static_cast< uint64_t >( sum == 0 ? 1 : sum );
+    const auto maxSum = static_cast< uint64_t >( positiveSum ) * 255;
+
+    kernel.divisor = static_cast< int32_t >( divisor );
+
+    uint64_t multiplier { };
+    int32_t shift { };
+
+    if ( ! findReciprocal( divisor,
+                           maxSum,
+                           0,
+                           63,
+                           std::numeric_limits< uint32_t >::max( ),
+                           multiplier,
+                           shift ) )
+    {
+        return false;
+    }
+
+    kernel.multiplier = static_cast< uint32_t >( multiplier );
+    kernel.shift = shift;
+
+    // Box and binomial kernels of up to 257 pixels accumulate in 16 bit
+    kernel.narrow = sum == positiveSum && maxSum <= 0xFFFF;
+
+    if ( kernel.narrow )
+    {
+        if ( std::has_single_bit( divisor ) )
+        {
+            kernel.multiplier16 = 0;
+            kernel.shift16 =
+                static_cast< int32_t >( std::countr_zero( divisor ) );
+        }
+        else if ( findReciprocal(
+                      divisor, maxSum, 16, 31, 0xFFFF, multiplier, shift ) )
+        {
+            kernel.multiplier16 = static_cast< uint16_t >( multiplier );
+            kernel.shift16 = shift - 16;
+        }
+        else
+        {
+            kernel.narrow = false;
+        }
+    }
+
+    return true;
+}
+
+namespace
+{
+#if CVL_ARCH_X86
+
+//
+// SSE2
+//
+// The narrow path widens the pixels to 16 bit, the wide path to 32 bit. The
+// wide path multiplies with madd on pairs of a pixel and a zero, because SSE2
+// has no 32 bit multiplication. The 64 bit products of the reciprocal are
+// computed for the even and the odd lanes separately.
+//
+// The kernels read each tap from its own pointer, which is a neighbour in the
+// row for the row filter and a row of the image for the column filter. A size
+// other than 0 is known at compile time, the taps are unrolled and the
+// coefficients stay in registers.
+//
+
+CVL_TARGET_SSE2
+__m128i divideSSE2( __m128i sum, __m128i multiplier, __m128i shift )
+{
+    // Negative sums saturate to 0
+    sum = _mm_andnot_si128( _mm_srai_epi32( sum, 31 ), sum );
+
+    const auto even = _mm_srl_epi64( _mm_mul_epu32( sum, multiplier ), shift );
+    const auto odd = _mm_srl_epi64(
+        _mm_mul_epu32( _mm_srli_epi64( sum, 32 ), multiplier ), shift );
+
+    return _mm_or_si128( _mm_and_si128( even, _mm_set1_epi64x( 0xFFFFFFFF ) ),
+                         _mm_slli_epi64( odd, 32 ) );
+}
+
+template < int32_t Size >
+CVL_TARGET_SSE2 int32_t filterTapsSSE2( const uint8_t* const* taps,
+                                        uint8_t* dstPtr, int32_t x,
+                                        int32_t count,
+                                        const FixedPointKernel& kernel )
+{
+    const auto zero = _mm_setzero_si128( );
+    const auto size = static_cast< size_t >( Size > 0 ? Size : kernel.size );
+
+    __m128i coefficients[ FixedPointKernel::max_size ];
+
+    if ( kernel.narrow )
+    {
+        const auto multiplier =
+            _mm_set1_epi16( static_cast< short >( kernel.multiplier16 ) );
+        const auto shift = _mm_cvtsi32_si128( kernel.shift16 );
+
+        for ( size_t k = 0; k < size; k++ )
+        {
+            coefficients[ k ] = _mm_set1_epi16( kernel.coefficients[ k ] );
+        }
+
+        for ( ; x + 16 <= count; x += 16 )
+        {
+            auto sum0 = zero;
+            auto sum1 = zero;
+
+            for ( size_t k = 0; k < size; k++ )
+            {
+                const auto src = _mm_loadu_si128(
+                    reinterpret_cast< const __m128i* >( taps[ k ] + x ) );
+
+                sum0 = _mm_add_epi16(
+                    sum0, _mm_mullo_epi16( _mm_unpacklo_epi8( src, zero ),
+                                           coefficients[ k ] ) );
+                sum1 = _mm_add_epi16(
+                    sum1, _mm_mullo_epi16( _mm_unpackhi_epi8( src, zero ),
+                                           coefficients[ k ] ) );
+            }
+
+            if ( kernel.multiplier16 != 0 )
+            {
+                sum0 = _mm_mulhi_epu16( sum0, multiplier );
+                sum1 = _mm_mulhi_epu16( sum1, multiplier );
+            }
+
+            // The quotients of non-negative kernels do not exceed 255
+            _mm_storeu_si128(
+                reinterpret_cast< __m128i* >( dstPtr + x ),
+                _mm_packus_epi16( _mm_srl_epi16( sum0, shift ),
+                                  _mm_srl_epi16( sum1, shift ) ) );
+        }
+    }
+    else
+    {
+        const auto multiplier =
+            _mm_set1_epi32( static_cast< int >( kernel.multiplier ) );
+        const auto shift = _mm_cvtsi32_si128( kernel.shift );
+
+        // The coefficient in the low and 0 in the high 16 bit of each lane
+        for ( size_t k = 0; k < size; k++ )
+        {
+            coefficients[ k ] = _mm_set1_epi32(
+                static_cast< uint16_t >( kernel.coefficients[ k ] ) );
+        }
+
+        for ( ; x + 8 <= count; x += 8 )
+        {
+            auto sum0 = zero;
+            auto sum1 = zero;
+
+            for ( size_t k = 0; k < size; k++ )
+            {
+                const auto src = _mm_unpacklo_epi8(
+                    _mm_loadl_epi64(
+                        reinterpret_cast< const __m128i* >( taps[ k ] + x ) ),
+                    zero );
+
+                sum0 = _mm_add_epi32(
+                    sum0, _mm_madd_epi16( _mm_unpacklo_epi16( src, zero ),
+                                          coefficients[ k ] ) );
+                sum1 = _mm_add_epi32(
+                    sum1, _mm_madd_epi16( _mm_unpackhi_epi16( src, zero ),
+                                          coefficients[ k ] ) );
+            }
+
+            const auto result = _mm_packs_epi32(
+                divideSSE2( sum0, multiplier, shift ),
+                divideSSE2( sum1, multiplier, shift ) );
+
+            _mm_storel_epi64( reinterpret_cast< __m128i* >( dstPtr + x ),
+                              _mm_packus_epi16( result, result ) );
+        }
+    }
+
+    return x;
+}
+
+//
+// AVX2
+//
+// The pack instructions work on 128 bit lanes, so the packed results need to
+// be reordered.
+//
+
+CVL_TARGET_AVX2
+__m256i divideAVX2( __m256i sum, __m256i multiplier, __m128i shift )
+{
+    // Negative sums saturate to 0
+    sum = _mm256_max_epi32( sum, _mm256_setzero_si256( ) );
+
+    const auto even =
+        _mm256_srl_epi64( _mm256_mul_epu32( sum, multiplier ), shift );
+    const auto odd = _mm256_srl_epi64(
+        _mm256_mul_epu32( _mm256_srli_epi64( sum, 32 ), multiplier ), shift );
+
+    return _mm256_blend_epi32( even, _mm256_slli_epi64( odd, 32 ), 0xAA );
+}
+
+template < int32_t Size >
+CVL_TARGET_AVX2 int32_t filterTapsAVX2( const uint8_t* const* taps,
+                                        uint8_t* dstPtr, int32_t x,
+                                        int32_t count,
+                                        const FixedPointKernel& kernel )
+{
+    const auto zero = _mm256_setzero_si256( );
+    const auto size = static_cast< size_t >( Size > 0 ? Size : kernel.size );
+
+    __m256i coefficients[ FixedPointKernel::max_size ];
+
+    if ( kernel.narrow )
+    {
+        const auto multiplier =
+            _mm256_set1_epi16( static_cast< short >( kernel.multiplier16 ) );
+        const auto shift = _mm_cvtsi32_si128( kernel.shift16 );
+
+        for ( size_t k = 0; k < size; k++ )
+        {
+            coefficients[ k ] = _mm256_set1_epi16( kernel.coefficients[ k ] );
+        }
+
+        for ( ; x + 32 <= count; x += 32 )
+        {
+            auto sum0 = zero;
+            auto sum1 = zero;
+
+            for ( size_t k = 0; k < size; k++ )
+            {
+                const auto* src = taps[ k ] + x;
+
+                const auto src0 = _mm256_cvtepu8_epi16( _mm_loadu_si128(
+                    reinterpret_cast< const __m128i* >( src ) ) );
+                const auto src1 = _mm256_cvtepu8_epi16( _mm_loadu_si128(
+                    reinterpret_cast< const __m128i* >( src + 16 ) ) );
+
+                sum0 = _mm256_add_epi16(
+                    sum0, _mm256_mullo_epi16( src0, coefficients[ k ] ) );
+                sum1 = _mm256_add_epi16(
+                    sum1, _mm256_mullo_epi16( src1, coefficients[ k ] ) );
+            }
+
+            if ( kernel.multiplier16 != 0 )
+            {
+                sum0 = _mm256_mulhi_epu16( sum0, multiplier );
+                sum1 = _mm256_mulhi_epu16( sum1, multiplier );
+            }
+
+            // Packing yields the 64 bit blocks 0, 2, 1, 3
+            const auto result = _mm256_permute4x64_epi64(
+                _mm256_packus_epi16( _mm256_srl_epi16( sum0, shift ),
+                                     _mm256_srl_epi16( sum1, shift ) ),
+                0xD8 );
+
+            _mm256_storeu_si256( reinterpret_cast< __m256i* >( dstPtr + x ),
+                                 result );
+        }
+    }
+    else
+    {
+        const auto multiplier =
+            _mm256_set1_epi32( static_cast< int >( kernel.multiplier ) );
+        const auto shift = _mm_cvtsi32_si128( kernel.shift );
+
+        for ( size_t k = 0; k < size; k++ )
+        {
+            coefficients[ k ] = _mm256_set1_epi32( kernel.coefficients[ k ] );
+        }
+
+        for ( ; x + 16 <= count; x += 16 )
+        {
+            auto sum0 = zero;
+            auto sum1 = zero;
+
+            for ( size_t k = 0; k < size; k++ )
+            {
+                const auto* src = taps[ k ] + x;
+
+                const auto src0 = _mm256_cvtepu8_epi32( _mm_loadl_epi64(
+                    reinterpret_cast< const __m128i* >( src ) ) );
+                const auto src1 = _mm256_cvtepu8_epi32( _mm_loadl_epi64(
+                    reinterpret_cast< const __m128i* >( src + 8 ) ) );
+
+                sum0 = _mm256_add_epi32(
+                    sum0, _mm256_mullo_epi32( src0, coefficients[ k ] ) );
+                sum1 = _mm256_add_epi32(
+                    sum1, _mm256_mullo_epi32( src1, coefficients[ k ] ) );
+            }
+
+            // Packing yields the 64 bit blocks 0, 2, 1, 3
+            const auto result = _mm256_permute4x64_epi64(
+                _mm256_packs_epi32( divideAVX2( sum0, multiplier, shift ),
+                                    divideAVX2( sum1, multiplier, shift ) ),
+                0xD8 );
+
+            _mm_storeu_si128(
+                reinterpret_cast< __m128i* >( dstPtr + x ),
+                _mm_packus_epi16( _mm256_castsi256_si128( result ),
+                                  _mm256_extracti128_si256( result, 1 ) ) );
+        }
+    }
+
+    return x;
+}
+
+#endif
+
+/*
+ * Function that filters with the widest instruction set of the level first
+ * and hands the rest over to the narrower ones and finally to the scalar
+ * implementation.
+ */
+template < int32_t Size >
+void filterTaps( const uint8_t* const* taps, uint8_t* dstPtr, int32_t count,
+                 const FixedPointKernel& kernel,
+                 [[maybe_unused]] core::SimdLevel level )
+{
+    int32_t x = 0;
+
+#if CVL_ARCH_X86
+    switch ( level )
+    {
+    case core::SimdLevel::AVX512:
+    case core::SimdLevel::AVX2:
+        // There is no AVX-512 kernel yet, AVX2 is the widest
+        x = filterTapsAVX2< Size >( taps, dstPtr, x, count, kernel );
+        [[fallthrough]];
+    case core::SimdLevel::SSE2:
+        x = filterTapsSSE2< Size >( taps, dstPtr, x, count, kernel );
+        break;
+    case core::SimdLevel::Scalar:
+        break;
+    }
+#endif
+
+    if ( x == count )
+    {
+        return;
+    }
+
+    std::array< const uint8_t*, FixedPointKernel::max_size > rest;
+
+    for ( size_t k = 0; k < static_cast< size_t >( kernel.size ); k++ )
+    {
+        rest[ k ] = taps[ k ] + x;
+    }
+
+    filterColumnFixedPointScalar(
+        rest.data( ), dstPtr + x, count - x, kernel );
+}
+
+void dispatchTaps( const uint8_t* const* taps, uint8_t* dstPtr, int32_t count,
+                   const FixedPointKernel& kernel, core::SimdLevel level )
+{
+    EXPECT_MSG( core::isSimdLevelSupported( level ),
+                "SIMD level " << level << " is not supported by the CPU" );
+
+    // The common small kernels are unrolled
+    switch ( kernel.size )
+    {
+    case 3:
+        filterTaps< 3 >( taps, dstPtr, count, kernel, level );
+        break;
+    case 5:
+        filterTaps< 5 >( taps, dstPtr, count, kernel, level );
+        break;
+    case 7:
+        filterTaps< 7 >( taps, dstPtr, count, kernel, level );
+        break;
+    default:
+        filterTaps< 0 >( taps, dstPtr, count, kernel, level );
+        break;
+    }
+}
+
+#if CVL_ARCH_X86
+
+//
+// Box filter
+//
+// The running sums are 32 bit, the quotients are computed with the
+// reciprocal like in the wide path of the kernels above.
+//
+
+CVL_TARGET_SSE2
+int32_t slideBoxColumnSSE2( int32_t* sums, const uint8_t* addRow,
+                            const uint8_t* subRow, uint8_t* dstPtr,
+                            int32_t count, const FixedPointDivisor& divisor )
+{
+    const auto zero = _mm_setzero_si128( );
+    const auto multiplier =
+        _mm_set1_epi32( static_cast< int >( divisor.multiplier ) );
+    const auto shift = _mm_cvtsi32_si128( divisor.shift );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= count; x += 16 )
+    {
+        const auto add = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( addRow + x ) );
+        const auto sub = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( subRow + x ) );
+
+        // The differences of the rows fit into 16 bit
+        const auto delta0 = _mm_sub_epi16( _mm_unpacklo_epi8( add, zero ),
+                                           _mm_unpacklo_epi8( sub, zero ) );
+        const auto delta1 = _mm_sub_epi16( _mm_unpackhi_epi8( add, zero ),
+                                           _mm_unpackhi_epi8( sub, zero ) );
+
+        const __m128i delta[ 4 ] = {
+            _mm_srai_epi32( _mm_unpacklo_epi16( delta0, delta0 ), 16 ),
+            _mm_srai_epi32( _mm_unpackhi_epi16( delta0, delta0 ), 16 ),
+            _mm_srai_epi32( _mm_unpacklo_epi16( delta1, delta1 ), 16 ),
+            _mm_srai_epi32( _mm_unpackhi_epi16( delta1, delta1 ), 16 ) };
+
+        __m128i quotient[ 4 ];
+
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            auto* sumPtr = reinterpret_cast< __m128i* >( sums + x + 4 * i );
+            const auto sum =
+                _mm_add_epi32( _mm_loadu_si128( sumPtr ), delta[ i ] );
+
+            _mm_storeu_si128( sumPtr, sum );
+            quotient[ i ] = divideSSE2( sum, multiplier, shift );
+        }
+
+        const auto result0 = _mm_packs_epi32( quotient[ 0 ], quotient[ 1 ] );
+        const auto result1 = _mm_packs_epi32( quotient[ 2 ], quotient[ 3 ] );
+
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dstPtr + x ),
+                          _mm_packus_epi16( result0, result1 ) );
+    }
+
+    return x;
+}
+
+CVL_TARGET_SSE2
+int32_t differenceBoxRowSSE2( const int32_t* prefix, uint8_t* dstPtr,
+                              int32_t count, int32_t distance,
+                              const FixedPointDivisor& divisor )
+{
+    const auto multiplier =
+        _mm_set1_epi32( static_cast< int >( divisor.multiplier ) );
+    const auto shift = _mm_cvtsi32_si128( divisor.shift );
+
+    int32_t x = 0;
+
+    for ( ; x + 8 <= count; x += 8 )
+    {
+        const auto* lower = reinterpret_cast< const __m128i* >( prefix + x );
+        const auto* upper =
+            reinterpret_cast< const __m128i* >( prefix + x + distance );
+
+        const auto sum0 = _mm_sub_epi32( _mm_loadu_si128( upper ),
+                                         _mm_loadu_si128( lower ) );
+        const auto sum1 = _mm_sub_epi32( _mm_loadu_si128( upper + 1 ),
+                                         _mm_loadu_si128( lower + 1 ) );
+
+        const auto result =
+            _mm_packs_epi32( divideSSE2( sum0, multiplier, shift ),
+                             divideSSE2( sum1, multiplier, shift ) );
+
+        _mm_storel_epi64( reinterpret_cast< __m128i* >( dstPtr + x ),
+                          _mm_packus_epi16( result, result ) );
+    }
+
+    return x;
+}
+
+CVL_TARGET_AVX2
+int32_t slideBoxColumnAVX2( int32_t* sums, const uint8_t* addRow,
+                            const uint8_t* subRow, uint8_t* dstPtr,
+                            int32_t count, const FixedPointDivisor& divisor )
+{
+    const auto multiplier =
+        _mm256_set1_epi32( static_cast< int >( divisor.multiplier ) );
+    const auto shift = _mm_cvtsi32_si128( divisor.shift );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= count; x += 16 )
+    {
+        __m256i quotient[ 2 ];
+
+        for ( int32_t i = 0; i < 2; i++ )
+        {
+            const auto offset = x + 8 * i;
+            const auto add = _mm256_cvtepu8_epi32( _mm_loadl_epi64(
+                reinterpret_cast< const __m128i* >( addRow + offset ) ) );
+            const auto sub = _mm256_cvtepu8_epi32( _mm_loadl_epi64(
+                reinterpret_cast< const __m128i* >( subRow + offset ) ) );
+
+            auto* sumPtr = reinterpret_cast< __m256i* >( sums + offset );
+            const auto sum = _mm256_add_epi32( _mm256_loadu_si256( sumPtr ),
+                                               _mm256_sub_epi32( add, sub ) );
+
+            _mm256_storeu_si256( sumPtr, sum );
+            quotient[ i ] = divideAVX2( sum, multiplier, shift );
+        }
+
+        // Packing yields the 64 bit blocks 0, 2, 1, 3
+        const auto result = _mm256_permute4x64_epi64(
+            _mm256_packs_epi32( quotient[ 0 ], quotient[ 1 ] ), 0xD8 );
+
+        _mm_storeu_si128(
+            reinterpret_cast< __m128i* >( dstPtr + x ),
+            _mm_packus_epi16( _mm256_castsi256_si128( result ),
+                              _mm256_extracti128_si256( result, 1 ) ) );
+    }
+
+    return x;
+}
+
+CVL_TARGET_AVX2
+int32_t differenceBoxRowAVX2( const int32_t* prefix, uint8_t* dstPtr,
+                              int32_t count, int32_t distance,
+                              const FixedPointDivisor& divisor )
+{
+    const auto multiplier =
+        _mm256_set1_epi32( static_cast< int >( divisor.multiplier ) );
+    const auto shift = _mm_cvtsi32_si128( divisor.shift );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= count; x += 16 )
+    {
+        const auto* lower = reinterpret_cast< const __m256i* >( prefix + x );
+        const auto* upper =
+            reinterpret_cast< const __m256i* >( prefix + x + distance );
+
+        const auto sum0 = _mm256_sub_epi32( _mm256_loadu_si256( upper ),
+                                            _mm256_loadu_si256( lower ) );
+        const auto sum1 = _mm256_sub_epi32( _mm256_loadu_si256( upper + 1 ),
+                                            _mm256_loadu_si256( lower + 1 ) );
+
+        // Packing yields the 64 bit blocks 0, 2, 1, 3
+        const auto result = _mm256_permute4x64_epi64(
+            _mm256_packs_epi32( divideAVX2( sum0, multiplier, shift ),
+                                divideAVX2( sum1, multiplier, shift ) ),
+            0xD8 );
+
+        _mm_storeu_si128(
+            reinterpret_cast< __m128i* >( dstPtr + x ),
+            _mm_packus_epi16( _mm256_castsi256_si128( result ),
+                              _mm256_extracti128_si256( result, 1 ) ) );
+    }
+
+    return x;
+}
+
+#endif
+} // namespace
+
+void filterRowFixedPoint( const uint8_t* srcPtr, uint8_t* dstPtr,
+                          int32_t count, int32_t tapStep,
+                          const FixedPointKernel& kernel,
+                          core::SimdLevel level )
+{
+    const auto anchor = kernel.size / 2;
+
+    std::array< const uint8_t*, FixedPointKernel::max_size > taps;
+
+    for ( int32_t k = 0; k < kernel.size; k++ )
+    {
+        taps[ static_cast< size_t >( k ) ] =
+            srcPtr + ( k - anchor ) * tapStep;
+    }
+
+    dispatchTaps( taps.data( ), dstPtr, count, kernel, level );
+}
+
+void filterColumnFixedPoint( const uint8_t* const* rows, uint8_t* dstPtr,
+                             int32_t count, const FixedPointKernel& kernel,
+                             core::SimdLevel level )
+{
+    dispatchTaps( rows, dstPtr, count, kernel, level );
+}
+
+void slideBoxColumn( int32_t* sums, const uint8_t* addRow,
+                     const uint8_t* subRow, uint8_t* dstPtr, int32_t count,
+                     const FixedPointDivisor& divisor, core::SimdLevel level )
+{
+    EXPECT_MSG( core::isSimdLevelSupported( level ),
+                "SIMD level " << level << " is not supported by the CPU" );
+
+    int32_t x = 0;
+
+#if CVL_ARCH_X86
+    switch ( level )
+    {
+    case core::SimdLevel::AVX512:
+    case core::SimdLevel::AVX2:
+        x = slideBoxColumnAVX2( sums, addRow, subRow, dstPtr, count, divisor );
+        break;
+    case core::SimdLevel::SSE2:
+        x = slideBoxColumnSSE2( sums, addRow, subRow, dstPtr, count, divisor );
+        break;
+    case core::SimdLevel::Scalar:
+        break;
+    }
+#endif
+
+    slideBoxColumnScalar(
+        sums + x, addRow + x, subRow + x, dstPtr + x, count - x, divisor );
+}
+
+void differenceBoxRow( const int32_t* prefix, uint8_t* dstPtr, int32_t count,
+                       int32_t distance, const FixedPointDivisor& divisor,
+                       core::SimdLevel level )
+{
+    EXPECT_MSG( core::isSimdLevelSupported( level ),
+                "SIMD level " << level << " is not supported by the CPU" );
+
+    int32_t x = 0;
+
+#if CVL_ARCH_X86
+    switch ( level )
+    {
+    case core::SimdLevel::AVX512:
+    case core::SimdLevel::AVX2:
+        x = differenceBoxRowAVX2( prefix, dstPtr, count, distance, divisor );
+        break;
+    case core::SimdLevel::SSE2:
+        x = differenceBoxRowSSE2( prefix, dstPtr, count, distance, divisor );
+        break;
+    case core::SimdLevel::Scalar:
+        break;
+    }
+#endif
+
+    differenceBoxRowScalar(
+        prefix + x, dstPtr + x, count - x, distance, divisor );
+}
+
+} // namespace cvl::processing::detail
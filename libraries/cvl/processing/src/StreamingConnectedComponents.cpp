@@ -0,0 +1,281 @@
+// Own includes
+#include <cvl/processing/StreamingConnectedComponents.h>
+
+// STD includes
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace cvl::processing
+{
+
+StreamingConnectedComponents::StreamingConnectedComponents(
+    int32_t width, bool createMasks /*= false*/ )
+    : mWidth( width )
+    , mCreateMasks( createMasks )
+{
+    EXPECT_MSG( width > 0, "Invalid stream width(" << width << ")" );
+}
+
+void StreamingConnectedComponents::pushRow(
+    const uint8_t* rowPtr, std::vector< StreamBlob >& blobsOut )
+{
+    const auto row = mRowCount++;
+
+    // Extract the foreground runs of the row
+    mCurrentRuns.clear( );
+
+    int32_t x = 0;
+    while ( x < mWidth )
+    {
+        if ( rowPtr[ x ] == 0 )
+        {
+            x++;
+            continue;
+        }
+
+        const auto colStart = x;
+
+        while ( x < mWidth && rowPtr[ x ] != 0 )
+        {
+            x++;
+        }
+
+        mCurrentRuns.push_back( { colStart, x - 1, -1 } );
+    }
+
+    // Connect the runs to the components of the previous row. Components are
+    // always united under the smaller id, so the older component survives.
+    const auto numberPrevious = static_cast< int32_t >( mComponents.size( ) );
+
+    mParent.resize( mComponents.size( ) );
+    for ( int32_t i = 0; i < numberPrevious; i++ )
+    {
+        mParent[ static_cast< size_t >( i ) ] = i;
+    }
+
+    size_t candidate = 0;
+
+    for ( auto& run : mCurrentRuns )
+    {
+        while ( candidate < mPreviousRuns.size( ) &&
+                mPreviousRuns[ candidate ].colEnd < run.colStart - 1 )
+        {
+            candidate++;
+        }
+
+        int32_t component = -1;
+
+        for ( auto j = candidate; j < mPreviousRuns.size( ) &&
+                                  mPreviousRuns[ j ].colStart <= run.colEnd + 1;
+              j++ )
+        {
+            const auto root = find( mPreviousRuns[ j ].component );
+
+            if ( component == -1 )
+            {
+                component = root;
+            }
+            else if ( root != component )
+            {
+                const auto [ lower, upper ] = std::minmax( root, component );
+
+                mParent[ static_cast< size_t >( upper ) ] = lower;
+                component = lower;
+            }
+        }
+
+        if ( component == -1 )
+        {
+            component = static_cast< int32_t >( mComponents.size( ) );
+
+            mComponents.push_back( { row, Blob( ), { } } );
+            mParent.push_back( component );
+        }
+
+        run.component = component;
+    }
+
+    // Merge the data of united components into their root
+    for ( int32_t i = 0; i < numberPrevious; i++ )
+    {
+        const auto root = find( i );
+
+        if ( root != i )
+        {
+            mergeComponents( mComponents[ static_cast< size_t >( root ) ],
+                             mComponents[ static_cast< size_t >( i ) ] );
+        }
+    }
+
+    // Add the runs to their components and assign compact ids in the order
+    // of appearance in the row
+    mCompactIds.assign( mComponents.size( ), -1 );
+    int32_t numberNext = 0;
+
+    for ( auto& run : mCurrentRuns )
+    {
+        const auto root = static_cast< size_t >( find( run.component ) );
+        auto& component = mComponents[ root ];
+        const auto y = static_cast< int32_t >( row - component.originRow );
+
+        if ( component.blob.area == 0 )
+        {
+            component.blob = Blob( run.colStart, y, 1 );
+
+            if ( run.colEnd > run.colStart )
+            {
+                component.blob.addRun( run.colStart + 1, run.colEnd, y );
+            }
+        }
+        else
+        {
+            component.blob.addRun( run.colStart, run.colEnd, y );
+        }
+
+        if ( mCreateMasks )
+        {
+            component.runs.push_back( { y, run.colStart, run.colEnd } );
+        }
+
+        if ( mCompactIds[ root ] == -1 )
+        {
+            mCompactIds[ root ] = numberNext++;
+        }
+
+        run.component = mCompactIds[ root ];
+    }
+
+    // Components of the previous row that are not continued are complete
+    for ( int32_t i = 0; i < numberPrevious; i++ )
+    {
+        const auto index = static_cast< size_t >( i );
+
+        if ( mParent[ index ] == i && mCompactIds[ index ] == -1 )
+        {
+            emit( mComponents[ index ], blobsOut );
+        }
+    }
+
+    mNextComponents.resize( static_cast< size_t >( numberNext ) );
+
+    for ( size_t i = 0; i < mComponents.size( ); i++ )
+    {
+        if ( mCompactIds[ i ] != -1 )
+        {
+            mNextComponents[ static_cast< size_t >( mCompactIds[ i ] ) ] =
+                std::move( mComponents[ i ] );
+        }
+    }
+
+    std::swap( mComponents, mNextComponents );
+    std::swap( mPreviousRuns, mCurrentRuns );
+}
+
+void StreamingConnectedComponents::finish( std::vector< StreamBlob >& blobsOut )
+{
+    for ( auto& component : mComponents )
+    {
+        emit( component, blobsOut );
+    }
+
+    mComponents.clear( );
+    mPreviousRuns.clear( );
+}
+
+int32_t StreamingConnectedComponents::getWidth( ) const
+{
+    return mWidth;
+}
+
+int64_t StreamingConnectedComponents::getRowCount( ) const
+{
+    return mRowCount;
+}
+
+size_t StreamingConnectedComponents::getNumberActiveComponents( ) const
+{
+    return mComponents.size( );
+}
+
+int32_t StreamingConnectedComponents::find( int32_t component )
+{
+    auto* parent = mParent.data( );
+
+    while ( parent[ component ] != component )
+    {
+        parent[ component ] = parent[ parent[ component ] ];
+        component = parent[ component ];
+    }
+
+    return component;
+}
+
+void StreamingConnectedComponents::mergeComponents( Component& target,
+                                                    Component& source ) const
+{
+    // Move both components to the smaller origin row
+    const auto originRow = std::min( target.originRow, source.originRow );
+
+    const auto shiftComponent = [ originRow ]( Component& component )
+    {
+        const auto dy =
+            static_cast< int32_t >( component.originRow - originRow );
+
+        if ( dy == 0 )
+        {
+            return;
+        }
+
+        component.blob.shift( 0, dy );
+        component.originRow = originRow;
+
+        for ( auto& run : component.runs )
+        {
+            run.row += dy;
+        }
+    };
+
+    shiftComponent( target );
+    shiftComponent( source );
+
+    target.blob.merge( source.blob );
+
+    if ( mCreateMasks )
+    {
+        std::vector< core::Run > runs;
+        runs.reserve( target.runs.size( ) + source.runs.size( ) );
+
+        std::merge( target.runs.begin( ),
+                    target.runs.end( ),
+                    source.runs.begin( ),
+                    source.runs.end( ),
+                    std::back_inserter( runs ),
+                    []( const core::Run& lhs, const core::Run& rhs )
+                    {
+                        return lhs.row < rhs.row ||
+                               ( lhs.row == rhs.row &&
+                                 lhs.colStart < rhs.colStart );
+                    } );
+
+        target.runs = std::move( runs );
+        source.runs.clear( );
+    }
+}
+
+void StreamingConnectedComponents::emit( Component& component,
+                                         std::vector< StreamBlob >& blobsOut )
+{
+    auto mask = mCreateMasks
+                    ? core::RegionRLE(
+                          core::SizeI( mWidth, component.blob.bottom + 1 ),
+                          std::move( component.runs ) )
+                    : core::RegionRLE( );
+
+    blobsOut.push_back( { component.originRow,
+                          ++mNumberBlobs,
+                          component.blob,
+                          std::move( mask ) } );
+}
+
+} // namespace cvl::processing
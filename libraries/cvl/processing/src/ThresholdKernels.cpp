@@ -0,0 +1,330 @@
+// Own includes
+#include <cvl/processing/ThresholdKernels.h>
+
+// CVL includes
+#include <cvl/core/macros.h>
+
+#if CVL_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace cvl::processing::detail
+{
+namespace
+{
+#if CVL_ARCH_X86
+
+//
+// SSE2
+//
+// SSE2 and AVX2 only provide signed integer comparisons. Flipping the sign bit
+// of both operands maps the unsigned order onto the signed order.
+//
+
+CVL_TARGET_SSE2
+void thresholdRowSSE2( const uint8_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                       uint8_t threshold, uint8_t maxValue )
+{
+    const auto bias = _mm_set1_epi8( static_cast< char >( 0x80 ) );
+    const auto thr = _mm_set1_epi8(
+        static_cast< char >( static_cast< uint8_t >( threshold ^ 0x80U ) ) );
+    const auto max = _mm_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto src = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtr + x ) );
+        const auto mask = _mm_cmpgt_epi8( _mm_xor_si128( src, bias ), thr );
+
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dstPtr + x ),
+                          _mm_and_si128( mask, max ) );
+    }
+
+    thresholdRowScalar(
+        srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+CVL_TARGET_SSE2
+void thresholdRowSSE2( const uint16_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                       uint16_t threshold, uint8_t maxValue )
+{
+    const auto bias = _mm_set1_epi16( static_cast< short >( 0x8000 ) );
+    const auto thr = _mm_set1_epi16( static_cast< short >(
+        static_cast< uint16_t >( threshold ^ 0x8000U ) ) );
+    const auto max = _mm_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto src0 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtr + x ) );
+        const auto src1 = _mm_loadu_si128(
+            reinterpret_cast< const __m128i* >( srcPtr + x + 8 ) );
+        const auto mask0 = _mm_cmpgt_epi16( _mm_xor_si128( src0, bias ), thr );
+        const auto mask1 = _mm_cmpgt_epi16( _mm_xor_si128( src1, bias ), thr );
+
+        // Saturation keeps the masks 0x00 and 0xFF
+        const auto mask = _mm_packs_epi16( mask0, mask1 );
+
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dstPtr + x ),
+                          _mm_and_si128( mask, max ) );
+    }
+
+    thresholdRowScalar(
+        srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+CVL_TARGET_SSE2
+void thresholdRowSSE2( const float* srcPtr, uint8_t* dstPtr, int32_t width,
+                       float threshold, uint8_t maxValue )
+{
+    const auto thr = _mm_set1_ps( threshold );
+    const auto max = _mm_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto mask0 = _mm_castps_si128(
+            _mm_cmpgt_ps( _mm_loadu_ps( srcPtr + x ), thr ) );
+        const auto mask1 = _mm_castps_si128(
+            _mm_cmpgt_ps( _mm_loadu_ps( srcPtr + x + 4 ), thr ) );
+        const auto mask2 = _mm_castps_si128(
+            _mm_cmpgt_ps( _mm_loadu_ps( srcPtr + x + 8 ), thr ) );
+        const auto mask3 = _mm_castps_si128(
+            _mm_cmpgt_ps( _mm_loadu_ps( srcPtr + x + 12 ), thr ) );
+
+        const auto mask = _mm_packs_epi16( _mm_packs_epi32( mask0, mask1 ),
+                                           _mm_packs_epi32( mask2, mask3 ) );
+
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dstPtr + x ),
+                          _mm_and_si128( mask, max ) );
+    }
+
+    thresholdRowScalar(
+        srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+//
+// AVX2
+//
+// The pack instructions work on 128 bit lanes, so the packed masks need to be
+// reordered.
+//
+
+CVL_TARGET_AVX2
+void thresholdRowAVX2( const uint8_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                       uint8_t threshold, uint8_t maxValue )
+{
+    const auto bias = _mm256_set1_epi8( static_cast< char >( 0x80 ) );
+    const auto thr = _mm256_set1_epi8(
+        static_cast< char >( static_cast< uint8_t >( threshold ^ 0x80U ) ) );
+    const auto max = _mm256_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 32 <= width; x += 32 )
+    {
+        const auto src = _mm256_loadu_si256(
+            reinterpret_cast< const __m256i* >( srcPtr + x ) );
+        const auto mask =
+            _mm256_cmpgt_epi8( _mm256_xor_si256( src, bias ), thr );
+
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( dstPtr + x ),
+                             _mm256_and_si256( mask, max ) );
+    }
+
+    thresholdRowSSE2( srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+CVL_TARGET_AVX2
+void thresholdRowAVX2( const uint16_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                       uint16_t threshold, uint8_t maxValue )
+{
+    const auto bias = _mm256_set1_epi16( static_cast< short >( 0x8000 ) );
+    const auto thr = _mm256_set1_epi16( static_cast< short >(
+        static_cast< uint16_t >( threshold ^ 0x8000U ) ) );
+    const auto max = _mm256_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 32 <= width; x += 32 )
+    {
+        const auto src0 = _mm256_loadu_si256(
+            reinterpret_cast< const __m256i* >( srcPtr + x ) );
+        const auto src1 = _mm256_loadu_si256(
+            reinterpret_cast< const __m256i* >( srcPtr + x + 16 ) );
+        const auto mask0 =
+            _mm256_cmpgt_epi16( _mm256_xor_si256( src0, bias ), thr );
+        const auto mask1 =
+            _mm256_cmpgt_epi16( _mm256_xor_si256( src1, bias ), thr );
+
+        // Packing yields the 64 bit blocks 0, 2, 1, 3
+        const auto mask = _mm256_permute4x64_epi64(
+            _mm256_packs_epi16( mask0, mask1 ), 0xD8 );
+
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( dstPtr + x ),
+                             _mm256_and_si256( mask, max ) );
+    }
+
+    thresholdRowSSE2( srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+CVL_TARGET_AVX2
+void thresholdRowAVX2( const float* srcPtr, uint8_t* dstPtr, int32_t width,
+                       float threshold, uint8_t maxValue )
+{
+    const auto thr = _mm256_set1_ps( threshold );
+    const auto max = _mm256_set1_epi8( static_cast< char >( maxValue ) );
+
+    // Packing yields the 32 bit blocks 0, 2, 4, 6, 1, 3, 5, 7
+    const auto order = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+
+    int32_t x = 0;
+
+    for ( ; x + 32 <= width; x += 32 )
+    {
+        const auto mask0 = _mm256_castps_si256( _mm256_cmp_ps(
+            _mm256_loadu_ps( srcPtr + x ), thr, _CMP_GT_OQ ) );
+        const auto mask1 = _mm256_castps_si256( _mm256_cmp_ps(
+            _mm256_loadu_ps( srcPtr + x + 8 ), thr, _CMP_GT_OQ ) );
+        const auto mask2 = _mm256_castps_si256( _mm256_cmp_ps(
+            _mm256_loadu_ps( srcPtr + x + 16 ), thr, _CMP_GT_OQ ) );
+        const auto mask3 = _mm256_castps_si256( _mm256_cmp_ps(
+            _mm256_loadu_ps( srcPtr + x + 24 ), thr, _CMP_GT_OQ ) );
+
+        const auto mask = _mm256_permutevar8x32_epi32(
+            _mm256_packs_epi16( _mm256_packs_epi32( mask0, mask1 ),
+                                _mm256_packs_epi32( mask2, mask3 ) ),
+            order );
+
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( dstPtr + x ),
+                             _mm256_and_si256( mask, max ) );
+    }
+
+    thresholdRowSSE2( srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+//
+// AVX-512
+//
+// AVX-512 provides unsigned comparisons into mask registers. The masks select
+// the foreground value directly.
+//
+
+CVL_TARGET_AVX512
+void thresholdRowAVX512( const uint8_t* srcPtr, uint8_t* dstPtr,
+                         int32_t width, uint8_t threshold, uint8_t maxValue )
+{
+    const auto thr = _mm512_set1_epi8( static_cast< char >( threshold ) );
+    const auto max = _mm512_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 64 <= width; x += 64 )
+    {
+        const auto mask =
+            _mm512_cmpgt_epu8_mask( _mm512_loadu_si512( srcPtr + x ), thr );
+
+        _mm512_storeu_si512( dstPtr + x, _mm512_maskz_mov_epi8( mask, max ) );
+    }
+
+    thresholdRowAVX2( srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+CVL_TARGET_AVX512
+void thresholdRowAVX512( const uint16_t* srcPtr, uint8_t* dstPtr,
+                         int32_t width, uint16_t threshold, uint8_t maxValue )
+{
+    const auto thr = _mm512_set1_epi16( static_cast< short >( threshold ) );
+    const auto max = _mm256_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 32 <= width; x += 32 )
+    {
+        const auto mask =
+            _mm512_cmpgt_epu16_mask( _mm512_loadu_si512( srcPtr + x ), thr );
+
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( dstPtr + x ),
+                             _mm256_maskz_mov_epi8( mask, max ) );
+    }
+
+    thresholdRowAVX2( srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+CVL_TARGET_AVX512
+void thresholdRowAVX512( const float* srcPtr, uint8_t* dstPtr, int32_t width,
+                         float threshold, uint8_t maxValue )
+{
+    const auto thr = _mm512_set1_ps( threshold );
+    const auto max = _mm_set1_epi8( static_cast< char >( maxValue ) );
+
+    int32_t x = 0;
+
+    for ( ; x + 16 <= width; x += 16 )
+    {
+        const auto mask = _mm512_cmp_ps_mask(
+            _mm512_loadu_ps( srcPtr + x ), thr, _CMP_GT_OQ );
+
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( dstPtr + x ),
+                          _mm_maskz_mov_epi8( mask, max ) );
+    }
+
+    thresholdRowAVX2( srcPtr + x, dstPtr + x, width - x, threshold, maxValue );
+}
+
+#endif
+
+template < typename PixelType >
+void dispatchThresholdRow( const PixelType* srcPtr, uint8_t* dstPtr,
+                           int32_t width, PixelType threshold,
+                           uint8_t maxValue, core::SimdLevel level )
+{
+    EXPECT_MSG( core::isSimdLevelSupported( level ),
+                "SIMD level " << level << " is not supported by the CPU" );
+
+#if CVL_ARCH_X86
+    switch ( level )
+    {
+    case core::SimdLevel::AVX512:
+        thresholdRowAVX512( srcPtr, dstPtr, width, threshold, maxValue );
+        return;
+    case core::SimdLevel::AVX2:
+        thresholdRowAVX2( srcPtr, dstPtr, width, threshold, maxValue );
+        return;
+    case core::SimdLevel::SSE2:
+        thresholdRowSSE2( srcPtr, dstPtr, width, threshold, maxValue );
+        return;
+    case core::SimdLevel::Scalar:
+        break;
+    }
+#endif
+
+    thresholdRowScalar( srcPtr, dstPtr, width, threshold, maxValue );
+}
+} // namespace
+
+void thresholdRow( const uint8_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                   uint8_t threshold, uint8_t maxValue, core::SimdLevel level )
+{
+    dispatchThresholdRow( srcPtr, dstPtr, width, threshold, maxValue, level );
+}
+
+void thresholdRow( const uint16_t* srcPtr, uint8_t* dstPtr, int32_t width,
+                   uint16_t threshold, uint8_t maxValue,
+                   core::SimdLevel level )
+{
+    dispatchThresholdRow( srcPtr, dstPtr, width, threshold, maxValue, level );
+}
+
+void thresholdRow( const float* srcPtr, uint8_t* dstPtr, int32_t width,
+                   float threshold, uint8_t maxValue, core::SimdLevel level )
+{
+    dispatchThresholdRow( srcPtr, dstPtr, width, threshold, maxValue, level );
+}
+
+} // namespace cvl::processing::detail
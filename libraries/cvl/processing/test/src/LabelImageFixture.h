@@ -0,0 +1,49 @@
+#pragma once
+
+// CVL includes
+#include <cvl/core/Image.h>
+
+// STD includes
+#include <cstdint>
+
+namespace cvl::processing::test
+{
+
+/**
+ * The size of the random binary images of the labeling tests. The number of
+ * provisional labels must fit into the label type.
+ */
+template < typename T >
+constexpr int32_t random_image_size = sizeof( T ) > 1 ? 128 : 16;
+
+/**
+ * Function that creates the label image of the region feature tests. Label 3
+ * is a 4x3 rectangle at (2, 1) and a single pixel at (7, 6), label 5 fills
+ * the rest of the first row.
+ *
+ * @return The 10x8 label image
+ */
+template < typename T >
+core::Image< T, 1 > getLabelImage( )
+{
+    core::Image< T, 1 > labelImage( 10, 8, true );
+
+    for ( int32_t y = 1; y < 4; y++ )
+    {
+        for ( int32_t x = 2; x < 6; x++ )
+        {
+            labelImage.at( y, x ) = T { 3 };
+        }
+    }
+
+    labelImage.at( 6, 7 ) = T { 3 };
+
+    for ( int32_t x = 0; x < 10; x++ )
+    {
+        labelImage.at( 0, x ) = T { 5 };
+    }
+
+    return labelImage;
+}
+
+} // namespace cvl::processing::test
@@ -16,6 +16,9 @@ IGNORE_WARNINGS_POP
 #include <cvl/core/Region.h>
 #include <cvl/processing/Area.h>
 
+// Test includes
+#include "LabelImageFixture.h"
+
 using namespace cvl::core;
 using namespace cvl::processing;
 using testing::Eq;
@@ -61,3 +64,29 @@ TYPED_TEST( TestCvlProcessingArea, ValueConstruct )
     EXPECT_EQ( region.getLabelNumber( ), randomLabel );
     EXPECT_EQ( region.getArea( ), randomArea );*/
 }
+
+TYPED_TEST( TestCvlProcessingArea, CalculateFromLabelImage )
+{
+    Region< TypeParam, AlignedAllocator< TypeParam >, Area > region(
+        test::getLabelImage< TypeParam >( ), 3 );
+
+    EXPECT_EQ( region.getArea( ), 13.0 );
+}
+
+TYPED_TEST( TestCvlProcessingArea, SetStatistics )
+{
+    Region< TypeParam, AlignedAllocator< TypeParam >, Area > region(
+        test::getLabelImage< TypeParam >( ), 3 );
+
+    // The statistics are taken as they are, the label image is not scanned
+    Blob blob( 0, 0, 3 );
+    blob.add( 1, 0 );
+
+    region.setStatistics( blob );
+
+    EXPECT_EQ( region.getArea( ), 2.0 );
+
+    // Copies keep the value
+    auto copy = region;
+    EXPECT_EQ( copy.getArea( ), 2.0 );
+}
@@ -16,6 +16,9 @@ IGNORE_WARNINGS_POP
 #include <cvl/core/Region.h>
 #include <cvl/processing/BoundingBox.h>
 
+// Test includes
+#include "LabelImageFixture.h"
+
 using namespace cvl::core;
 using namespace cvl::processing;
 using testing::Eq;
@@ -74,3 +77,34 @@ TYPED_TEST( TestCvlProcessingBoundingBox, ValueConstruct )
     //EXPECT_EQ( region.getLabelNumber( ), randomLabel );
     //EXPECT_EQ( region.getBoundingBox( ), randomRect );
 }
+
+TYPED_TEST( TestCvlProcessingBoundingBox, CalculateFromLabelImage )
+{
+    Region< TypeParam, AlignedAllocator< TypeParam >, BoundingBox > region(
+        test::getLabelImage< TypeParam >( ), 3 );
+
+    EXPECT_EQ( region.getBoundingBox( ),
+               Rectangle< float >( Point< float, 2 >( 2.0F, 1.0F ),
+                                   Size< float >( 6.0F, 6.0F ) ) );
+}
+
+TYPED_TEST( TestCvlProcessingBoundingBox, SetStatistics )
+{
+    Region< TypeParam, AlignedAllocator< TypeParam >, BoundingBox > region(
+        test::getLabelImage< TypeParam >( ), 3 );
+
+    // The statistics are taken as they are, the label image is not scanned
+    Blob blob( 0, 0, 3 );
+    blob.add( 1, 0 );
+
+    region.setStatistics( blob );
+
+    const auto boundingBox = Rectangle< float >(
+        Point< float, 2 >( 0.0F, 0.0F ), Size< float >( 2.0F, 1.0F ) );
+
+    EXPECT_EQ( region.getBoundingBox( ), boundingBox );
+
+    // Copies keep the value
+    auto copy = region;
+    EXPECT_EQ( copy.getBoundingBox( ), boundingBox );
+}
@@ -0,0 +1,316 @@
+// OWN includes
+#include <Processing.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <random>
+#include <vector>
+
+using namespace cvl::core;
+using namespace cvl::processing;
+
+namespace
+{
+/*
+ * Function that fills an image with random values
+ */
+template < int32_t Channels, ChannelLayout Layout >
+void fillRandom(
+    Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout >& image,
+    uint32_t seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    for ( int32_t c = 0; c < Channels; c++ )
+    {
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                image.at( y, x, c ) = static_cast< uint8_t >( dist( gen ) );
+            }
+        }
+    }
+}
+
+/*
+ * Function that filters vertically and then horizontally, the vertical
+ * quotients are truncated to 8 bit like in boxFilter
+ */
+template < int32_t Channels, ChannelLayout Layout >
+void boxFilterReference(
+    const Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout >&
+        imageIn,
+    Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout >& imageOut,
+    const SizeI& kernelSize, BorderType border )
+{
+    const auto width = imageIn.getWidth( );
+    const auto height = imageIn.getHeight( );
+    const auto anchorX = kernelSize.getWidth( ) / 2;
+    const auto anchorY = kernelSize.getHeight( ) / 2;
+
+    Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout > imageTmp(
+        width, height );
+
+    for ( int32_t c = 0; c < Channels; c++ )
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                int32_t sum { };
+
+                for ( int32_t k = -anchorY; k <= anchorY; k++ )
+                {
+                    sum += imageIn.at(
+                        getBorderIndex( y + k, height, border ), x, c );
+                }
+
+                imageTmp.at( y, x, c ) =
+                    static_cast< uint8_t >( sum / kernelSize.getHeight( ) );
+            }
+        }
+
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                int32_t sum { };
+
+                for ( int32_t k = -anchorX; k <= anchorX; k++ )
+                {
+                    sum += imageTmp.at(
+                        y, getBorderIndex( x + k, width, border ), c );
+                }
+
+                imageOut.at( y, x, c ) =
+                    static_cast< uint8_t >( sum / kernelSize.getWidth( ) );
+            }
+        }
+    }
+}
+} // namespace
+
+TEST( TestCvlProcessingBoxFilter, BorderIndex )
+{
+    static_assert( getBorderIndex( -1, 5, BorderType::Reflect101 ) == 1 );
+
+    EXPECT_EQ( getBorderIndex( 3, 5, BorderType::Replicate ), 3 );
+    EXPECT_EQ( getBorderIndex( -3, 5, BorderType::Replicate ), 0 );
+    EXPECT_EQ( getBorderIndex( 7, 5, BorderType::Replicate ), 4 );
+
+    EXPECT_EQ( getBorderIndex( -1, 5, BorderType::Reflect ), 0 );
+    EXPECT_EQ( getBorderIndex( -2, 5, BorderType::Reflect ), 1 );
+    EXPECT_EQ( getBorderIndex( 5, 5, BorderType::Reflect ), 4 );
+    EXPECT_EQ( getBorderIndex( 12, 5, BorderType::Reflect ), 2 );
+
+    EXPECT_EQ( getBorderIndex( -1, 5, BorderType::Reflect101 ), 1 );
+    EXPECT_EQ( getBorderIndex( 5, 5, BorderType::Reflect101 ), 3 );
+    EXPECT_EQ( getBorderIndex( -6, 5, BorderType::Reflect101 ), 2 );
+    EXPECT_EQ( getBorderIndex( -4, 1, BorderType::Reflect101 ), 0 );
+
+    EXPECT_EQ( getBorderIndex( -1, 5, BorderType::Wrap ), 4 );
+    EXPECT_EQ( getBorderIndex( 7, 5, BorderType::Wrap ), 2 );
+    EXPECT_EQ( getBorderIndex( -11, 5, BorderType::Wrap ), 4 );
+}
+
+TEST( TestCvlProcessingBoxFilter, KernelsMatchScalar )
+{
+    std::mt19937 gen( 11 );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    for ( const int32_t size : { 1, 3, 31, 255, 1023 } )
+    {
+        detail::FixedPointDivisor divisor;
+        ASSERT_TRUE(
+            detail::makeFixedPointDivisor( size, size * 255, divisor ) );
+
+        for ( const int32_t count : { 1, 7, 8, 15, 16, 17, 33, 64, 101 } )
+        {
+            std::vector< uint8_t > addRow( static_cast< size_t >( count ) );
+            std::vector< uint8_t > subRow( addRow.size( ) );
+            std::vector< int32_t > sums( addRow.size( ) );
+            std::vector< int32_t > prefix( addRow.size( ) + 1 );
+
+            for ( size_t i = 0; i < addRow.size( ); i++ )
+            {
+                // The sums always hold the rows that leave the box
+                subRow[ i ] = static_cast< uint8_t >( dist( gen ) );
+                addRow[ i ] = static_cast< uint8_t >( dist( gen ) );
+                sums[ i ] = subRow[ i ] + ( size - 1 ) * dist( gen );
+                prefix[ i + 1 ] = prefix[ i ] + size * dist( gen );
+            }
+
+            auto expectedSums = sums;
+            std::vector< uint8_t > expectedColumn( addRow.size( ) );
+            detail::slideBoxColumnScalar( expectedSums.data( ),
+                                          addRow.data( ),
+                                          subRow.data( ),
+                                          expectedColumn.data( ),
+                                          count,
+                                          divisor );
+
+            // The boxes of a distance of one element
+            std::vector< uint8_t > expectedRow( addRow.size( ) );
+            detail::differenceBoxRowScalar( prefix.data( ),
+                                            expectedRow.data( ),
+                                            count,
+                                            1,
+                                            divisor );
+
+            for ( const auto level :
+                  { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2,
+                    SimdLevel::AVX512 } )
+            {
+                if ( ! isSimdLevelSupported( level ) )
+                {
+                    continue;
+                }
+
+                auto resultSums = sums;
+                std::vector< uint8_t > resultColumn( addRow.size( ) );
+                detail::slideBoxColumn( resultSums.data( ),
+                                        addRow.data( ),
+                                        subRow.data( ),
+                                        resultColumn.data( ),
+                                        count,
+                                        divisor,
+                                        level );
+
+                EXPECT_EQ( resultSums, expectedSums )
+                    << "level: " << level << ", count: " << count;
+                EXPECT_EQ( resultColumn, expectedColumn )
+                    << "level: " << level << ", count: " << count;
+
+                std::vector< uint8_t > resultRow( addRow.size( ) );
+                detail::differenceBoxRow( prefix.data( ),
+                                          resultRow.data( ),
+                                          count,
+                                          1,
+                                          divisor,
+                                          level );
+
+                EXPECT_EQ( resultRow, expectedRow )
+                    << "level: " << level << ", count: " << count;
+            }
+        }
+    }
+}
+
+TEST( TestCvlProcessingBoxFilter, MatchesBoxBlur )
+{
+    Image< uint8_t, 1 > imageGray( 97, 61 );
+    Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+        imageColor( 97, 61 );
+
+    fillRandom( imageGray, 3 );
+    fillRandom( imageColor, 5 );
+
+    for ( const auto& kernelSize :
+          { SizeI( 3, 5 ), SizeI( 15, 15 ), SizeI( 31, 31 ), SizeI( 9, 41 ) } )
+    {
+        // boxBlur uses the separable filter for small kernels only
+        Image< uint8_t, 1 > imageGrayBox;
+        boxFilter( imageGray, imageGrayBox, kernelSize );
+
+        Image< uint8_t, 1 > imageGrayBlur;
+        filter2D( imageGray, imageGrayBlur, getBoxKernel( kernelSize ) );
+
+        EXPECT_EQ( imageGrayBox, imageGrayBlur ) << "kernel: " << kernelSize;
+
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+            imageColorBox;
+        boxFilter( imageColor, imageColorBox, kernelSize );
+
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+            imageColorBlur;
+        filter2D( imageColor, imageColorBlur, getBoxKernel( kernelSize ) );
+
+        EXPECT_EQ( imageColorBox, imageColorBlur )
+            << "kernel: " << kernelSize;
+
+        boxBlur( imageColor, imageColorBlur, kernelSize );
+
+        EXPECT_EQ( imageColorBox, imageColorBlur )
+            << "kernel: " << kernelSize;
+    }
+}
+
+TEST( TestCvlProcessingBoxFilter, BorderTypes )
+{
+    Image< uint8_t, 1 > imageGray( 41, 23 );
+    Image< uint8_t, 3 > imagePlanar( 7, 5 );
+
+    fillRandom( imageGray, 17 );
+    fillRandom( imagePlanar, 19 );
+
+    for ( const auto border :
+          { BorderType::Replicate, BorderType::Reflect, BorderType::Reflect101,
+            BorderType::Wrap } )
+    {
+        // Kernels larger than the image map the border repeatedly
+        for ( const auto& kernelSize :
+              { SizeI( 1, 1 ), SizeI( 5, 3 ), SizeI( 31, 31 ) } )
+        {
+            Image< uint8_t, 1 > imageGrayDst;
+            boxFilter( imageGray, imageGrayDst, kernelSize, border );
+
+            Image< uint8_t, 1 > imageGrayExpected( 41, 23 );
+            boxFilterReference(
+                imageGray, imageGrayExpected, kernelSize, border );
+
+            EXPECT_EQ( imageGrayDst, imageGrayExpected )
+                << "kernel: " << kernelSize;
+
+            Image< uint8_t, 3 > imagePlanarDst;
+            boxFilter( imagePlanar, imagePlanarDst, kernelSize, border );
+
+            Image< uint8_t, 3 > imagePlanarExpected( 7, 5 );
+            boxFilterReference(
+                imagePlanar, imagePlanarExpected, kernelSize, border );
+
+            EXPECT_EQ( imagePlanarDst, imagePlanarExpected )
+                << "kernel: " << kernelSize;
+        }
+    }
+}
+
+TEST( TestCvlProcessingBoxFilter, BoxBlurEmptyImage )
+{
+    const Image< uint8_t, 1 > imageIn;
+
+    // Small and large kernels behave the same on empty images
+    for ( const auto& kernelSize : { SizeI( 3, 3 ), SizeI( 31, 31 ) } )
+    {
+        Image< uint8_t, 1 > imageOut( 3, 3 );
+
+        EXPECT_NO_THROW( boxBlur( imageIn, imageOut, kernelSize ) )
+            << "kernel: " << kernelSize;
+        EXPECT_TRUE( imageOut.getSize( ) == imageIn.getSize( ) )
+            << "kernel: " << kernelSize;
+    }
+
+    Image< uint8_t, 1 > imageOut( 3, 3 );
+
+    EXPECT_NO_THROW( ( boxBlur< 31, 31 >( imageIn, imageOut ) ) );
+    EXPECT_TRUE( imageOut.getSize( ) == imageIn.getSize( ) );
+}
+
+TEST( TestCvlProcessingBoxFilter, InvalidArguments )
+{
+    Image< uint8_t, 1 > imageIn( 16, 16 );
+    Image< uint8_t, 1 > imageOut;
+
+    EXPECT_THROW( boxFilter( imageIn, imageOut, SizeI( 4, 3 ) ),
+                  std::exception );
+    EXPECT_THROW( boxFilter( imageIn, imageOut, SizeI( 3, -1 ) ),
+                  std::exception );
+    EXPECT_THROW( boxFilter( imageIn, imageIn, SizeI( 3, 3 ) ),
+                  std::exception );
+}
@@ -16,6 +16,9 @@ IGNORE_WARNINGS_POP
 #include <cvl/core/Region.h>
 #include <cvl/processing/Center.h>
 
+// Test includes
+#include "LabelImageFixture.h"
+
 using namespace cvl::core;
 using namespace cvl::processing;
 using testing::Eq;
@@ -71,3 +74,36 @@ TYPED_TEST( TestCvlProcessingCenter, ValueConstruct )
     //EXPECT_EQ( region.getLabelNumber( ), randomLabel );
     //EXPECT_EQ( region.getCenter( ), randomPoint );
 }
+
+TYPED_TEST( TestCvlProcessingCenter, CalculateFromLabelImage )
+{
+    Region< TypeParam, AlignedAllocator< TypeParam >, Center > region(
+        test::getLabelImage< TypeParam >( ), 3 );
+
+    // x: ( 3 * ( 2 + 3 + 4 + 5 ) + 7 ) / 13, y: ( 4 * ( 1 + 2 + 3 ) + 6 ) / 13
+    const auto center =
+        Point< float, 2 >( static_cast< float >( 49.0 / 13.0 ),
+                           static_cast< float >( 30.0 / 13.0 ) );
+
+    EXPECT_EQ( region.getCenter( ), center );
+}
+
+TYPED_TEST( TestCvlProcessingCenter, SetStatistics )
+{
+    Region< TypeParam, AlignedAllocator< TypeParam >, Center > region(
+        test::getLabelImage< TypeParam >( ), 3 );
+
+    // The statistics are taken as they are, the label image is not scanned
+    Blob blob( 0, 0, 3 );
+    blob.add( 1, 0 );
+
+    region.setStatistics( blob );
+
+    const auto center = Point< float, 2 >( 0.5F, 0.0F );
+
+    EXPECT_EQ( region.getCenter( ), center );
+
+    // Copies keep the value
+    auto copy = region;
+    EXPECT_EQ( copy.getCenter( ), center );
+}
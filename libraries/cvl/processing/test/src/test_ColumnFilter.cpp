@@ -0,0 +1,201 @@
+// OWN includes
+#include <Processing.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace cvl::core;
+using namespace cvl::processing;
+
+namespace
+{
+const std::vector< std::vector< int32_t > > testKernels {
+    { 41 },
+    { 1, 2, 1 },
+    { -1, 0, 1 },
+    { 1, 4, 6, 4, 1 },
+    { -1, -2, 0, 2, 1 },
+    { 1, 6, 15, 20, 15, 6, 1 },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 1000, -3000, 4001, 1000, 1000 } };
+
+/*
+ * Function that filters a column with mirrored borders and exact integer
+ * division
+ */
+template < int32_t Channels, ChannelLayout Layout >
+void filterColumnReference(
+    const Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout >&
+        imageIn,
+    Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout >& imageOut,
+    const std::vector< int32_t >& kernel )
+{
+    const auto height = imageIn.getHeight( );
+    const auto anchor = static_cast< int32_t >( kernel.size( ) / 2 );
+
+    int32_t divisor { };
+    for ( const auto coefficient : kernel )
+    {
+        divisor += coefficient;
+    }
+    divisor = divisor == 0 ? 1 : divisor;
+
+    for ( int32_t c = 0; c < Channels; c++ )
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t x = 0; x < imageIn.getWidth( ); x++ )
+            {
+                int32_t sum { };
+
+                for ( int32_t k = -anchor; k <= anchor; k++ )
+                {
+                    auto idx = std::abs( y + k );
+                    if ( idx > height - 1 )
+                    {
+                        idx = 2 * ( height - 1 ) - idx;
+                    }
+
+                    sum += imageIn.at( idx, x, c ) *
+                           kernel[ static_cast< size_t >( k + anchor ) ];
+                }
+
+                imageOut.at( y, x, c ) = static_cast< uint8_t >(
+                    std::clamp( sum / divisor, 0, 255 ) );
+            }
+        }
+    }
+}
+} // namespace
+
+TEST( TestCvlProcessingColumnFilter, FixedPointMatchesScalar )
+{
+    std::mt19937 gen( 42 );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    for ( const auto& kernel : testKernels )
+    {
+        detail::FixedPointKernel fixedPoint;
+        ASSERT_TRUE( detail::makeFixedPointKernel( kernel, fixedPoint ) );
+
+        for ( const int32_t count : { 1, 7, 8, 15, 16, 17, 33, 64, 101 } )
+        {
+            std::vector< std::vector< uint8_t > > rows( kernel.size( ) );
+            std::vector< const uint8_t* > rowPointers;
+
+            for ( auto& row : rows )
+            {
+                row.resize( static_cast< size_t >( count ) );
+
+                // Saturated input finds overflows of the accumulators
+                for ( auto& value : row )
+                {
+                    value = static_cast< uint8_t >(
+                        count % 2 == 0 ? 255 : dist( gen ) );
+                }
+
+                rowPointers.push_back( row.data( ) );
+            }
+
+            std::vector< uint8_t > expected( static_cast< size_t >( count ) );
+            detail::filterColumnFixedPointScalar(
+                rowPointers.data( ), expected.data( ), count, fixedPoint );
+
+            for ( const auto level : { SimdLevel::Scalar, SimdLevel::SSE2,
+                                       SimdLevel::AVX2, SimdLevel::AVX512 } )
+            {
+                if ( ! isSimdLevelSupported( level ) )
+                {
+                    continue;
+                }
+
+                std::vector< uint8_t > result( expected.size( ),
+                                               uint8_t { 1 } );
+                detail::filterColumnFixedPoint( rowPointers.data( ),
+                                                result.data( ),
+                                                count,
+                                                fixedPoint,
+                                                level );
+
+                EXPECT_EQ( result, expected )
+                    << "level: " << level << ", count: " << count
+                    << ", kernel size: " << kernel.size( );
+            }
+        }
+    }
+}
+
+TEST( TestCvlProcessingColumnFilter, StripWidth )
+{
+    for ( int32_t size = 1; size <= detail::FixedPointKernel::max_size;
+          size += 2 )
+    {
+        const auto width = detail::getColumnStripWidth( size, 1 );
+
+        EXPECT_EQ( width % 64, 0 );
+        EXPECT_GE( width, 64 );
+        EXPECT_LE( ( size + 1 ) * width,
+                   std::max( detail::column_filter_cache_size,
+                             ( size + 1 ) * 64 ) );
+    }
+}
+
+TEST( TestCvlProcessingColumnFilter, Filter1DMatchesReference )
+{
+    std::mt19937 gen( 7 );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    // Wider than a strip, so the strips and the tail of a row are covered
+    constexpr int32_t width = 2000;
+    constexpr int32_t height = 23;
+
+    Image< uint8_t, 1 > imageGray( width, height );
+    Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+        imageColor( width, height );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        for ( int32_t x = 0; x < width; x++ )
+        {
+            imageGray.at( y, x ) = static_cast< uint8_t >( dist( gen ) );
+
+            for ( int32_t c = 0; c < 3; c++ )
+            {
+                imageColor.at( y, x, c ) =
+                    static_cast< uint8_t >( dist( gen ) );
+            }
+        }
+    }
+
+    for ( const auto& kernel : testKernels )
+    {
+        Image< uint8_t, 1 > imageGrayDst;
+        filter1D< FilterDirection::Column >( imageGray, imageGrayDst, kernel );
+
+        Image< uint8_t, 1 > imageGrayExpected( width, height );
+        filterColumnReference( imageGray, imageGrayExpected, kernel );
+
+        EXPECT_EQ( imageGrayDst, imageGrayExpected )
+            << "kernel size: " << kernel.size( );
+
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+            imageColorDst;
+        filter1D< FilterDirection::Column >(
+            imageColor, imageColorDst, kernel );
+
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+            imageColorExpected( width, height );
+        filterColumnReference( imageColor, imageColorExpected, kernel );
+
+        EXPECT_EQ( imageColorDst, imageColorExpected )
+            << "kernel size: " << kernel.size( );
+    }
+}
@@ -11,7 +11,12 @@ IGNORE_WARNINGS_POP
 
 // STD includes
 #include <list>
+#include <queue>
 #include <random>
+#include <type_traits>
+
+// Test includes
+#include "LabelImageFixture.h"
 
 using namespace cvl::core;
 using namespace cvl::processing;
@@ -27,6 +32,8 @@ public:
 
     CVL_DEFAULT_ONLY( TestCvlProcessingConnectedComponents );
 
+    static constexpr int32_t size = test::random_image_size< T >;
+
     Image< T, 1 > getGrayWedgeImage( )
     {
         Image< T, 1 > imageGrayWedge( 256, 256 );
@@ -53,6 +60,94 @@ public:
 
         return dist( gen );
     }
+
+    static Image< uint8_t, 1 > getRandomBinaryImage( int32_t width,
+                                                      int32_t height,
+                                                      double density,
+                                                      uint32_t seed )
+    {
+        std::mt19937 gen( seed );
+        std::bernoulli_distribution dist( density );
+
+        Image< uint8_t, 1 > image( width, height, true );
+
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                image.at( y, x ) = dist( gen ) ? uint8_t { 0xFF } : uint8_t { };
+            }
+        }
+
+        return image;
+    }
+
+    // Reference labeling using a flood fill. Labels are assigned in raster
+    // scan order of the first pixel of each region.
+    static Image< int32_t, 1 >
+    getReferenceLabels( const Image< uint8_t, 1 >& image,
+                        int32_t& numberLabels,
+                        Connectivity connectivity = Connectivity::Eight )
+    {
+        const auto width = image.getWidth( );
+        const auto height = image.getHeight( );
+
+        Image< int32_t, 1 > labels( width, height, true );
+        numberLabels = 0;
+
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                if ( image.at( y, x ) == 0 || labels.at( y, x ) != 0 )
+                {
+                    continue;
+                }
+
+                ++numberLabels;
+
+                std::queue< std::pair< int32_t, int32_t > > queue;
+                queue.emplace( x, y );
+                labels.at( y, x ) = numberLabels;
+
+                while ( ! queue.empty( ) )
+                {
+                    const auto [ px, py ] = queue.front( );
+                    queue.pop( );
+
+                    for ( int32_t dy = -1; dy <= 1; dy++ )
+                    {
+                        for ( int32_t dx = -1; dx <= 1; dx++ )
+                        {
+                            const auto nx = px + dx;
+                            const auto ny = py + dy;
+
+                            if ( nx < 0 || ny < 0 || nx >= width ||
+                                 ny >= height )
+                            {
+                                continue;
+                            }
+
+                            if ( connectivity == Connectivity::Four &&
+                                 dx != 0 && dy != 0 )
+                            {
+                                continue;
+                            }
+
+                            if ( image.at( ny, nx ) != 0 &&
+                                 labels.at( ny, nx ) == 0 )
+                            {
+                                labels.at( ny, nx ) = numberLabels;
+                                queue.emplace( nx, ny );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        return labels;
+    }
 };
 
 using Types = testing::Types< uint8_t, int16_t, uint16_t /*, float, double */ >;
@@ -122,6 +217,24 @@ TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectedComponentsImage )
             image, labelImage );
 
     EXPECT_EQ( regions.size( ), 2 );
+
+    int32_t numberLabels { };
+    const auto labelsCmp = this->getReferenceLabels( image, numberLabels );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        for ( int32_t x = 0; x < width; x++ )
+        {
+            EXPECT_EQ( static_cast< int32_t >( labelImage.at( y, x ) ),
+                       labelsCmp.at( y, x ) );
+        }
+    }
+
+    for ( size_t i = 0; i < regions.size( ); i++ )
+    {
+        EXPECT_EQ( regions[ i ]->getLabelNumber( ),
+                   static_cast< int32_t >( i ) + 1 );
+    }
 }
 
 TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionFilledRect )
@@ -174,4 +287,520 @@ TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionFilledRect )
      EXPECT_EQ( regions[ 0 ]->getCenter( ), cmpCenter );
 
      EXPECT_EQ( regions[ 0 ]->getArea( ), 24 );*/
-}
\ No newline at end of file
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionComb )
+{
+    // Vertical bars that are only connected by the last row. Every bar gets
+    // its own provisional label which needs to be merged.
+    //
+    // 1 0 1 0 1 0 1 ...
+    // 1 0 1 0 1 0 1 ...
+    // 1 1 1 1 1 1 1 ...
+
+    constexpr auto width = 64;
+    constexpr auto height = 8;
+
+    Image< uint8_t, 1 > image( width, height, true );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        for ( int32_t x = 0; x < width; x++ )
+        {
+            if ( x % 2 == 0 || y == height - 1 )
+            {
+                image.at( y, x ) = 0xFF;
+            }
+        }
+    }
+
+    Image< TypeParam, 1 > labelImage;
+
+    const auto regions =
+        cvl::processing::connectedComponents< TypeParam >( image, labelImage );
+
+    ASSERT_EQ( regions.size( ), 1 );
+    EXPECT_EQ( regions[ 0 ]->getLabelNumber( ), 1 );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        for ( int32_t x = 0; x < width; x++ )
+        {
+            const auto expected =
+                image.at( y, x ) != 0 ? TypeParam { 1 } : TypeParam { 0 };
+
+            EXPECT_EQ( labelImage.at( y, x ), expected );
+        }
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionSpeckles )
+{
+    // Isolated pixels on every second row and column
+    constexpr auto width = 30;
+    constexpr auto height = 30;
+
+    Image< uint8_t, 1 > image( width, height, true );
+
+    for ( int32_t y = 0; y < height; y += 2 )
+    {
+        for ( int32_t x = 0; x < width; x += 2 )
+        {
+            image.at( y, x ) = 0xFF;
+        }
+    }
+
+    Image< TypeParam, 1 > labelImage( width, height, true );
+
+    const auto regions =
+        cvl::processing::connectedComponents< TypeParam >( image, labelImage );
+
+    EXPECT_EQ( regions.size( ), ( width / 2 ) * ( height / 2 ) );
+
+    // Labels are assigned in raster scan order
+    int32_t expectedLabel { };
+    for ( int32_t y = 0; y < height; y += 2 )
+    {
+        for ( int32_t x = 0; x < width; x += 2 )
+        {
+            EXPECT_EQ( static_cast< int32_t >( labelImage.at( y, x ) ),
+                       ++expectedLabel );
+        }
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionRandom )
+{
+    constexpr auto size = TestFixture::size;
+
+    for ( uint32_t seed = 0; seed < 8; seed++ )
+    {
+        const auto density = 0.2 + 0.1 * seed;
+        const auto image =
+            this->getRandomBinaryImage( size, size + 3, density, seed );
+
+        // Label image is not initialized and needs to be overwritten
+        Image< TypeParam, 1 > labelImage(
+            image.getSize( ), std::numeric_limits< TypeParam >::max( ) );
+
+        const auto regions = cvl::processing::connectedComponents< TypeParam >(
+            image, labelImage );
+
+        int32_t numberLabels { };
+        const auto labelsCmp =
+            this->getReferenceLabels( image, numberLabels );
+
+        EXPECT_EQ( regions.size( ), static_cast< size_t >( numberLabels ) );
+
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                ASSERT_EQ( static_cast< int32_t >( labelImage.at( y, x ) ),
+                           labelsCmp.at( y, x ) );
+            }
+        }
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionLabelOverflow )
+{
+    // 32 * 32 isolated pixels exceed the range of an 8 bit label image
+    constexpr auto width = 64;
+    constexpr auto height = 64;
+
+    Image< uint8_t, 1 > image( width, height, true );
+
+    for ( int32_t y = 0; y < height; y += 2 )
+    {
+        for ( int32_t x = 0; x < width; x += 2 )
+        {
+            image.at( y, x ) = 0xFF;
+        }
+    }
+
+    Image< TypeParam, 1 > labelImage;
+
+    if constexpr ( sizeof( TypeParam ) == 1 )
+    {
+        EXPECT_THROW( cvl::processing::connectedComponents< TypeParam >(
+                          image, labelImage ),
+                      Error );
+    }
+    else
+    {
+        const auto regions = cvl::processing::connectedComponents< TypeParam >(
+            image, labelImage );
+
+        EXPECT_EQ( regions.size( ), ( width / 2 ) * ( height / 2 ) );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionRunLengthEncoded )
+{
+    for ( uint32_t seed = 0; seed < 8; seed++ )
+    {
+        const auto density = 0.2 + 0.1 * seed;
+        const auto image = this->getRandomBinaryImage( 97, 61, density, seed );
+
+        std::vector< RegionRLE > regions;
+        cvl::processing::connectedComponents( image, regions );
+
+        int32_t numberLabels { };
+        const auto labelsCmp =
+            this->getReferenceLabels( image, numberLabels );
+
+        ASSERT_EQ( regions.size( ), static_cast< size_t >( numberLabels ) );
+
+        int64_t area { };
+
+        for ( const auto& region : regions )
+        {
+            EXPECT_EQ( region.getImageSize( ), image.getSize( ) );
+
+            area += region.getArea( );
+        }
+
+        int64_t areaCmp { };
+
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                const auto label = labelsCmp.at( y, x );
+
+                if ( label != 0 )
+                {
+                    areaCmp++;
+
+                    ASSERT_TRUE( regions[ static_cast< size_t >( label - 1 ) ]
+                                     .contains( y, x ) );
+                }
+            }
+        }
+
+        EXPECT_EQ( area, areaCmp );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionParallel )
+{
+    constexpr auto size = TestFixture::size;
+
+    for ( uint32_t seed = 0; seed < 8; seed++ )
+    {
+        const auto density = 0.2 + 0.1 * seed;
+        const auto image =
+            this->getRandomBinaryImage( size + 5, size, density, seed );
+
+        Image< TypeParam, 1 > labelImage;
+        const auto regions = cvl::processing::connectedComponents< TypeParam >(
+            image, labelImage );
+
+        // More threads than rows fall back to one strip per row
+        for ( const auto numberThreads : { 1, 2, 3, 7, size + 1 } )
+        {
+            Image< TypeParam, 1 > labelImageParallel(
+                image.getSize( ), std::numeric_limits< TypeParam >::max( ) );
+
+            const auto regionsParallel =
+                cvl::processing::connectedComponentsParallel< TypeParam >(
+                    image, labelImageParallel, numberThreads );
+
+            ASSERT_EQ( regionsParallel.size( ), regions.size( ) );
+
+            for ( size_t i = 0; i < regions.size( ); i++ )
+            {
+                EXPECT_EQ( regionsParallel[ i ]->getLabelNumber( ),
+                           regions[ i ]->getLabelNumber( ) );
+            }
+
+            EXPECT_EQ( labelImageParallel, labelImage )
+                << "threads: " << numberThreads << ", seed: " << seed;
+        }
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionParallelMerge )
+{
+    // The bars are only connected in the last row, so labels of all strips
+    // are merged. The diagonal line is only 8 connected across the strip
+    // borders.
+    constexpr auto size = 41;
+
+    Image< uint8_t, 1 > image( size + size, size, true );
+
+    for ( int32_t y = 0; y < size; y++ )
+    {
+        for ( int32_t x = 0; x < size; x += 2 )
+        {
+            image.at( y, x ) = 0xFF;
+        }
+
+        image.at( size - 1, y ) = 0xFF;
+        image.at( y, size + 1 + y % ( size - 1 ) ) = 0xFF;
+    }
+
+    Image< TypeParam, 1 > labelImage;
+    const auto regions =
+        cvl::processing::connectedComponents< TypeParam >( image, labelImage );
+
+    ASSERT_EQ( regions.size( ), 3 );
+
+    for ( const auto numberThreads : { 2, 5, 13, size } )
+    {
+        Image< TypeParam, 1 > labelImageParallel;
+
+        const auto regionsParallel =
+            cvl::processing::connectedComponentsParallel< TypeParam >(
+                image, labelImageParallel, numberThreads );
+
+        EXPECT_EQ( regionsParallel.size( ), regions.size( ) );
+        EXPECT_EQ( labelImageParallel, labelImage );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionStatistics )
+{
+    constexpr auto size = TestFixture::size;
+
+    for ( uint32_t seed = 0; seed < 8; seed++ )
+    {
+        const auto density = 0.2 + 0.1 * seed;
+        const auto image =
+            this->getRandomBinaryImage( size + 7, size, density, seed );
+
+        const auto blobs = cvl::processing::connectedComponents( image );
+
+        Image< TypeParam, 1 > labelImage;
+        const auto regions = cvl::processing::connectedComponents< TypeParam >(
+            image, labelImage );
+
+        ASSERT_EQ( blobs.size( ), regions.size( ) );
+
+        // Reference statistics from the label image
+        std::vector< Blob > blobsCmp;
+
+        for ( int32_t y = 0; y < labelImage.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < labelImage.getWidth( ); x++ )
+            {
+                const auto label =
+                    static_cast< int32_t >( labelImage.at( y, x ) );
+
+                if ( label == 0 )
+                {
+                    continue;
+                }
+
+                if ( static_cast< size_t >( label ) > blobsCmp.size( ) )
+                {
+                    blobsCmp.emplace_back( x, y, label );
+                }
+                else
+                {
+                    blobsCmp[ static_cast< size_t >( label - 1 ) ].add( x, y );
+                }
+            }
+        }
+
+        ASSERT_EQ( blobs.size( ), blobsCmp.size( ) );
+
+        for ( size_t i = 0; i < blobs.size( ); i++ )
+        {
+            EXPECT_EQ( blobs[ i ].label, regions[ i ]->getLabelNumber( ) );
+            EXPECT_EQ( blobs[ i ].getArea( ), blobsCmp[ i ].getArea( ) );
+            EXPECT_EQ( blobs[ i ].getBoundingRect( ),
+                       blobsCmp[ i ].getBoundingRect( ) );
+            EXPECT_EQ( blobs[ i ].sumX, blobsCmp[ i ].sumX );
+            EXPECT_EQ( blobs[ i ].sumY, blobsCmp[ i ].sumY );
+        }
+    }
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionCheckerboard )
+{
+    // 8 connected the checkerboard is one region, 4 connected every pixel is
+    // a region
+    constexpr auto width = 11;
+    constexpr auto height = 7;
+
+    Image< uint8_t, 1 > image( width, height, true );
+
+    for ( int32_t y = 0; y < height; y++ )
+    {
+        for ( int32_t x = ( y % 2 ); x < width; x += 2 )
+        {
+            image.at( y, x ) = 0xFF;
+        }
+    }
+
+    constexpr auto numberPixels = ( width * height + 1 ) / 2;
+
+    Image< TypeParam, 1 > labelImage;
+
+    const auto regionsEight =
+        cvl::processing::connectedComponents< Connectivity::Eight,
+                                              TypeParam >( image, labelImage );
+
+    EXPECT_EQ( regionsEight.size( ), 1 );
+    EXPECT_EQ( labelImage.at( height - 1, width - 1 ), 1 );
+
+    const auto regionsFour =
+        cvl::processing::connectedComponents< Connectivity::Four, TypeParam >(
+            image, labelImage );
+
+    EXPECT_EQ( regionsFour.size( ), numberPixels );
+    EXPECT_EQ( static_cast< int32_t >(
+                   labelImage.at( height - 1, width - 1 ) ),
+               numberPixels );
+
+    EXPECT_EQ( cvl::processing::connectedComponents( image ).size( ), 1 );
+    EXPECT_EQ(
+        cvl::processing::connectedComponents< Connectivity::Four >( image )
+            .size( ),
+        numberPixels );
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionConnectivity )
+{
+    constexpr auto size = TestFixture::size / 2;
+
+    const auto checkConnectivity = [ this ]( auto connectivityTag )
+    {
+        constexpr auto connectivity = decltype( connectivityTag )::value;
+
+        // Odd sizes leave incomplete blocks at the right and bottom border
+        for ( uint32_t seed = 0; seed < 8; seed++ )
+        {
+            const auto density = 0.2 + 0.1 * seed;
+            const auto image = this->getRandomBinaryImage(
+                size + static_cast< int32_t >( seed ),
+                size + 3 - static_cast< int32_t >( seed ),
+                density,
+                seed );
+
+            Image< TypeParam, 1 > labelImage(
+                image.getSize( ), std::numeric_limits< TypeParam >::max( ) );
+
+            const auto regions =
+                cvl::processing::connectedComponents< connectivity,
+                                                      TypeParam >(
+                    image, labelImage );
+
+            int32_t numberLabels { };
+            const auto labelsCmp =
+                this->getReferenceLabels( image, numberLabels, connectivity );
+
+            ASSERT_EQ( regions.size( ),
+                       static_cast< size_t >( numberLabels ) );
+
+            for ( int32_t y = 0; y < image.getHeight( ); y++ )
+            {
+                for ( int32_t x = 0; x < image.getWidth( ); x++ )
+                {
+                    ASSERT_EQ( static_cast< int32_t >( labelImage.at( y, x ) ),
+                               labelsCmp.at( y, x ) )
+                        << "seed: " << seed;
+                }
+            }
+
+            for ( const auto numberThreads : { 2, 3, 7 } )
+            {
+                Image< TypeParam, 1 > labelImageParallel;
+
+                const auto regionsParallel =
+                    cvl::processing::connectedComponentsParallel<
+                        connectivity,
+                        TypeParam >( image, labelImageParallel, numberThreads );
+
+                EXPECT_EQ( regionsParallel.size( ), regions.size( ) );
+                EXPECT_EQ( labelImageParallel, labelImage )
+                    << "threads: " << numberThreads << ", seed: " << seed;
+            }
+
+            const auto blobs =
+                cvl::processing::connectedComponents< connectivity >( image );
+
+            ASSERT_EQ( blobs.size( ), regions.size( ) );
+
+            for ( size_t i = 0; i < blobs.size( ); i++ )
+            {
+                const auto label = static_cast< int32_t >( i ) + 1;
+
+                EXPECT_EQ( blobs[ i ].label, label );
+                EXPECT_EQ( labelsCmp.at( blobs[ i ].top,
+                                         blobs[ i ].firstColumn ),
+                           label );
+            }
+
+            std::vector< RegionRLE > regionsRLE;
+            cvl::processing::connectedComponents< connectivity >( image,
+                                                                  regionsRLE );
+
+            ASSERT_EQ( regionsRLE.size( ), regions.size( ) );
+
+            for ( size_t i = 0; i < regionsRLE.size( ); i++ )
+            {
+                EXPECT_EQ( regionsRLE[ i ].getArea( ), blobs[ i ].area );
+                EXPECT_EQ( regionsRLE[ i ].getBoundingBox( ),
+                           blobs[ i ].getBoundingRect( ) );
+            }
+        }
+    };
+
+    checkConnectivity(
+        std::integral_constant< Connectivity, Connectivity::Four > { } );
+    checkConnectivity(
+        std::integral_constant< Connectivity, Connectivity::Eight > { } );
+}
+
+TYPED_TEST( TestCvlProcessingConnectedComponents, ConnectionFeatures )
+{
+    constexpr auto size = TestFixture::size * 3 / 4;
+
+    const auto image = this->getRandomBinaryImage( size + 3, size, 0.4, 7 );
+
+    const auto blobs = cvl::processing::connectedComponents( image );
+
+    Image< TypeParam, 1 > labelImage;
+    const auto regions =
+        cvl::processing::connectedComponents< TypeParam,
+                                              AlignedAllocator< uint8_t >,
+                                              Area,
+                                              Center,
+                                              BoundingBox >( image,
+                                                             labelImage );
+
+    ASSERT_EQ( regions.size( ), blobs.size( ) );
+
+    // The features are set by the labeling, so they do not depend on the
+    // label image anymore
+    for ( int32_t y = 0; y < labelImage.getHeight( ); y++ )
+    {
+        std::fill_n( labelImage.getRowPointer( y ),
+                     labelImage.getWidth( ),
+                     TypeParam { 0 } );
+    }
+
+    for ( size_t i = 0; i < regions.size( ); i++ )
+    {
+        const auto& blob = blobs[ i ];
+        const auto center = blob.getCenter( );
+        const auto centerCmp =
+            Point< float, 2 >( static_cast< float >( center.getX( ) ),
+                               static_cast< float >( center.getY( ) ) );
+        const auto rect = blob.getBoundingRect( );
+
+        EXPECT_EQ( regions[ i ]->getArea( ), blob.area );
+        EXPECT_EQ( regions[ i ]->getCenter( ), centerCmp );
+        EXPECT_EQ( regions[ i ]->getBoundingBox( ),
+                   Rectangle< float >(
+                       Point< float, 2 >(
+                           static_cast< float >( rect.getLeft( ) ),
+                           static_cast< float >( rect.getTop( ) ) ),
+                       Size< float >(
+                           static_cast< float >( rect.getWidth( ) ),
+                           static_cast< float >( rect.getHeight( ) ) ) ) );
+    }
+}
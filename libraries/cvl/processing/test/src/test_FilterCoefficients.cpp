@@ -9,6 +9,9 @@ IGNORE_WARNINGS_GTEST_PUSH
 //  in C++20
 IGNORE_WARNINGS_POP
 
+// STD includes
+#include <array>
+
 using namespace cvl::processing;
 using namespace cvl::core;
 
@@ -338,4 +341,40 @@ TEST( TestCvlProcessingFilterCoefficients, PrewittKernelDy5x5 )
             EXPECT_EQ( prewittKernel[ y ][ x ], compare[ y ][ x ] );
         }
     }
-}
\ No newline at end of file
+}
+
+TEST( TestCvlProcessingFilterCoefficients, ConstexprKernels )
+{
+    static_assert( getBinomialKernel1D< 5 >( ) ==
+                   std::array< int32_t, 5 > { 1, 4, 6, 4, 1 } );
+    static_assert( getBoxKernel1D< 3 >( ) ==
+                   std::array< int32_t, 3 > { 1, 1, 1 } );
+    static_assert( isSeparableFilter( getBinomialKernel< 5, 3 >( ) ) );
+    static_assert( ! isSeparableFilter(
+        std::array< std::array< int32_t, 3 >, 3 > {
+            { { 0, 1, 0 }, { 1, -4, 1 }, { 0, 1, 0 } } } ) );
+
+    const auto compareKernels = [ ]( const auto& kernel, const auto& compare )
+    {
+        ASSERT_EQ( kernel.size( ), compare.size( ) );
+
+        for ( size_t y = 0; y < compare.size( ); y++ )
+        {
+            ASSERT_EQ( kernel[ y ].size( ), compare[ y ].size( ) );
+
+            for ( size_t x = 0; x < compare[ y ].size( ); x++ )
+            {
+                EXPECT_EQ( kernel[ y ][ x ], compare[ y ][ x ] );
+            }
+        }
+    };
+
+    compareKernels( getBinomialKernel< 3, 3 >( ),
+                    getBinomialKernel( { 3, 3 } ) );
+    compareKernels( getBinomialKernel< 7, 5 >( ),
+                    getBinomialKernel( { 7, 5 } ) );
+    compareKernels( getBinomialKernel< 13, 1 >( ),
+                    getBinomialKernel( { 13, 1 } ) );
+    compareKernels( getBoxKernel< 5, 5 >( ), getBoxKernel( { 5, 5 } ) );
+    compareKernels( getBoxKernel< 3, 9 >( ), getBoxKernel( { 3, 9 } ) );
+}
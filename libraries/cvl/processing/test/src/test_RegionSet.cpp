@@ -0,0 +1,295 @@
+// CVL includes
+#include <cvl/core/macros.h>
+#include <cvl/processing/ConnectedComponents.h>
+#include <cvl/processing/RegionSet.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <random>
+
+// Test includes
+#include "LabelImageFixture.h"
+
+using namespace cvl::core;
+using namespace cvl::processing;
+
+template < typename T >
+class TestCvlProcessingRegionSet : public testing::Test
+{
+public:
+    CVL_DEFAULT_ONLY( TestCvlProcessingRegionSet );
+
+    static constexpr int32_t size = test::random_image_size< T >;
+
+    static Image< uint8_t, 1 > getRandomBinaryImage( int32_t width,
+                                                      int32_t height,
+                                                      double density,
+                                                      uint32_t seed )
+    {
+        std::mt19937 gen( seed );
+        std::bernoulli_distribution dist( density );
+
+        Image< uint8_t, 1 > image( width, height, true );
+
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                image.at( y, x ) = dist( gen ) ? uint8_t { 0xFF } : uint8_t { };
+            }
+        }
+
+        return image;
+    }
+
+    static void expectEqual( const RegionSet< T >& regions,
+                             const std::vector< Blob >& blobs )
+    {
+        ASSERT_EQ( regions.size( ), blobs.size( ) );
+
+        for ( size_t i = 0; i < blobs.size( ); i++ )
+        {
+            const auto region = regions[ i ];
+            const auto center = blobs[ i ].getCenter( );
+
+            EXPECT_EQ( region.getLabelNumber( ), blobs[ i ].label );
+            EXPECT_EQ( region.getArea( ), blobs[ i ].getArea( ) );
+            EXPECT_EQ( region.getBoundingBox( ),
+                       blobs[ i ].getBoundingRect( ) );
+            EXPECT_DOUBLE_EQ( region.getCenter( ).getX( ), center.getX( ) );
+            EXPECT_DOUBLE_EQ( region.getCenter( ).getY( ), center.getY( ) );
+        }
+    }
+
+    static void expectEqual( const Image< T, 1 >& image,
+                             const Image< T, 1 >& imageCmp )
+    {
+        ASSERT_EQ( image.getSize( ), imageCmp.getSize( ) );
+
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                ASSERT_EQ( image.at( y, x ), imageCmp.at( y, x ) );
+            }
+        }
+    }
+};
+
+using Types = testing::Types< uint8_t, int16_t, uint16_t >;
+
+TYPED_TEST_SUITE(
+    TestCvlProcessingRegionSet,
+    Types ); // NOLINT(clang-diagnostic-gnu-zero-variadic-macro-arguments)
+
+TYPED_TEST( TestCvlProcessingRegionSet, Empty )
+{
+    const RegionSet< TypeParam > regions;
+
+    EXPECT_TRUE( regions.empty( ) );
+    EXPECT_EQ( regions.size( ), 0U );
+
+    const Image< uint8_t, 1 > image( 17, 9, true );
+    RegionSet< TypeParam > regionsBackground;
+
+    connectedComponents( image, regionsBackground );
+
+    EXPECT_TRUE( regionsBackground.empty( ) );
+    EXPECT_EQ( regionsBackground.getLabelImage( ).getSize( ),
+               image.getSize( ) );
+}
+
+TYPED_TEST( TestCvlProcessingRegionSet, Connection )
+{
+    constexpr auto size = TestFixture::size;
+
+    for ( uint32_t seed = 0; seed < 8; seed++ )
+    {
+        const auto image = this->getRandomBinaryImage(
+            size + 7, size, 0.2 + 0.1 * seed, seed );
+
+        RegionSet< TypeParam > regions;
+        connectedComponents( image, regions );
+
+        Image< TypeParam, 1 > labelImage;
+        const auto regionsCmp =
+            connectedComponents< TypeParam >( image, labelImage );
+
+        this->expectEqual( regions, connectedComponents( image ) );
+        this->expectEqual( regions.getLabelImage( ), labelImage );
+
+        ASSERT_EQ( regions.size( ), regionsCmp.size( ) );
+
+        for ( size_t i = 0; i < regions.size( ); i++ )
+        {
+            EXPECT_EQ( regions[ i ].getLabelNumber( ),
+                       regionsCmp[ i ]->getLabelNumber( ) );
+        }
+    }
+}
+
+TYPED_TEST( TestCvlProcessingRegionSet, ConnectionConnectivity )
+{
+    constexpr auto size = TestFixture::size;
+
+    const auto image = this->getRandomBinaryImage( size, size + 3, 0.4, 7 );
+
+    RegionSet< TypeParam > regions;
+    connectedComponents< Connectivity::Four >( image, regions );
+
+    Image< TypeParam, 1 > labelImage;
+    connectedComponents< Connectivity::Four, TypeParam >( image, labelImage );
+
+    this->expectEqual( regions,
+                       connectedComponents< Connectivity::Four >( image ) );
+    this->expectEqual( regions.getLabelImage( ), labelImage );
+}
+
+TYPED_TEST( TestCvlProcessingRegionSet, ConnectionParallel )
+{
+    constexpr auto size = TestFixture::size;
+
+    for ( int32_t threads = 1; threads <= 5; threads++ )
+    {
+        const auto image = this->getRandomBinaryImage(
+            size + 3, size, 0.5, static_cast< uint32_t >( threads ) );
+
+        RegionSet< TypeParam > regions;
+        connectedComponentsParallel( image, regions, threads );
+
+        RegionSet< TypeParam > regionsCmp;
+        connectedComponents( image, regionsCmp );
+
+        this->expectEqual( regions, connectedComponents( image ) );
+        this->expectEqual( regions.getLabelImage( ),
+                           regionsCmp.getLabelImage( ) );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingRegionSet, ReuseLabelImage )
+{
+    constexpr auto size = TestFixture::size;
+
+    const auto image = this->getRandomBinaryImage( size, size, 0.5, 1 );
+    const auto imageNext = this->getRandomBinaryImage( size, size, 0.3, 2 );
+
+    RegionSet< TypeParam > regions;
+    connectedComponents( image, regions );
+
+    const auto* data = regions.getLabelImage( ).getData( );
+
+    // Same size, the label image buffer is reused
+    connectedComponents( imageNext, regions );
+
+    EXPECT_EQ( regions.getLabelImage( ).getData( ), data );
+    this->expectEqual( regions, connectedComponents( imageNext ) );
+
+    // Different size, the label image is reallocated
+    const auto imageLarge =
+        this->getRandomBinaryImage( size + 1, size, 0.3, 3 );
+
+    connectedComponents( imageLarge, regions );
+
+    EXPECT_EQ( regions.getLabelImage( ).getSize( ), imageLarge.getSize( ) );
+    this->expectEqual( regions, connectedComponents( imageLarge ) );
+}
+
+TYPED_TEST( TestCvlProcessingRegionSet, Columns )
+{
+    constexpr auto size = TestFixture::size;
+
+    const auto image = this->getRandomBinaryImage( size, size, 0.4, 5 );
+
+    RegionSet< TypeParam > regions;
+    connectedComponents( image, regions );
+
+    ASSERT_EQ( regions.getAreas( ).size( ), regions.size( ) );
+    ASSERT_EQ( regions.getSumsX( ).size( ), regions.size( ) );
+
+    for ( size_t i = 0; i < regions.size( ); i++ )
+    {
+        const auto boundingBox = regions.getBoundingBox( i );
+
+        EXPECT_EQ( regions.getAreas( )[ i ], regions.getArea( i ) );
+        EXPECT_EQ( regions.getLefts( )[ i ], boundingBox.getLeft( ) );
+        EXPECT_EQ( regions.getTops( )[ i ], boundingBox.getTop( ) );
+        EXPECT_EQ( regions.getRights( )[ i ] - regions.getLefts( )[ i ] + 1,
+                   boundingBox.getWidth( ) );
+        EXPECT_EQ( regions.getBottoms( )[ i ] - regions.getTops( )[ i ] + 1,
+                   boundingBox.getHeight( ) );
+        EXPECT_DOUBLE_EQ( static_cast< double >( regions.getSumsY( )[ i ] ) /
+                              regions.getArea( i ),
+                          regions.getCenter( i ).getY( ) );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingRegionSet, ToRegions )
+{
+    constexpr auto size = TestFixture::size;
+
+    const auto image = this->getRandomBinaryImage( size, size, 0.4, 3 );
+
+    RegionSet< TypeParam > regionSet;
+    connectedComponents( image, regionSet );
+
+    const auto regions =
+        regionSet.template toRegions< Area, Center, BoundingBox >( );
+
+    ASSERT_EQ( regions.size( ), regionSet.size( ) );
+
+    for ( size_t i = 0; i < regions.size( ); i++ )
+    {
+        const auto& region = *regions[ i ];
+        const auto boundingBox = regionSet.getBoundingBox( i );
+        const auto center = regionSet.getCenter( i );
+
+        // The regions share the label image of the set
+        EXPECT_EQ( region.getLabelImage( ).getData( ),
+                   regionSet.getLabelImage( ).getData( ) );
+        EXPECT_EQ( region.getLabelNumber( ), regionSet.getLabelNumber( i ) );
+
+        EXPECT_DOUBLE_EQ( regions[ i ]->getArea( ), regionSet.getArea( i ) );
+        EXPECT_FLOAT_EQ( regions[ i ]->getCenter( ).getX( ),
+                         static_cast< float >( center.getX( ) ) );
+        EXPECT_FLOAT_EQ( regions[ i ]->getCenter( ).getY( ),
+                         static_cast< float >( center.getY( ) ) );
+        EXPECT_FLOAT_EQ( regions[ i ]->getBoundingBox( ).getWidth( ),
+                         static_cast< float >( boundingBox.getWidth( ) ) );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingRegionSet, RelabelAfterToRegions )
+{
+    constexpr auto size = TestFixture::size;
+
+    const auto image = this->getRandomBinaryImage( size, size, 0.4, 3 );
+    const auto imageNext = this->getRandomBinaryImage( size, size, 0.3, 4 );
+
+    RegionSet< TypeParam > regionSet;
+    connectedComponents( image, regionSet );
+
+    const auto labelImage = regionSet.getLabelImage( ).clone( );
+    const auto regions = regionSet.template toRegions< Area >( );
+
+    ASSERT_FALSE( regions.empty( ) );
+
+    // The regions keep their label image, the set gets a new one
+    connectedComponents( imageNext, regionSet );
+    connectedComponentsParallel( imageNext, regionSet, 4 );
+
+    EXPECT_NE( regions.front( )->getLabelImage( ).getData( ),
+               regionSet.getLabelImage( ).getData( ) );
+    EXPECT_EQ( regions.front( )->getLabelImage( ), labelImage );
+    this->expectEqual( regionSet, connectedComponents( imageNext ) );
+
+    // Without regions the new label image is reused again
+    const auto* data = regionSet.getLabelImage( ).getData( );
+
+    connectedComponents( image, regionSet );
+
+    EXPECT_EQ( regionSet.getLabelImage( ).getData( ), data );
+}
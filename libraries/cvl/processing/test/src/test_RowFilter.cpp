@@ -0,0 +1,238 @@
+// OWN includes
+#include <Processing.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace cvl::core;
+using namespace cvl::processing;
+
+namespace
+{
+const std::vector< std::vector< int32_t > > testKernels {
+    { 1 },
+    { 41 },
+    { 1, 1, 1 },
+    { 1, 2, 1 },
+    { 1, 4, 6, 4, 1 },
+    { 3, 7, 31, 7, 3 },
+    { -1, 0, 1 },
+    { 1, -2, 1 },
+    { -1, -2, 0, 2, 1 },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 1000, -3000, 4001, 1000, 1000 } };
+
+/*
+ * Function that filters a row with mirrored borders and exact integer
+ * division
+ */
+template < int32_t Channels, ChannelLayout Layout >
+void filterRowReference(
+    const Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout >&
+        imageIn,
+    Image< uint8_t, Channels, AlignedAllocator< uint8_t >, Layout >& imageOut,
+    const std::vector< int32_t >& kernel )
+{
+    const auto width = imageIn.getWidth( );
+    const auto anchor = static_cast< int32_t >( kernel.size( ) / 2 );
+
+    int32_t divisor { };
+    for ( const auto coefficient : kernel )
+    {
+        divisor += coefficient;
+    }
+    divisor = divisor == 0 ? 1 : divisor;
+
+    for ( int32_t c = 0; c < Channels; c++ )
+    {
+        for ( int32_t y = 0; y < imageIn.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                int32_t sum { };
+
+                for ( int32_t k = -anchor; k <= anchor; k++ )
+                {
+                    auto idx = std::abs( x + k );
+                    if ( idx > width - 1 )
+                    {
+                        idx = 2 * ( width - 1 ) - idx;
+                    }
+
+                    sum += imageIn.at( y, idx, c ) *
+                           kernel[ static_cast< size_t >( k + anchor ) ];
+                }
+
+                imageOut.at( y, x, c ) = static_cast< uint8_t >(
+                    std::clamp( sum / divisor, 0, 255 ) );
+            }
+        }
+    }
+}
+} // namespace
+
+TEST( TestCvlProcessingRowFilter, FixedPointMatchesScalar )
+{
+    std::mt19937 gen( 42 );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    for ( const auto& kernel : testKernels )
+    {
+        detail::FixedPointKernel fixedPoint;
+        ASSERT_TRUE( detail::makeFixedPointKernel( kernel, fixedPoint ) );
+
+        const auto anchor = static_cast< int32_t >( kernel.size( ) / 2 );
+
+        for ( const int32_t tapStep : { 1, 3 } )
+        {
+            for ( const int32_t count : { 1, 7, 8, 15, 16, 17, 33, 64, 101 } )
+            {
+                const auto border = static_cast< size_t >( anchor * tapStep );
+
+                std::vector< uint8_t > src( static_cast< size_t >( count ) +
+                                            2 * border );
+
+                // Saturated input finds overflows of the accumulators
+                for ( auto& value : src )
+                {
+                    value = static_cast< uint8_t >(
+                        count % 2 == 0 ? 255 : dist( gen ) );
+                }
+
+                std::vector< uint8_t > expected(
+                    static_cast< size_t >( count ) );
+                detail::filterRowFixedPointScalar( src.data( ) + border,
+                                                   expected.data( ),
+                                                   count,
+                                                   tapStep,
+                                                   fixedPoint );
+
+                for ( const auto level :
+                      { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2,
+                        SimdLevel::AVX512 } )
+                {
+                    if ( ! isSimdLevelSupported( level ) )
+                    {
+                        continue;
+                    }
+
+                    std::vector< uint8_t > result( expected.size( ),
+                                                   uint8_t { 1 } );
+                    detail::filterRowFixedPoint( src.data( ) + border,
+                                                 result.data( ),
+                                                 count,
+                                                 tapStep,
+                                                 fixedPoint,
+                                                 level );
+
+                    EXPECT_EQ( result, expected )
+                        << "level: " << level << ", count: " << count
+                        << ", kernel size: " << kernel.size( );
+                }
+            }
+        }
+    }
+}
+
+TEST( TestCvlProcessingRowFilter, FixedPointExactDivision )
+{
+    std::vector< uint8_t > src( 256 + 2 );
+
+    for ( size_t i = 0; i < src.size( ); i++ )
+    {
+        src[ i ] = static_cast< uint8_t >( i );
+    }
+
+    // Every divisor of the 16 and of the 32 bit path
+    for ( int32_t divisor = 3; divisor <= 4096; divisor++ )
+    {
+        detail::FixedPointKernel fixedPoint;
+        ASSERT_TRUE( detail::makeFixedPointKernel(
+            std::vector< int32_t > { 1, divisor - 2, 1 }, fixedPoint ) );
+
+        std::vector< uint8_t > expected( 256 );
+        detail::filterRowFixedPointScalar(
+            src.data( ) + 1, expected.data( ), 256, 1, fixedPoint );
+
+        std::vector< uint8_t > result( 256 );
+        detail::filterRowFixedPoint( src.data( ) + 1,
+                                     result.data( ),
+                                     256,
+                                     1,
+                                     fixedPoint,
+                                     getSimdLevel( ) );
+
+        ASSERT_EQ( result, expected ) << "divisor: " << divisor;
+    }
+}
+
+TEST( TestCvlProcessingRowFilter, FixedPointRejectedKernels )
+{
+    detail::FixedPointKernel fixedPoint;
+
+    EXPECT_FALSE( detail::makeFixedPointKernel(
+        std::vector< float > { 1.0f, 2.0f, 1.0f }, fixedPoint ) );
+    EXPECT_FALSE( detail::makeFixedPointKernel(
+        std::vector< int32_t > { 1, 1 }, fixedPoint ) );
+    EXPECT_FALSE( detail::makeFixedPointKernel(
+        std::vector< int32_t > { 1, 40000, 1 }, fixedPoint ) );
+    EXPECT_FALSE( detail::makeFixedPointKernel(
+        std::vector< int32_t > { 1, -5, 1 }, fixedPoint ) );
+    EXPECT_FALSE( detail::makeFixedPointKernel(
+        std::vector< int32_t >( 65, 1 ), fixedPoint ) );
+}
+
+TEST( TestCvlProcessingRowFilter, Filter1DMatchesReference )
+{
+    std::mt19937 gen( 7 );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    Image< uint8_t, 1 > imageGray( 77, 9 );
+    Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+        imageColor( 77, 9 );
+
+    for ( int32_t y = 0; y < imageGray.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < imageGray.getWidth( ); x++ )
+        {
+            imageGray.at( y, x ) = static_cast< uint8_t >( dist( gen ) );
+
+            for ( int32_t c = 0; c < 3; c++ )
+            {
+                imageColor.at( y, x, c ) =
+                    static_cast< uint8_t >( dist( gen ) );
+            }
+        }
+    }
+
+    for ( const auto& kernel : testKernels )
+    {
+        Image< uint8_t, 1 > imageGrayDst;
+        filter1D< FilterDirection::Row >( imageGray, imageGrayDst, kernel );
+
+        Image< uint8_t, 1 > imageGrayExpected( 77, 9 );
+        filterRowReference( imageGray, imageGrayExpected, kernel );
+
+        EXPECT_EQ( imageGrayDst, imageGrayExpected )
+            << "kernel size: " << kernel.size( );
+
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+            imageColorDst;
+        filter1D< FilterDirection::Row >( imageColor, imageColorDst, kernel );
+
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >
+            imageColorExpected( 77, 9 );
+        filterRowReference( imageColor, imageColorExpected, kernel );
+
+        EXPECT_EQ( imageColorDst, imageColorExpected )
+            << "kernel size: " << kernel.size( );
+    }
+}
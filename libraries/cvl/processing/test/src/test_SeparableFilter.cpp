@@ -0,0 +1,140 @@
+// OWN includes
+#include <Processing.h>
+#include <cvl/core/ScratchArena.h>
+#include <cvl/core/macros.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <random>
+#include <vector>
+
+using namespace cvl::core;
+using namespace cvl::processing;
+
+TEST( TestCvlProcessingSeparableFilter, MatchesFilter1D )
+{
+    Image< uint8_t, 1 > imageSrc( 40, 30 );
+
+    for ( int32_t y = 0; y < imageSrc.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < imageSrc.getWidth( ); x++ )
+        {
+            imageSrc.at( y, x ) = static_cast< uint8_t >( ( x * 7 + y * 13 ) );
+        }
+    }
+
+    const std::vector< int32_t > rowKernel { 1, 2, 1 };
+    const std::vector< int32_t > columnKernel { 1, 4, 6, 4, 1 };
+
+    Image< uint8_t, 1 > imageColumn;
+    filter1D< FilterDirection::Column >( imageSrc, imageColumn, rowKernel );
+
+    Image< uint8_t, 1 > imageExpected;
+    filter1D< FilterDirection::Row >(
+        imageColumn, imageExpected, columnKernel );
+
+    Image< uint8_t, 1 > imageDst;
+    separableFilter2D( imageSrc, imageDst, rowKernel, columnKernel );
+
+    EXPECT_EQ( imageDst, imageExpected );
+}
+
+TEST( TestCvlProcessingSeparableFilter, SteadyStateNoAllocation )
+{
+    const auto& arena = ScratchArena::getThreadArena( );
+
+    Image< uint8_t, 1 > imageSrc( 640, 480, uint8_t { 10 } );
+    Image< uint8_t, 1 > imageDst;
+
+    const auto kernel = getBinomialKernel( SizeI( 5, 5 ) );
+
+    // The first call allocates the output image and grows the arena
+    filter2D( imageSrc, imageDst, kernel );
+
+    const auto allocations = arena.getUpstreamAllocations( );
+    const auto* data = imageDst.getData( );
+
+    for ( int32_t i = 0; i < 10; i++ )
+    {
+        filter2D( imageSrc, imageDst, kernel );
+    }
+
+    EXPECT_EQ( arena.getUpstreamAllocations( ), allocations );
+    EXPECT_EQ( arena.getUsed( ), 0 );
+    EXPECT_EQ( imageDst.getData( ), data );
+    EXPECT_EQ( imageDst.at( 240, 320 ), 10 );
+}
+
+TEST( TestCvlProcessingSeparableFilter, FusedMatchesTwoPass )
+{
+    using ColorImage =
+        Image< uint8_t, 3, AlignedAllocator< uint8_t >, InterleavedLayout >;
+
+    std::mt19937 gen( 11 );
+    std::uniform_int_distribution< int32_t > dist( 0, 255 );
+
+    const std::vector< std::vector< int32_t > > kernels {
+        { 1, 2, 1 },
+        { -1, 0, 1 },
+        { 1, 4, 6, 4, 1 },
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        { 3, -7, 41, -7, 3 } };
+
+    for ( const auto& size : { SizeI( 97, 61 ), SizeI( 12, 11 ) } )
+    {
+        Image< uint8_t, 1 > imageGray( size );
+        ColorImage imageColor( size );
+
+        for ( int32_t y = 0; y < size.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < size.getWidth( ); x++ )
+            {
+                imageGray.at( y, x ) = static_cast< uint8_t >( dist( gen ) );
+
+                for ( int32_t c = 0; c < 3; c++ )
+                {
+                    imageColor.at( y, x, c ) =
+                        static_cast< uint8_t >( dist( gen ) );
+                }
+            }
+        }
+
+        for ( const auto& rowKernel : kernels )
+        {
+            for ( const auto& columnKernel : kernels )
+            {
+                Image< uint8_t, 1 > imageGrayColumn;
+                filter1D< FilterDirection::Column >(
+                    imageGray, imageGrayColumn, rowKernel );
+
+                Image< uint8_t, 1 > imageGrayExpected;
+                filter1D< FilterDirection::Row >(
+                    imageGrayColumn, imageGrayExpected, columnKernel );
+
+                Image< uint8_t, 1 > imageGrayDst;
+                separableFilter2D(
+                    imageGray, imageGrayDst, rowKernel, columnKernel );
+
+                EXPECT_EQ( imageGrayDst, imageGrayExpected );
+
+                ColorImage imageColorColumn;
+                filter1D< FilterDirection::Column >(
+                    imageColor, imageColorColumn, rowKernel );
+
+                ColorImage imageColorExpected;
+                filter1D< FilterDirection::Row >(
+                    imageColorColumn, imageColorExpected, columnKernel );
+
+                ColorImage imageColorDst;
+                separableFilter2D(
+                    imageColor, imageColorDst, rowKernel, columnKernel );
+
+                EXPECT_EQ( imageColorDst, imageColorExpected );
+            }
+        }
+    }
+}
@@ -1,5 +1,7 @@
 // OWN includes
 #include <Processing.h>
+#include <cvl/core/LayoutConversion.h>
+#include <cvl/core/StatsMemoryResource.h>
 #include <cvl/core/macros.h>
 
 // GTest includes
@@ -9,6 +11,12 @@ IGNORE_WARNINGS_GTEST_PUSH
 //  in C++20
 IGNORE_WARNINGS_POP
 
+// STD includes
+#include <array>
+#include <list>
+#include <memory_resource>
+#include <vector>
+
 //
 // Typed tests
 // https://google.github.io/googletest/advanced.html#typed-tests
@@ -451,4 +459,185 @@ TYPED_TEST( TestCvlProcessingSmoothing, BinomialBlurMultipleKernels256x256 )
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TYPED_TEST( TestCvlProcessingSmoothing, BinomialBlurInterleaved )
+{
+    using ImageInterleaved = Image< TypeParam, 3, AlignedAllocator< TypeParam >,
+                                    InterleavedLayout >;
+
+    constexpr int32_t height = 16;
+    constexpr int32_t width = 19;
+
+    Image< TypeParam, 3 > imageSrc( width, height );
+
+    for ( int32_t c = 0; c < 3; c++ )
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                const auto value = ( x * 7 + y * 13 + c * 50 ) % 97;
+
+                imageSrc.at( y, x, c ) = static_cast< TypeParam >( value );
+            }
+        }
+    }
+
+    for ( const auto& kernelSize : { SizeI( 3, 3 ), SizeI( 5, 5 ) } )
+    {
+        Image< TypeParam, 3 > imageDst;
+        binomialBlur( imageSrc, imageDst, kernelSize );
+
+        // The interleaved filter must produce the same pixels
+        ImageInterleaved imageSrcInterleaved;
+        interleave( imageSrc, imageSrcInterleaved );
+
+        ImageInterleaved imageDstInterleaved;
+        binomialBlur( imageSrcInterleaved, imageDstInterleaved, kernelSize );
+
+        Image< TypeParam, 3 > imageCmp;
+        deinterleave( imageDstInterleaved, imageCmp );
+
+        EXPECT_EQ( imageCmp, imageDst );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingSmoothing, Filter1DTiled )
+{
+    using TiledImageType =
+        TiledImage< TypeParam, 3, AlignedAllocator< TypeParam >, PlanarLayout,
+                    16 >;
+
+    constexpr int32_t height = 37;
+    constexpr int32_t width = 50;
+
+    Image< TypeParam, 3 > imageSrc( width, height );
+
+    for ( int32_t c = 0; c < 3; c++ )
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                const auto value = ( x * 7 + y * 13 + c * 50 ) % 97;
+
+                imageSrc.at( y, x, c ) = static_cast< TypeParam >( value );
+            }
+        }
+    }
+
+    TiledImageType imageSrcTiled;
+    toTiled( imageSrc, imageSrcTiled );
+
+    // The kernels reach into the adjacent tiles
+    for ( const auto& kernel : { std::vector< int32_t > { 1, 2, 1 },
+                                 std::vector< int32_t > { 1, 4, 6, 4, 1 } } )
+    {
+        Image< TypeParam, 3 > imageRow;
+        filter1D< FilterDirection::Row >( imageSrc, imageRow, kernel );
+
+        Image< TypeParam, 3 > imageColumn;
+        filter1D< FilterDirection::Column >( imageSrc, imageColumn, kernel );
+
+        TiledImageType imageRowTiled;
+        filter1D< FilterDirection::Row >(
+            imageSrcTiled, imageRowTiled, kernel );
+
+        TiledImageType imageColumnTiled;
+        filter1D< FilterDirection::Column >(
+            imageSrcTiled, imageColumnTiled, kernel );
+
+        Image< TypeParam, 3 > imageCmp;
+
+        toLinear( imageRowTiled, imageCmp );
+        EXPECT_EQ( imageCmp, imageRow );
+
+        toLinear( imageColumnTiled, imageCmp );
+        EXPECT_EQ( imageCmp, imageColumn );
+    }
+}
+
+TYPED_TEST( TestCvlProcessingSmoothing, Filter1DTiledAllocator )
+{
+    using Allocator = std::pmr::polymorphic_allocator< TypeParam >;
+    using TiledImageType = TiledImage< TypeParam, 1, Allocator >;
+
+    StatsMemoryResource resource( "filter" );
+
+    TiledImageType imageSrcTiled( 50, 37, true, Allocator( &resource ) );
+    imageSrcTiled.at( 20, 40 ) = TypeParam { 4 };
+
+    // The output is allocated on the resource of the input
+    TiledImageType imageDstTiled;
+    filter1D< FilterDirection::Row >(
+        imageSrcTiled, imageDstTiled, std::vector< int32_t > { 1, 2, 1 } );
+
+    EXPECT_EQ( resource.getSnapshot( ).allocations, 2 );
+    EXPECT_EQ( imageDstTiled.at( 20, 39 ), TypeParam { 1 } );
+    EXPECT_EQ( imageDstTiled.at( 20, 40 ), TypeParam { 2 } );
+    EXPECT_EQ( imageDstTiled.at( 20, 41 ), TypeParam { 1 } );
+}
+
+TYPED_TEST( TestCvlProcessingSmoothing, CompileTimeKernels )
+{
+    Image< TypeParam, 1 > imageSrc( 40, 30 );
+
+    for ( int32_t y = 0; y < imageSrc.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < imageSrc.getWidth( ); x++ )
+        {
+            imageSrc.at( y, x ) =
+                static_cast< TypeParam >( ( x * 37 + y * 101 ) % 256 );
+        }
+    }
+
+    Image< TypeParam, 1 > imageDst;
+    Image< TypeParam, 1 > imageCmp;
+
+    boxBlur< 5, 5 >( imageSrc, imageDst );
+    boxBlur( imageSrc, imageCmp, SizeI( 5, 5 ) );
+    EXPECT_EQ( imageDst, imageCmp );
+
+    // Large kernels run on the running sums like the runtime version
+    boxBlur< 15, 13 >( imageSrc, imageDst );
+    boxBlur( imageSrc, imageCmp, SizeI( 15, 13 ) );
+    EXPECT_EQ( imageDst, imageCmp );
+
+    binomialBlur< 3, 3 >( imageSrc, imageDst );
+    binomialBlur( imageSrc, imageCmp, SizeI( 3, 3 ) );
+    EXPECT_EQ( imageDst, imageCmp );
+
+    // Sizes without an unrolled version
+    binomialBlur< 9, 7 >( imageSrc, imageDst );
+    binomialBlur( imageSrc, imageCmp, SizeI( 9, 7 ) );
+    EXPECT_EQ( imageDst, imageCmp );
+
+    // Kernels without a fixed-point version
+    const std::array< float, 5 > floatKernel { 0.5f, 1.0f, 2.0f, 1.0f, 0.5f };
+
+    filter1D< FilterDirection::Row >( imageSrc, imageDst, floatKernel );
+    filter1D< FilterDirection::Row >(
+        imageSrc,
+        imageCmp,
+        std::vector< float >( floatKernel.begin( ), floatKernel.end( ) ) );
+    EXPECT_EQ( imageDst, imageCmp );
+
+    filter1D< FilterDirection::Column >( imageSrc, imageDst, floatKernel );
+    filter1D< FilterDirection::Column >(
+        imageSrc,
+        imageCmp,
+        std::vector< float >( floatKernel.begin( ), floatKernel.end( ) ) );
+    EXPECT_EQ( imageDst, imageCmp );
+
+    // Kernels that are not separable
+    const std::array< std::array< int32_t, 3 >, 3 > laplaceKernel {
+        { { 0, 1, 0 }, { 1, 4, 1 }, { 0, 1, 0 } } };
+
+    filter2D( imageSrc, imageDst, laplaceKernel );
+    filter2D( imageSrc,
+              imageCmp,
+              std::vector< std::vector< int32_t > > {
+                  { 0, 1, 0 }, { 1, 4, 1 }, { 0, 1, 0 } } );
+    EXPECT_EQ( imageDst, imageCmp );
+}
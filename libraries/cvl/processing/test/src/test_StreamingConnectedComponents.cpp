@@ -0,0 +1,217 @@
+// CVL includes
+#include <cvl/core/macros.h>
+#include <cvl/processing/ConnectedComponents.h>
+#include <cvl/processing/StreamingConnectedComponents.h>
+
+// GTest includes
+IGNORE_WARNINGS_GTEST_PUSH
+#include <gtest/gtest.h>
+IGNORE_WARNINGS_POP
+
+// STD includes
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace cvl::core;
+using namespace cvl::processing;
+
+class TestCvlProcessingStreamingConnectedComponents : public testing::Test
+{
+public:
+    CVL_DEFAULT_ONLY( TestCvlProcessingStreamingConnectedComponents );
+
+    static Image< uint8_t, 1 > getRandomBinaryImage( int32_t width,
+                                                      int32_t height,
+                                                      double density,
+                                                      uint32_t seed )
+    {
+        std::mt19937 gen( seed );
+        std::bernoulli_distribution dist( density );
+
+        Image< uint8_t, 1 > image( width, height, true );
+
+        for ( int32_t y = 0; y < image.getHeight( ); y++ )
+        {
+            for ( int32_t x = 0; x < image.getWidth( ); x++ )
+            {
+                image.at( y, x ) = dist( gen ) ? uint8_t { 0xFF } : uint8_t { };
+            }
+        }
+
+        return image;
+    }
+
+    // Streams the image in blocks of rows and returns the blobs in absolute
+    // image coordinates
+    static std::vector< StreamBlob >
+    streamImage( const Image< uint8_t, 1 >& image,
+                 int32_t blockHeight,
+                 bool createMasks )
+    {
+        StreamingConnectedComponents labeler( image.getWidth( ), createMasks );
+        std::vector< StreamBlob > blobs;
+
+        for ( int32_t y = 0; y < image.getHeight( ); y += blockHeight )
+        {
+            const auto height = std::min( blockHeight, image.getHeight( ) - y );
+            const auto block = image( Rectangle< int32_t >(
+                Point2i( 0, y ), SizeI( image.getWidth( ), height ) ) );
+
+            labeler.pushRows( block, blobs );
+        }
+
+        labeler.finish( blobs );
+
+        EXPECT_EQ( labeler.getRowCount( ), image.getHeight( ) );
+        EXPECT_EQ( labeler.getNumberActiveComponents( ), 0 );
+
+        return blobs;
+    }
+
+    static auto getKey( const Blob& blob, int64_t originRow )
+    {
+        return std::make_tuple( blob.top + originRow,
+                                blob.bottom + originRow,
+                                blob.left,
+                                blob.right,
+                                blob.area,
+                                blob.sumX,
+                                blob.sumY + originRow * blob.area );
+    }
+};
+
+TEST_F( TestCvlProcessingStreamingConnectedComponents, MatchesFrameLabeling )
+{
+    for ( uint32_t seed = 0; seed < 6; seed++ )
+    {
+        const auto density = 0.2 + 0.1 * seed;
+        const auto image = getRandomBinaryImage( 61, 97, density, seed );
+
+        const auto blobsCmp = connectedComponents( image );
+
+        std::vector< decltype( getKey( blobsCmp.front( ), 0 ) ) > keysCmp;
+
+        for ( const auto& blob : blobsCmp )
+        {
+            keysCmp.push_back( getKey( blob, 0 ) );
+        }
+
+        std::sort( keysCmp.begin( ), keysCmp.end( ) );
+
+        for ( const auto blockHeight : { 1, 3, 17, 97 } )
+        {
+            const auto blobs = streamImage( image, blockHeight, false );
+
+            std::vector< decltype( getKey( blobsCmp.front( ), 0 ) ) > keys;
+
+            for ( const auto& streamBlob : blobs )
+            {
+                EXPECT_EQ( streamBlob.blob.top, 0 );
+                EXPECT_TRUE( streamBlob.mask.isEmpty( ) );
+
+                keys.push_back(
+                    getKey( streamBlob.blob, streamBlob.originRow ) );
+            }
+
+            std::sort( keys.begin( ), keys.end( ) );
+
+            EXPECT_EQ( keys, keysCmp )
+                << "seed: " << seed << ", block height: " << blockHeight;
+        }
+    }
+}
+
+TEST_F( TestCvlProcessingStreamingConnectedComponents, Masks )
+{
+    const auto image = getRandomBinaryImage( 53, 71, 0.5, 3 );
+
+    Image< int32_t, 1 > labelImage;
+    const auto regions = connectedComponents< int32_t >( image, labelImage );
+
+    const auto blobs = streamImage( image, 5, true );
+
+    ASSERT_EQ( blobs.size( ), regions.size( ) );
+
+    std::vector< bool > visited( regions.size( ) + 1 );
+
+    for ( size_t i = 0; i < blobs.size( ); i++ )
+    {
+        const auto& streamBlob = blobs[ i ];
+        const auto& mask = streamBlob.mask;
+
+        EXPECT_EQ( streamBlob.id, static_cast< int64_t >( i + 1 ) );
+        EXPECT_EQ( mask.getArea( ), streamBlob.blob.area );
+        EXPECT_EQ( mask.getImageSize( ),
+                   SizeI( image.getWidth( ), streamBlob.blob.bottom + 1 ) );
+
+        // All pixels of the mask belong to the same frame label
+        const auto& firstRun = mask.getRuns( ).front( );
+        const auto label = labelImage.at(
+            static_cast< int32_t >( streamBlob.originRow ) + firstRun.row,
+            firstRun.colStart );
+
+        ASSERT_NE( label, 0 );
+        EXPECT_FALSE( visited[ static_cast< size_t >( label ) ] );
+        visited[ static_cast< size_t >( label ) ] = true;
+
+        for ( const auto& run : mask.getRuns( ) )
+        {
+            for ( auto x = run.colStart; x <= run.colEnd; x++ )
+            {
+                EXPECT_EQ( labelImage.at( static_cast< int32_t >(
+                                              streamBlob.originRow ) +
+                                              run.row,
+                                          x ),
+                           label );
+            }
+        }
+    }
+}
+
+TEST_F( TestCvlProcessingStreamingConnectedComponents, EmitLatency )
+{
+    // A U shape is merged in its last row and completed one row later
+    Image< uint8_t, 1 > rows( 8, 1, true );
+    std::vector< StreamBlob > blobs;
+
+    StreamingConnectedComponents labeler( 8, true );
+
+    for ( int32_t y = 0; y < 4; y++ )
+    {
+        rows.at( 0, 1 ) = 0xFF;
+        rows.at( 0, 5 ) = 0xFF;
+        labeler.pushRows( rows, blobs );
+    }
+
+    EXPECT_EQ( labeler.getNumberActiveComponents( ), 2 );
+
+    std::fill_n( rows.getRowPointer( 0 ), 8, uint8_t { 0xFF } );
+    labeler.pushRows( rows, blobs );
+
+    EXPECT_EQ( labeler.getNumberActiveComponents( ), 1 );
+    EXPECT_TRUE( blobs.empty( ) );
+
+    std::fill_n( rows.getRowPointer( 0 ), 8, uint8_t { 0 } );
+    labeler.pushRows( rows, blobs );
+
+    ASSERT_EQ( blobs.size( ), 1 );
+    EXPECT_EQ( blobs.front( ).originRow, 0 );
+    EXPECT_EQ( blobs.front( ).blob.area, 4 * 2 + 8 );
+    EXPECT_EQ( blobs.front( ).blob.bottom, 4 );
+    EXPECT_EQ( blobs.front( ).mask.getNumberRuns( ), 4 * 2 + 1 );
+
+    // The stream continues with row coordinates relative to the blob
+    rows.at( 0, 3 ) = 0xFF;
+    labeler.pushRows( rows, blobs );
+    labeler.finish( blobs );
+
+    ASSERT_EQ( blobs.size( ), 2 );
+    EXPECT_EQ( blobs.back( ).originRow, 6 );
+    EXPECT_EQ( blobs.back( ).blob.top, 0 );
+    EXPECT_EQ( blobs.back( ).id, 2 );
+
+    Image< uint8_t, 1 > wrongWidth( 7, 1, true );
+    EXPECT_THROW( labeler.pushRows( wrongWidth, blobs ), Error );
+}
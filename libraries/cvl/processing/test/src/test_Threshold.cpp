@@ -8,10 +8,14 @@ IGNORE_WARNINGS_GTEST_PUSH
 IGNORE_WARNINGS_POP
 
 // STD includes
-#include <random>
+#include <limits>
 #include <list>
+#include <memory_resource>
+#include <random>
+#include <vector>
 
 // CVL includes
+#include <cvl/core/StatsMemoryResource.h>
 #include <cvl/processing/Threshold.h>
 
 using namespace cvl::core;
@@ -93,3 +97,157 @@ TYPED_TEST( TestCvlProcessingThreshold, FixThresholdEmptyRegion )
         }
     }
 }
+
+TYPED_TEST( TestCvlProcessingThreshold, FixThresholdRegionRLE )
+{
+    const auto threshValue =
+        static_cast< TypeParam >( this->getRandomThresholdValue( ) );
+    const auto testImage = this->getGrayWedgeImage( );
+
+    RegionRLE region;
+    threshold( testImage, region, threshValue );
+
+    EXPECT_EQ( region.getImageSize( ), testImage.getSize( ) );
+
+    const auto colStart = static_cast< int32_t >( threshValue ) + 1;
+
+    if ( colStart >= testImage.getWidth( ) )
+    {
+        EXPECT_TRUE( region.isEmpty( ) );
+        return;
+    }
+
+    // Every row of the gray wedge contains exactly one run
+    ASSERT_EQ( region.getNumberRuns( ),
+               static_cast< size_t >( testImage.getHeight( ) ) );
+
+    for ( const auto& run : region.getRuns( ) )
+    {
+        EXPECT_EQ( run.colStart, colStart );
+        EXPECT_EQ( run.colEnd, testImage.getWidth( ) - 1 );
+    }
+
+    // The run length encoded region matches the label image based region
+    Region< uint8_t > regionCmp;
+    threshold( testImage, regionCmp, threshValue );
+
+    EXPECT_EQ( region, RegionRLE::fromRegion( regionCmp ) );
+}
+
+TYPED_TEST( TestCvlProcessingThreshold, SimdKernelsBitIdentical )
+{
+    if constexpr ( detail::hasThresholdKernel< TypeParam > )
+    {
+        std::mt19937 gen( 7 ); // NOLINT(cert-msc51-cpp)
+        std::uniform_int_distribution< int32_t > dist(
+            0, std::is_same_v< TypeParam, uint8_t > ? 255 : 65535 );
+
+        // Widths cover the vector bodies and the scalar tails of all levels
+        for ( const auto width :
+              { 1, 15, 16, 17, 31, 33, 63, 64, 65, 127, 259 } )
+        {
+            std::vector< TypeParam > src( static_cast< size_t >( width ) );
+
+            for ( auto& value : src )
+            {
+                value = static_cast< TypeParam >( dist( gen ) );
+            }
+
+            if constexpr ( std::is_same_v< TypeParam, float > )
+            {
+                // Comparisons with NaN are false for all implementations
+                src.front( ) = std::numeric_limits< float >::quiet_NaN( );
+                src.back( ) = -0.0F;
+            }
+
+            const std::vector< TypeParam > thresholds {
+                std::numeric_limits< TypeParam >::lowest( ),
+                TypeParam { 0 },
+                static_cast< TypeParam >( dist( gen ) ),
+                std::numeric_limits< TypeParam >::max( ) };
+
+            for ( const auto thr : thresholds )
+            {
+                std::vector< uint8_t > expected( src.size( ) );
+                detail::thresholdRowScalar(
+                    src.data( ), expected.data( ), width, thr, uint8_t { 7 } );
+
+                for ( const auto level :
+                      { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2,
+                        SimdLevel::AVX512 } )
+                {
+                    if ( ! isSimdLevelSupported( level ) )
+                    {
+                        continue;
+                    }
+
+                    std::vector< uint8_t > result( src.size( ), uint8_t { 1 } );
+                    detail::thresholdRow( src.data( ), result.data( ), width,
+                                          thr, uint8_t { 7 }, level );
+
+                    EXPECT_EQ( result, expected )
+                        << "level: " << level << ", width: " << width;
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST( TestCvlProcessingThreshold, FixThresholdTiled )
+{
+    const auto threshValue =
+        static_cast< TypeParam >( this->getRandomThresholdValue( ) );
+    const auto testImage = this->getGrayWedgeImage( );
+
+    TiledImage< TypeParam, 1 > testImageTiled;
+    toTiled( testImage, testImageTiled );
+
+    TiledImage< uint8_t, 1 > imageTiled;
+    threshold( testImageTiled, imageTiled, threshValue, uint8_t { 255 } );
+
+    Region< uint8_t > regionCmp;
+    threshold( testImage, regionCmp, threshValue, uint8_t { 255 } );
+
+    Image< uint8_t, 1 > image;
+    toLinear( imageTiled, image );
+
+    EXPECT_EQ( image, regionCmp.getLabelImage( ) );
+}
+
+TYPED_TEST( TestCvlProcessingThreshold, FixThresholdTiledAllocator )
+{
+    using Allocator = std::pmr::polymorphic_allocator< TypeParam >;
+    using OutAllocator = std::pmr::polymorphic_allocator< uint8_t >;
+
+    StatsMemoryResource resource( "threshold" );
+
+    const auto threshValue =
+        static_cast< TypeParam >( this->getRandomThresholdValue( ) );
+    const auto testImage = this->getGrayWedgeImage( );
+
+    TiledImage< TypeParam, 1, Allocator > testImageTiled(
+        testImage.getSize( ), false, Allocator( &resource ) );
+
+    for ( int32_t y = 0; y < testImage.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < testImage.getWidth( ); x++ )
+        {
+            testImageTiled.at( y, x ) = testImage.at( y, x );
+        }
+    }
+
+    // The output is allocated on the resource of the input
+    TiledImage< uint8_t, 1, OutAllocator > imageTiled;
+    threshold( testImageTiled, imageTiled, threshValue, uint8_t { 255 } );
+
+    EXPECT_EQ( resource.getSnapshot( ).allocations, 2 );
+
+    for ( int32_t y = 0; y < testImage.getHeight( ); y++ )
+    {
+        for ( int32_t x = 0; x < testImage.getWidth( ); x++ )
+        {
+            ASSERT_EQ( imageTiled.at( y, x ),
+                       testImage.at( y, x ) > threshValue ? 255 : 0 );
+        }
+    }
+}